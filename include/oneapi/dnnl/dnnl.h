@@ -314,6 +314,37 @@ dnnl_status_t DNNL_API dnnl_primitive_attr_get_scratchpad_mode(
 dnnl_status_t DNNL_API dnnl_primitive_attr_set_scratchpad_mode(
         dnnl_primitive_attr_t attr, dnnl_scratchpad_mode_t mode);
 
+/// Sets primitive attributes rounding mode for a given memory argument. The
+/// mode applies when the values are down-converted to the data type of the
+/// argument.
+///
+/// @note
+///     The stochastic rounding is implemented by the reference
+///     implementations only. Setting it dispatches a primitive to a reference
+///     implementation that may be orders of magnitude slower than the
+///     optimized one used with the default rounding mode.
+///
+/// @param attr Primitive attributes.
+/// @param arg Argument for which the rounding mode should be set, for
+///     instance #DNNL_ARG_DST or #DNNL_ARG_DIFF_WEIGHTS.
+/// @param mode Rounding mode. The possible values are:
+///     #dnnl_rounding_mode_environment (default) and
+///     #dnnl_rounding_mode_stochastic.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_primitive_attr_set_rounding(
+        dnnl_primitive_attr_t attr, int arg, dnnl_rounding_mode_t mode);
+
+/// Returns primitive attributes rounding mode for a given memory argument.
+///
+/// @param attr Primitive attributes.
+/// @param arg Argument for which the rounding mode should be queried.
+/// @param mode Output rounding mode.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_primitive_attr_get_rounding(
+        const_dnnl_primitive_attr_t attr, int arg, dnnl_rounding_mode_t *mode);
+
 /// Sets primitive attributes scaling factors for primitive operations for a
 /// given memory argument. The scaling factors must be passed at execution time
 /// as an argument with index #DNNL_ARG_ATTR_SCALES | arg.
@@ -354,6 +385,132 @@ dnnl_status_t DNNL_API dnnl_primitive_attr_set_scales_mask(
 dnnl_status_t DNNL_API dnnl_primitive_attr_set_zero_points_mask(
         dnnl_primitive_attr_t attr, int arg, int mask);
 
+/// Sets primitive attributes scaling factors for primitive operations for a
+/// given memory argument, with groups and a data type. The scaling factors
+/// must be passed at execution time as an argument with index
+/// #DNNL_ARG_ATTR_SCALES | arg.
+///
+/// @sa dnnl_primitive_attr_set_scales_mask
+///
+/// @param attr Primitive attributes.
+/// @param arg Parameter argument index as passed to the
+///     dnnl_primitive_execute() call.
+/// @param mask Scaling factors correspondence mask that defines the
+///     correspondence between the tensor dimensions and the scales array.
+///     The set i-th bit indicates that dedicated scaling factors are used
+///     along that dimension.
+/// @param ndims Number of group dimensions. Set to 0 to have a dedicated
+///     scaling factor for each index along the dimensions set in @p mask.
+/// @param group_dims Group sizes along the last @p ndims dimensions of the
+///     tensor, for example {32, 1} to share a scaling factor among 32
+///     consecutive elements along K of the matmul weights.
+/// @param data_type Scaling factors data type: #dnnl_f32, #dnnl_bf16 or
+///     #dnnl_f16.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_primitive_attr_set_scales(
+        dnnl_primitive_attr_t attr, int arg, int mask, int ndims,
+        const dnnl_dims_t group_dims, dnnl_data_type_t data_type);
+
+/// Sets primitive attributes zero points for primitive operations for a given
+/// memory argument, with groups and a data type. The zero points must be
+/// passed at execution time as an argument with index
+/// #DNNL_ARG_ATTR_ZERO_POINTS | arg.
+///
+/// @sa dnnl_primitive_attr_set_zero_points_mask
+///
+/// @param attr Primitive attributes.
+/// @param arg Parameter argument index as passed to the
+///     dnnl_primitive_execute() call. Groups and data types other than
+///     #dnnl_s32 are supported for #DNNL_ARG_WEIGHTS only.
+/// @param mask Zero point correspondence mask that defines the
+///     correspondence between the tensor dimensions and the zero points
+///     array. The set i-th bit indicates that dedicated zero points are used
+///     along that dimension.
+/// @param ndims Number of group dimensions. Set to 0 to have a dedicated
+///     zero point for each index along the dimensions set in @p mask.
+/// @param group_dims Group sizes along the last @p ndims dimensions of the
+///     tensor.
+/// @param data_type Zero points data type: #dnnl_s32, #dnnl_s8, #dnnl_u8,
+///     #dnnl_s4 or #dnnl_u4.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_primitive_attr_set_zero_points(
+        dnnl_primitive_attr_t attr, int arg, int mask, int ndims,
+        const dnnl_dims_t group_dims, dnnl_data_type_t data_type);
+
+/// Sets primitive attributes dynamic quantization parameters of the source.
+/// When set, the primitive quantizes a floating-point source to @p data_type
+/// at execution time, computing one symmetric scale per row of the source
+/// from its absolute maximum, and dequantizes the result with these scales.
+///
+/// @param attr Primitive attributes.
+/// @param data_type Data type the source is quantized to: #dnnl_s8, or
+///     #dnnl_data_type_undef to disable dynamic quantization.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_primitive_attr_set_src_dyn_quant_params(
+        dnnl_primitive_attr_t attr, dnnl_data_type_t data_type);
+
+/// Returns primitive attributes dynamic quantization parameters of the
+/// source.
+///
+/// @param attr Primitive attributes.
+/// @param data_type Output data type the source is quantized to, or
+///     #dnnl_data_type_undef if dynamic quantization is disabled.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_primitive_attr_get_src_dyn_quant_params(
+        const_dnnl_primitive_attr_t attr, dnnl_data_type_t *data_type);
+
+/// Sets primitive attributes page size of the weights. When set, the weights
+/// are split into pages of @p page_size consecutive indices along the
+/// outermost of their two last dimensions, and the primitive locates the
+/// pages through a page table of #dnnl_s32 data type passed at execution time
+/// as an argument with index #DNNL_ARG_WEIGHTS_PAGE_TABLE.
+///
+/// @param attr Primitive attributes.
+/// @param page_size Number of indices in a page, or 0 to disable paging.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_primitive_attr_set_weights_page_size(
+        dnnl_primitive_attr_t attr, dnnl_dim_t page_size);
+
+/// Returns primitive attributes page size of the weights.
+///
+/// @param attr Primitive attributes.
+/// @param page_size Output number of indices in a page, or 0 if the weights
+///     are not paged.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_primitive_attr_get_weights_page_size(
+        const_dnnl_primitive_attr_t attr, dnnl_dim_t *page_size);
+
+/// Sets primitive attributes computation of the destination dynamic range.
+/// When set, the primitive writes the maximum absolute value of the
+/// destination to a single #dnnl_f32 value passed at execution time as an
+/// argument with index #DNNL_ARG_DST_AMAX. The maximum is taken over the
+/// values after the post-ops and before the destination scaling and the
+/// conversion to the destination data type.
+///
+/// @param attr Primitive attributes.
+/// @param dst_amax Non-zero value to compute the destination maximum absolute
+///     value, or 0 to disable it.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_primitive_attr_set_dst_amax(
+        dnnl_primitive_attr_t attr, int dst_amax);
+
+/// Returns primitive attributes computation of the destination dynamic range.
+///
+/// @param attr Primitive attributes.
+/// @param dst_amax Output non-zero value if the destination maximum absolute
+///     value is computed, and 0 otherwise.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_primitive_attr_get_dst_amax(
+        const_dnnl_primitive_attr_t attr, int *dst_amax);
+
 /// Returns primitive attributes post-ops.
 ///
 /// @warning
@@ -973,6 +1130,10 @@ size_t DNNL_API dnnl_memory_desc_get_size_v2(
 
 /// Returns the size of data type.
 ///
+/// @note
+///     For the 4-bit data types the function returns 1, as two values share
+///     a byte.
+///
 /// @param data_type Data type.
 /// @returns The number of bytes occupied by data type.
 size_t DNNL_API dnnl_data_type_size(dnnl_data_type_t data_type);
@@ -3210,6 +3371,105 @@ dnnl_status_t DNNL_API dnnl_get_primitive_cache_capacity(int *capacity);
 ///     success.
 dnnl_status_t DNNL_API dnnl_set_primitive_cache_capacity(int capacity);
 
+/// Returns the maximum memory footprint in bytes of the primitives held in
+/// the primitive cache.
+///
+/// @param limit Primitive cache memory limit to query. The value of 0 means
+///     that the memory footprint is not limited. Concurrently accessing
+///     @p limit is safe.
+/// @returns #dnnl_invalid_arguments/#dnnl::status::invalid_arguments if the
+///     @p limit value is invalid, and #dnnl_success/#dnnl::status::success on
+///     success.
+dnnl_status_t DNNL_API dnnl_get_primitive_cache_memory_limit(size_t *limit);
+
+/// Sets the maximum memory footprint in bytes of the primitives held in the
+/// primitive cache.
+///
+/// @param limit Primitive cache memory limit to set. If the footprint of the
+///     primitives that the primitive cache already has exceeds the new
+///     @p limit then the entries are evicted until the footprint fits the
+///     limit. Large rarely used primitives are evicted first. Setting the
+///     @p limit to 0 removes the limit. Concurrently modifying @p limit is
+///     safe.
+/// @returns #dnnl_success/#dnnl::status::success on success.
+dnnl_status_t DNNL_API dnnl_set_primitive_cache_memory_limit(size_t limit);
+
+/// Returns the estimated memory footprint in bytes of the primitives held in
+/// the primitive cache.
+///
+/// @note
+///     The footprint includes the primitive objects and the generated
+///     kernel code. It does not include the memory allocated by the
+///     primitives for a particular engine, e.g. OpenCL kernels.
+///
+/// @param kind Primitive kind to query the footprint for. If @p kind is
+///     #dnnl_undefined_primitive the footprint of all the primitives is
+///     returned.
+/// @param footprint Primitive cache footprint to query.
+/// @returns #dnnl_invalid_arguments/#dnnl::status::invalid_arguments if the
+///     @p footprint value is invalid, and #dnnl_success/#dnnl::status::success
+///     on success.
+dnnl_status_t DNNL_API dnnl_get_primitive_cache_footprint(
+        dnnl_primitive_kind_t kind, size_t *footprint);
+
+/// Returns the primitive cache statistics.
+///
+/// The statistics are collected since the library was loaded or since the
+/// last call to dnnl_reset_primitive_cache_stats().
+///
+/// @param kind Primitive kind to query the statistics for. If @p kind is
+///     #dnnl_undefined_primitive the statistics for all the primitives are
+///     returned.
+/// @param stats Primitive cache statistics to query.
+/// @returns #dnnl_invalid_arguments/#dnnl::status::invalid_arguments if the
+///     @p stats value is invalid, and #dnnl_success/#dnnl::status::success on
+///     success.
+dnnl_status_t DNNL_API dnnl_get_primitive_cache_stats(
+        dnnl_primitive_kind_t kind, dnnl_primitive_cache_stats_t *stats);
+
+/// Resets the primitive cache statistics.
+///
+/// @returns #dnnl_success/#dnnl::status::success on success.
+dnnl_status_t DNNL_API dnnl_reset_primitive_cache_stats(void);
+
+/// Prints the primitive cache statistics for each primitive kind to the
+/// standard output in the comma-separated format.
+///
+/// @returns #dnnl_success/#dnnl::status::success on success.
+dnnl_status_t DNNL_API dnnl_dump_primitive_cache_stats(void);
+
+/// Submits creation of primitives for the primitive descriptors to helper
+/// threads and returns without waiting for the creation to complete.
+///
+/// The created primitives are put into the primitive cache. A primitive
+/// created with dnnl_primitive_create() for a primitive descriptor that is
+/// being created in the background waits for the background creation to
+/// complete instead of creating the primitive once again. This allows
+/// warming up the primitive cache for the expected shapes in parallel.
+///
+/// @note
+///     The function does nothing if the primitive cache is disabled.
+///
+/// @note
+///     An error that occurs during the background creation is not reported.
+///     A subsequent call to dnnl_primitive_create() for the same primitive
+///     descriptor reports it.
+///
+/// @param npds Number of primitive descriptors.
+/// @param pds Array of primitive descriptors. The primitive descriptors may
+///     be destroyed right after the function returns.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_primitive_cache_warm_up(
+        int npds, const_dnnl_primitive_desc_t *pds);
+
+/// Waits for the creation of all the primitives submitted with
+/// dnnl_primitive_cache_warm_up() to complete.
+///
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_primitive_cache_warm_up_wait(void);
+
 /// @} dnnl_api_primitive_cache
 
 /// @addtogroup dnnl_api_service
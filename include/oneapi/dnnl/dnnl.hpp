@@ -298,6 +298,24 @@ inline dnnl_scratchpad_mode_t convert_to_c(scratchpad_mode mode) {
     return static_cast<dnnl_scratchpad_mode_t>(mode);
 }
 
+/// Rounding mode
+enum class rounding_mode {
+    /// The rounding mode of the environment, which is round to nearest even
+    /// for the down-conversions to the floating-point data types (default).
+    environment = dnnl_rounding_mode_environment,
+    /// Stochastic rounding driven by the seed passed at execution time as an
+    /// argument with index #DNNL_ARG_ATTR_ROUNDING_SEED.
+    stochastic = dnnl_rounding_mode_stochastic,
+};
+
+/// Converts a rounding mode enum value from C++ API to C API type.
+///
+/// @param mode C++ API rounding mode enum value.
+/// @returns Corresponding C API rounding mode enum value.
+inline dnnl_rounding_mode_t convert_to_c(rounding_mode mode) {
+    return static_cast<dnnl_rounding_mode_t>(mode);
+}
+
 /// Propagation kind.
 enum class prop_kind {
     /// Undefined propagation kind.
@@ -848,6 +866,16 @@ struct memory : public handle<dnnl_memory_t> {
         s8 = dnnl_s8,
         /// 8-bit unsigned integer.
         u8 = dnnl_u8,
+        /// 4-bit signed integer.
+        s4 = dnnl_s4,
+        /// 4-bit unsigned integer.
+        u4 = dnnl_u4,
+        /// [OFP8 standard 8-bit floating-point](https://www.opencompute.org/documents/ocp-8-bit-floating-point-specification-ofp8-revision-1-0-2023-06-20-pdf)
+        /// with a 5-bit exponent and a 2-bit mantissa.
+        f8_e5m2 = dnnl_f8_e5m2,
+        /// [OFP8 standard 8-bit floating-point](https://www.opencompute.org/documents/ocp-8-bit-floating-point-specification-ofp8-revision-1-0-2023-06-20-pdf)
+        /// with a 4-bit exponent and a 3-bit mantissa.
+        f8_e4m3 = dnnl_f8_e4m3,
     };
 
     /// Returns size of data type in bytes.
@@ -3563,6 +3591,36 @@ struct primitive_attr : public handle<dnnl_primitive_attr_t> {
                 "could not set scratchpad mode primitive attribute");
     }
 
+    /// Returns the rounding mode for a given memory argument.
+    ///
+    /// @param arg Argument for which the rounding mode should be queried.
+    rounding_mode get_rounding_mode(int arg) const {
+        dnnl_rounding_mode_t result;
+        error::wrap_c_api(dnnl_primitive_attr_get_rounding(get(), arg, &result),
+                "could not get rounding mode primitive attribute");
+        return rounding_mode(result);
+    }
+
+    /// Sets the rounding mode for a given memory argument. With the
+    /// stochastic rounding mode the seed must be passed at execution time as
+    /// an argument with index #DNNL_ARG_ATTR_ROUNDING_SEED.
+    ///
+    /// @note
+    ///     The stochastic rounding is implemented by the reference
+    ///     implementations only. Setting it dispatches a primitive to a
+    ///     reference implementation that may be orders of magnitude slower
+    ///     than the optimized one used with the default rounding mode.
+    ///
+    /// @sa dnnl_primitive_attr_set_rounding
+    ///
+    /// @param arg Argument for which the rounding mode should be set.
+    /// @param mode Specified rounding mode.
+    void set_rounding_mode(int arg, rounding_mode mode) {
+        error::wrap_c_api(dnnl_primitive_attr_set_rounding(
+                                  get(), arg, dnnl::convert_to_c(mode)),
+                "could not set rounding mode primitive attribute");
+    }
+
     /// Sets scaling factors for primitive operations for a given memory
     /// argument. The scaling factors must be passed at execution time
     /// as an argument with index #DNNL_ARG_ATTR_SCALES | arg.
@@ -3600,6 +3658,134 @@ struct primitive_attr : public handle<dnnl_primitive_attr_t> {
                 "could not set zero points primitive attribute");
     }
 
+    /// Sets scaling factors for primitive operations for a given memory
+    /// argument, with groups and a data type. The scaling factors must be
+    /// passed at execution time as an argument with index
+    /// #DNNL_ARG_ATTR_SCALES | arg.
+    ///
+    /// @sa dnnl_primitive_attr_set_scales
+    ///
+    /// @param arg Parameter argument index as passed to the
+    ///     primitive::execute() call.
+    /// @param mask Scaling factors correspondence mask that defines the
+    ///     correspondence between the tensor dimensions and the @p scales
+    ///     vector. The set i-th bit indicates that dedicated scaling factors
+    ///     are used along that dimension.
+    /// @param groups Group sizes along the last dimensions of the tensor,
+    ///     for example {32, 1} to share a scaling factor among 32
+    ///     consecutive elements along K of the matmul weights. Empty groups
+    ///     mean a dedicated scaling factor per index.
+    /// @param data_type Scaling factors data type.
+    void set_scales(int arg, int mask, const memory::dims &groups,
+            memory::data_type data_type = memory::data_type::f32) {
+        error::wrap_c_api(dnnl_primitive_attr_set_scales(get(), arg, mask,
+                                  (int)groups.size(), groups.data(),
+                                  memory::convert_to_c(data_type)),
+                "could not set scales primitive attribute");
+    }
+
+    /// Sets zero points for primitive operations for a given memory argument,
+    /// with groups and a data type. The zero points must be passed at
+    /// execution time as an argument with index
+    /// #DNNL_ARG_ATTR_ZERO_POINTS | arg.
+    ///
+    /// @sa dnnl_primitive_attr_set_zero_points
+    ///
+    /// @param arg Parameter argument index as passed to the
+    ///     primitive::execute() call.
+    /// @param mask Zero point correspondence mask that defines the
+    ///     correspondence between the tensor dimensions and the @p
+    ///     zero_points vector. The set i-th bit indicates that dedicated zero
+    ///     points are used along that dimension.
+    /// @param groups Group sizes along the last dimensions of the tensor.
+    ///     Empty groups mean a dedicated zero point per index.
+    /// @param data_type Zero points data type.
+    void set_zero_points(int arg, int mask, const memory::dims &groups,
+            memory::data_type data_type = memory::data_type::s32) {
+        error::wrap_c_api(dnnl_primitive_attr_set_zero_points(get(), arg,
+                                  mask, (int)groups.size(), groups.data(),
+                                  memory::convert_to_c(data_type)),
+                "could not set zero points primitive attribute");
+    }
+
+    /// Sets dynamic quantization parameters of the source. The primitive
+    /// quantizes a floating-point source to @p data_type at execution time
+    /// using one symmetric scale per row computed from the source values.
+    ///
+    /// @sa dnnl_primitive_attr_set_src_dyn_quant_params
+    ///
+    /// @param data_type Data type the source is quantized to:
+    ///     #dnnl::memory::data_type::s8, or
+    ///     #dnnl::memory::data_type::undef to disable dynamic quantization.
+    void set_src_dyn_quant_params(memory::data_type data_type) {
+        error::wrap_c_api(dnnl_primitive_attr_set_src_dyn_quant_params(
+                                  get(), memory::convert_to_c(data_type)),
+                "could not set source dynamic quantization parameters "
+                "primitive attribute");
+    }
+
+    /// Returns dynamic quantization parameters of the source.
+    ///
+    /// @returns Data type the source is quantized to, or
+    ///     #dnnl::memory::data_type::undef if dynamic quantization is
+    ///     disabled.
+    memory::data_type get_src_dyn_quant_params() const {
+        dnnl_data_type_t c_data_type;
+        error::wrap_c_api(dnnl_primitive_attr_get_src_dyn_quant_params(
+                                  get(), &c_data_type),
+                "could not get source dynamic quantization parameters "
+                "primitive attribute");
+        return static_cast<memory::data_type>(c_data_type);
+    }
+
+    /// Sets page size of the weights. The weights are split into pages of
+    /// @p page_size consecutive indices along the outermost of their two last
+    /// dimensions, and the page table must be passed at execution time as an
+    /// argument with index #DNNL_ARG_WEIGHTS_PAGE_TABLE.
+    ///
+    /// @sa dnnl_primitive_attr_set_weights_page_size
+    ///
+    /// @param page_size Number of indices in a page, or 0 to disable paging.
+    void set_weights_page_size(memory::dim page_size) {
+        error::wrap_c_api(
+                dnnl_primitive_attr_set_weights_page_size(get(), page_size),
+                "could not set weights page size primitive attribute");
+    }
+
+    /// Returns page size of the weights.
+    ///
+    /// @returns Number of indices in a page, or 0 if the weights are not
+    ///     paged.
+    memory::dim get_weights_page_size() const {
+        dnnl_dim_t page_size;
+        error::wrap_c_api(
+                dnnl_primitive_attr_get_weights_page_size(get(), &page_size),
+                "could not get weights page size primitive attribute");
+        return page_size;
+    }
+
+    /// Sets computation of the destination maximum absolute value. When
+    /// enabled, the value is written to a single #dnnl::memory::data_type::f32
+    /// memory passed at execution time as an argument with index
+    /// #DNNL_ARG_DST_AMAX.
+    ///
+    /// @sa dnnl_primitive_attr_set_dst_amax
+    ///
+    /// @param dst_amax Whether to compute the destination maximum absolute
+    ///     value.
+    void set_dst_amax(bool dst_amax) {
+        error::wrap_c_api(dnnl_primitive_attr_set_dst_amax(get(), dst_amax),
+                "could not set destination amax primitive attribute");
+    }
+
+    /// Returns whether the destination maximum absolute value is computed.
+    bool get_dst_amax() const {
+        int dst_amax;
+        error::wrap_c_api(dnnl_primitive_attr_get_dst_amax(get(), &dst_amax),
+                "could not get destination amax primitive attribute");
+        return dst_amax != 0;
+    }
+
     /// Returns post-ops previously set via set_post_ops().
     ///
     /// @returns Post-ops.
@@ -12698,6 +12884,89 @@ inline void set_primitive_cache_capacity(int capacity) {
             "could not set primitive cache capacity");
 }
 
+/// Returns the maximum memory footprint in bytes of the primitives held in
+/// the primitive cache. The value of 0 means that the footprint is not
+/// limited.
+inline size_t get_primitive_cache_memory_limit() {
+    size_t result = 0;
+    error::wrap_c_api(dnnl_get_primitive_cache_memory_limit(&result),
+            "could not get primitive cache memory limit");
+    return result;
+}
+
+/// @copydoc dnnl_set_primitive_cache_memory_limit(size_t limit)
+inline void set_primitive_cache_memory_limit(size_t limit) {
+    error::wrap_c_api(dnnl_set_primitive_cache_memory_limit(limit),
+            "could not set primitive cache memory limit");
+}
+
+/// Returns the estimated memory footprint in bytes of the primitives held in
+/// the primitive cache.
+///
+/// @param akind Primitive kind to query the footprint for. If @p akind is
+///     #dnnl::primitive::kind::undef the footprint of all the primitives is
+///     returned.
+inline size_t get_primitive_cache_footprint(
+        primitive::kind akind = primitive::kind::undef) {
+    size_t result = 0;
+    error::wrap_c_api(dnnl_get_primitive_cache_footprint(
+                              convert_to_c(akind), &result),
+            "could not get primitive cache footprint");
+    return result;
+}
+
+/// Primitive cache statistics.
+using primitive_cache_stats_t = dnnl_primitive_cache_stats_t;
+
+/// Returns the primitive cache statistics.
+///
+/// @param akind Primitive kind to query the statistics for. If @p akind is
+///     #dnnl::primitive::kind::undef the statistics for all the primitives
+///     are returned.
+inline primitive_cache_stats_t get_primitive_cache_stats(
+        primitive::kind akind = primitive::kind::undef) {
+    primitive_cache_stats_t result {};
+    error::wrap_c_api(
+            dnnl_get_primitive_cache_stats(convert_to_c(akind), &result),
+            "could not get primitive cache statistics");
+    return result;
+}
+
+/// @copydoc dnnl_reset_primitive_cache_stats()
+inline void reset_primitive_cache_stats() {
+    error::wrap_c_api(dnnl_reset_primitive_cache_stats(),
+            "could not reset primitive cache statistics");
+}
+
+/// @copydoc dnnl_dump_primitive_cache_stats()
+inline void dump_primitive_cache_stats() {
+    error::wrap_c_api(dnnl_dump_primitive_cache_stats(),
+            "could not dump primitive cache statistics");
+}
+
+/// Submits creation of primitives for the primitive descriptors to helper
+/// threads and returns without waiting for the creation to complete.
+///
+/// @sa dnnl_primitive_cache_warm_up()
+///
+/// @param pds Primitive descriptors of the primitives to create.
+inline void warm_up_primitive_cache(
+        const std::vector<primitive_desc_base> &pds) {
+    std::vector<const_dnnl_primitive_desc_t> c_pds;
+    c_pds.reserve(pds.size());
+    for (const auto &pd : pds)
+        c_pds.push_back(pd.get());
+    error::wrap_c_api(dnnl_primitive_cache_warm_up(
+                              (int)c_pds.size(), c_pds.data()),
+            "could not warm up primitive cache");
+}
+
+/// @copydoc dnnl_primitive_cache_warm_up_wait()
+inline void wait_primitive_cache_warm_up() {
+    error::wrap_c_api(dnnl_primitive_cache_warm_up_wait(),
+            "could not wait for primitive cache warm up");
+}
+
 /// @} dnnl_api_primitive_cache
 
 /// @addtogroup dnnl_api_blas BLAS functions
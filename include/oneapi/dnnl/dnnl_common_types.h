@@ -87,6 +87,18 @@ typedef enum {
     dnnl_u8 = 6,
     /// 64-bit/double-precision floating point.
     dnnl_f64 = 7,
+    /// 4-bit signed integer. Two values are packed in a byte, the first one
+    /// in the lower half.
+    dnnl_s4 = 8,
+    /// 4-bit unsigned integer. Two values are packed in a byte, the first one
+    /// in the lower half.
+    dnnl_u4 = 9,
+    /// [OFP8 standard 8-bit floating-point](https://www.opencompute.org/documents/ocp-8-bit-floating-point-specification-ofp8-revision-1-0-2023-06-20-pdf)
+    /// with a 5-bit exponent and a 2-bit mantissa.
+    dnnl_f8_e5m2 = 10,
+    /// [OFP8 standard 8-bit floating-point](https://www.opencompute.org/documents/ocp-8-bit-floating-point-specification-ofp8-revision-1-0-2023-06-20-pdf)
+    /// with a 4-bit exponent and a 3-bit mantissa.
+    dnnl_f8_e4m3 = 11,
 
     /// Parameter to allow internal only data_types without undefined behavior.
     /// This parameter is chosen to be valid for so long as sizeof(int) >= 2.
@@ -535,6 +535,60 @@ dnnl_status_t DNNL_API dnnl_graph_compiled_partition_get_inplace_ports(
         size_t *num_inplace_pairs,
         const dnnl_graph_inplace_pair_t **inplace_pairs);
 
+/// Returns the size of the temporary buffer which is allocated by the library
+/// on each execution of a compiled partition to hold the intermediate results
+/// between the operations in the partition. The size is the peak memory of
+/// the intermediate results after memory planning.
+///
+/// @param compiled_partition The handle of target compiled_partition.
+/// @param size Output size in bytes.
+/// @returns #dnnl_success on success or a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_graph_compiled_partition_get_scratchpad_size(
+        const_dnnl_graph_compiled_partition_t compiled_partition, size_t *size);
+
+/// Retrieves a constant blob with the constant tensors folded by a compiled
+/// partition, e.g. the reordered weights. The blob is versioned and the
+/// constants in it start at a page aligned offset, so it can be saved to a
+/// file and memory mapped later.
+///
+/// The constants are computed and cached on the first execution of the
+/// compiled partition, so the blob can only be retrieved after that. The
+/// constant tensor cache must be enabled.
+///
+/// @param compiled_partition The handle of target compiled_partition.
+/// @param size Size of the constant blob in bytes.
+/// @param blob Constant blob of size @p size. If the @p blob is nullptr then
+///     the size of the constant blob is returned in @p size.
+/// @returns #dnnl_success on success or a status describing the error
+///     otherwise. #dnnl_unimplemented is returned when the compiled partition
+///     or its engine doesn't support constant blobs.
+dnnl_status_t DNNL_API dnnl_graph_compiled_partition_get_constant_blob(
+        const_dnnl_graph_compiled_partition_t compiled_partition, size_t *size,
+        uint8_t *blob);
+
+/// Sets the constant tensors of a compiled partition from a constant blob
+/// retrieved by #dnnl_graph_compiled_partition_get_constant_blob(). The
+/// executions of the compiled partition then use the constants in the blob
+/// instead of computing them.
+///
+/// The blob must be retrieved from a compiled partition of the same partition
+/// compiled with the same logical tensors by the same library on the same
+/// kind of machine, otherwise #dnnl_invalid_arguments is returned. When the
+/// constants in the blob are suitably aligned, e.g. the blob is memory
+/// mapped, they are used in place without a copy and shared by all the
+/// processes that map the blob. So the blob must be kept alive and unchanged
+/// as long as the compiled partition.
+///
+/// @param compiled_partition The handle of target compiled_partition.
+/// @param size Size of the constant blob in bytes.
+/// @param blob Constant blob of size @p size.
+/// @returns #dnnl_success on success or a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_graph_compiled_partition_set_constant_blob(
+        dnnl_graph_compiled_partition_t compiled_partition, size_t size,
+        const uint8_t *blob);
+
 /// @} dnnl_graph_api_compiled_partition
 
 /// @addtogroup dnnl_graph_api_graph
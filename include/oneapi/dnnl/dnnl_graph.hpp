@@ -665,6 +665,53 @@ public:
         return inplace_options;
     }
 
+    /// Returns the size of the temporary buffer which is allocated by the
+    /// library on each execution of the compiled partition to hold the
+    /// intermediate results between the operations in the partition. The size
+    /// is the peak memory of the intermediate results after memory planning.
+    ///
+    /// @returns The size in bytes.
+    size_t get_scratchpad_size() const {
+        size_t size = 0;
+        error::wrap_c_api(
+                dnnl_graph_compiled_partition_get_scratchpad_size(get(), &size),
+                "could not get the scratchpad size from a compiled partition");
+        return size;
+    }
+
+    /// Returns a constant blob with the constant tensors folded by the
+    /// compiled partition, e.g. the reordered weights. The constants are
+    /// computed on the first execution, so the compiled partition must be
+    /// executed before. The blob can be saved to a file and set to the
+    /// compiled partition of another process with #set_constant_blob().
+    ///
+    /// @returns The constant blob.
+    std::vector<uint8_t> get_constant_blob() const {
+        size_t size = 0;
+        error::wrap_c_api(dnnl_graph_compiled_partition_get_constant_blob(
+                                  get(), &size, nullptr),
+                "could not get the constant blob size from a compiled "
+                "partition");
+        std::vector<uint8_t> blob(size);
+        error::wrap_c_api(dnnl_graph_compiled_partition_get_constant_blob(
+                                  get(), &size, blob.data()),
+                "could not get the constant blob from a compiled partition");
+        return blob;
+    }
+
+    /// Sets the constant tensors of the compiled partition from a constant
+    /// blob returned by #get_constant_blob(), so that they are not computed
+    /// again. The constants may be used in place, e.g. from a memory mapped
+    /// file, so the blob must outlive the compiled partition.
+    ///
+    /// @param blob Pointer to the constant blob.
+    /// @param size Size of the constant blob in bytes.
+    void set_constant_blob(const uint8_t *blob, size_t size) {
+        error::wrap_c_api(dnnl_graph_compiled_partition_set_constant_blob(
+                                  get(), size, blob),
+                "could not set the constant blob to a compiled partition");
+    }
+
     /// Execute a compiled partition.
     ///
     /// @param astream Stream object to run over.
@@ -2077,6 +2077,19 @@ typedef enum {
     dnnl_scratchpad_mode_user,
 } dnnl_scratchpad_mode_t;
 
+/// Rounding mode
+typedef enum {
+    /// The rounding mode of the environment, which is round to nearest even
+    /// for the down-conversions to the floating-point data types (default).
+    dnnl_rounding_mode_environment,
+    /// Stochastic rounding: a value is rounded up with the probability
+    /// proportional to its distance to the closest representable value below
+    /// it. The random bits come from a counter-based generator seeded with
+    /// the value passed at execution time as an argument with index
+    /// #DNNL_ARG_ATTR_ROUNDING_SEED.
+    dnnl_rounding_mode_stochastic,
+} dnnl_rounding_mode_t;
+
 /// @struct dnnl_primitive_attr
 /// @brief An opaque structure for primitive descriptor attributes.
 ///
@@ -2210,6 +2223,10 @@ typedef const struct dnnl_primitive *const_dnnl_primitive_t;
 /// An alias for #DNNL_ARG_WEIGHTS_3.
 #define DNNL_ARG_WEIGHTS_PROJECTION DNNL_ARG_WEIGHTS_3
 
+/// A special mnemonic for the page table of paged matmul weights.
+/// An alias for #DNNL_ARG_WEIGHTS_1.
+#define DNNL_ARG_WEIGHTS_PAGE_TABLE DNNL_ARG_WEIGHTS_1
+
 /// Bias tensor argument.
 #define DNNL_ARG_BIAS 41
 
@@ -2315,6 +2332,14 @@ typedef const struct dnnl_primitive *const_dnnl_primitive_t;
 /// Output scaling factors provided at execution time.
 #define DNNL_ARG_ATTR_OUTPUT_SCALES 513
 
+/// Seed of the stochastic rounding. A single s32 value is used for all the
+/// arguments with the stochastic rounding mode.
+#define DNNL_ARG_ATTR_ROUNDING_SEED 508
+
+/// Maximum absolute value of the destination, computed by the primitives with
+/// the destination amax attribute.
+#define DNNL_ARG_DST_AMAX 509
+
 /// Starting index for source arguments for primitives that take a variable
 /// number of source arguments.
 #define DNNL_ARG_MULTIPLE_SRC 1024
@@ -2483,6 +2508,28 @@ typedef enum {
 
 /// @} dnnl_api_primitives
 
+/// @addtogroup dnnl_api_primitive_cache
+/// @{
+
+/// Primitive cache statistics.
+typedef struct {
+    /// Number of primitive creations that took the primitive from the cache.
+    uint64_t hits;
+    /// Number of primitive creations that did not find the primitive in the
+    /// cache.
+    uint64_t misses;
+    /// Number of primitives evicted from the cache.
+    uint64_t evictions;
+    /// Total time in milliseconds spent on creation of the primitives that
+    /// were not found in the cache.
+    double creation_ms;
+    /// Total size in bytes of the code of the kernels generated at creation
+    /// of the primitives that were not found in the cache.
+    uint64_t jit_code_size;
+} dnnl_primitive_cache_stats_t;
+
+/// @} dnnl_api_primitive_cache
+
 /// @addtogroup dnnl_api_service
 /// @{
 
@@ -0,0 +1,52 @@
+/*******************************************************************************
+* Copyright 2023 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+#include <assert.h>
+
+#include "common/cache_blob.hpp"
+
+namespace dnnl {
+namespace impl {
+
+namespace {
+cache_blob_registry_t *&active_registry() {
+    static thread_local cache_blob_registry_t *registry = nullptr;
+    return registry;
+}
+} // namespace
+
+cache_blob_registry_t::cache_blob_registry_t(const cache_blob_t &cache_blob)
+    : cache_blob_(cache_blob), prev_(active_registry()) {
+    active_registry() = this;
+}
+
+cache_blob_registry_t::~cache_blob_registry_t() {
+    assert(active_registry() == this);
+    active_registry() = prev_;
+}
+
+cache_blob_registry_t *cache_blob_registry_t::get() {
+    return active_registry();
+}
+
+void cache_blob_registry_t::remove(const cache_blob_serializable_t *object) {
+    objects_.erase(std::remove(objects_.begin(), objects_.end(), object),
+            objects_.end());
+}
+
+} // namespace impl
+} // namespace dnnl
@@ -20,8 +20,10 @@
 #include <cstdint>
 #include <cstring>
 #include <memory>
+#include <vector>
 
 #include "c_types_map.hpp"
+#include "utils.hpp"
 
 namespace dnnl {
 namespace impl {
@@ -46,9 +48,12 @@ struct cache_blob_impl_t {
 
     status_t get_binary(const uint8_t **binary, size_t *binary_size) {
         if (!binary || !binary_size) { return status::invalid_arguments; }
-        if (pos_ >= size_) { return status::invalid_arguments; }
-        (*binary_size) = *reinterpret_cast<size_t *>(data_ + pos_);
+        if (pos_ + sizeof(*binary_size) > size_) {
+            return status::invalid_arguments;
+        }
+        std::memcpy(binary_size, data_ + pos_, sizeof(*binary_size));
         pos_ += sizeof(*binary_size);
+        if (pos_ + *binary_size > size_) { return status::invalid_arguments; }
         (*binary) = data_ + pos_;
         pos_ += *binary_size;
         return status::success;
@@ -81,6 +86,47 @@ private:
     std::shared_ptr<cache_blob_impl_t> impl_;
 };
 
+// An interface for objects that are created as a part of a primitive (e.g. CPU
+// JIT kernels) and can store their state into a cache blob.
+struct cache_blob_serializable_t {
+    virtual ~cache_blob_serializable_t() = default;
+    virtual status_t get_cache_blob_size(size_t *size) const = 0;
+    virtual status_t get_cache_blob(cache_blob_t &cache_blob) const = 0;
+    // Returns the amount of memory held by the object, e.g. the code size.
+    virtual size_t get_footprint() const { return 0; }
+};
+
+// A thread-local registry which is active during a primitive initialization.
+// It provides the cache blob to restore the objects from and collects the
+// objects that should be stored into a cache blob later. Registries can be
+// nested, e.g. when a primitive creates a nested primitive, in which case
+// only the innermost one is active.
+struct cache_blob_registry_t {
+    cache_blob_registry_t(const cache_blob_t &cache_blob);
+    ~cache_blob_registry_t();
+
+    // Returns the registry active in the current thread or nullptr.
+    static cache_blob_registry_t *get();
+
+    cache_blob_t &cache_blob() { return cache_blob_; }
+
+    void add(const cache_blob_serializable_t *object) {
+        objects_.push_back(object);
+    }
+    void remove(const cache_blob_serializable_t *object);
+
+    std::vector<const cache_blob_serializable_t *> release() {
+        return std::move(objects_);
+    }
+
+private:
+    cache_blob_t cache_blob_;
+    std::vector<const cache_blob_serializable_t *> objects_;
+    cache_blob_registry_t *prev_;
+
+    DNNL_DISALLOW_COPY_AND_ASSIGN(cache_blob_registry_t);
+};
+
 } // namespace impl
 } // namespace dnnl
 
@@ -32,19 +32,16 @@ const std::vector<uint8_t> &cache_blob_id_t::get(
     auto engine_kind = engine->kind();
     auto runtime_kind = engine->runtime_kind();
 
-    if (engine_kind != engine_kind::gpu
-            || (engine_kind == engine_kind::gpu
-                    && runtime_kind != runtime_kind::ocl)) {
-        return sstream_.get_data();
-    }
+    const bool is_ocl_gpu = engine_kind == engine_kind::gpu
+            && runtime_kind == runtime_kind::ocl;
+    const bool is_native_cpu = engine_kind == engine_kind::cpu
+            && runtime_kind != runtime_kind::sycl;
+    if (!is_ocl_gpu && !is_native_cpu) return sstream_.get_data();
 
     if (pd->op_desc()->kind == primitive_kind::zero_pad) {
         return sstream_.get_data();
     }
 
-    assert(engine->kind() == engine_kind::gpu
-            && engine->runtime_kind() == runtime_kind::ocl);
-
     const auto init_id = [&]() {
         serialization::serialize_desc(sstream_, pd->op_desc());
         serialization::serialize_attr(sstream_, *pd->attr());
@@ -25,6 +25,7 @@
 #include "bfloat16.hpp"
 #include "c_types_map.hpp"
 #include "float16.hpp"
+#include "float8.hpp"
 #include "nstl.hpp"
 #include "opdesc.hpp"
 #include "utils.hpp"
@@ -51,6 +52,14 @@ struct prec_traits<data_type::bf16> {
     typedef bfloat16_t type;
 };
 template <>
+struct prec_traits<data_type::f8_e5m2> {
+    typedef float8_e5m2_t type;
+};
+template <>
+struct prec_traits<data_type::f8_e4m3> {
+    typedef float8_e4m3_t type;
+};
+template <>
 struct prec_traits<data_type::f32> {
     typedef float type;
 };
@@ -80,6 +89,14 @@ struct data_traits<bfloat16_t> {
     static constexpr data_type_t data_type = data_type::bf16;
 };
 template <>
+struct data_traits<float8_e5m2_t> {
+    static constexpr data_type_t data_type = data_type::f8_e5m2;
+};
+template <>
+struct data_traits<float8_e4m3_t> {
+    static constexpr data_type_t data_type = data_type::f8_e4m3;
+};
+template <>
 struct data_traits<float> {
     static constexpr data_type_t data_type = data_type::f32;
 };
@@ -0,0 +1,151 @@
+/*******************************************************************************
+* Copyright 2024 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef COMMON_FLOAT8_HPP
+#define COMMON_FLOAT8_HPP
+
+#include <cmath>
+#include <cstdint>
+
+#include "bit_cast.hpp"
+#include "float16.hpp"
+
+namespace dnnl {
+namespace impl {
+
+namespace float8 {
+
+// Converts a float to an 8-bit float with `n_mant` mantissa bits and exponent
+// bias `bias`, rounding to nearest even. The magnitude of the result is not
+// checked for overflow, the callers clamp it to their largest encoding.
+inline uint32_t round_magnitude(float f, int n_mant, int bias) {
+    const float a = fabsf(f);
+    const float min_normal = std::ldexp(1.f, 1 - bias);
+    if (a < min_normal) {
+        // Adding a power of two whose ulp equals the distance between the
+        // subnormals of the target type rounds `a` to the target precision,
+        // the low bits of the sum are then the subnormal encoding. A value
+        // rounding up to the smallest normal gets its encoding as well.
+        const float magic = std::ldexp(1.f, 24 - bias - n_mant);
+        return utils::bit_cast<uint32_t>(a + magic)
+                - utils::bit_cast<uint32_t>(magic);
+    }
+    const uint32_t drop = 23 - n_mant;
+    uint32_t bits = utils::bit_cast<uint32_t>(a);
+    bits += ((1u << (drop - 1)) - 1) + ((bits >> drop) & 1);
+    return (bits >> drop) - ((uint32_t)(127 - bias) << n_mant);
+}
+
+} // namespace float8
+
+// 8-bit floating point with 5-bit exponent and 2-bit mantissa. The type
+// follows IEEE 754 rules: values beyond the largest finite value round to
+// infinity and NaNs are preserved.
+struct float8_e5m2_t {
+    uint8_t raw_bits_;
+
+    float8_e5m2_t() = default;
+    constexpr float8_e5m2_t(uint8_t r, bool) : raw_bits_(r) {}
+    float8_e5m2_t(float f) { (*this) = f; }
+
+    float8_e5m2_t &operator=(float f);
+
+    operator float() const;
+
+    float8_e5m2_t &operator+=(const float a) {
+        (*this) = float {*this} + a;
+        return *this;
+    }
+};
+
+static_assert(sizeof(float8_e5m2_t) == 1, "float8_e5m2_t must be 1 byte");
+
+inline float8_e5m2_t &float8_e5m2_t::operator=(float f) {
+    const uint32_t s = (utils::bit_cast<uint32_t>(f) >> 24) & 0x80;
+    uint32_t m;
+    if (std::isnan(f)) {
+        m = 0x7e;
+    } else if (std::isinf(f)) {
+        m = 0x7c;
+    } else {
+        m = float8::round_magnitude(f, 2, 15);
+        if (m > 0x7c) m = 0x7c;
+    }
+    raw_bits_ = (uint8_t)(s | m);
+    return *this;
+}
+
+inline float8_e5m2_t::operator float() const {
+    // The type is an f16 with the lower byte of the mantissa truncated.
+    return (float)float16_t((uint16_t)(raw_bits_ << 8), true);
+}
+
+// 8-bit floating point with 4-bit exponent and 3-bit mantissa. The type has
+// no infinities and the only NaN encodings are 0x7f and 0xff, which makes it
+// possible to represent values up to 448. Values beyond that range, including
+// infinities, saturate to the largest finite value of the same sign.
+struct float8_e4m3_t {
+    uint8_t raw_bits_;
+
+    float8_e4m3_t() = default;
+    constexpr float8_e4m3_t(uint8_t r, bool) : raw_bits_(r) {}
+    float8_e4m3_t(float f) { (*this) = f; }
+
+    float8_e4m3_t &operator=(float f);
+
+    operator float() const;
+
+    float8_e4m3_t &operator+=(const float a) {
+        (*this) = float {*this} + a;
+        return *this;
+    }
+};
+
+static_assert(sizeof(float8_e4m3_t) == 1, "float8_e4m3_t must be 1 byte");
+
+inline float8_e4m3_t &float8_e4m3_t::operator=(float f) {
+    const uint32_t s = (utils::bit_cast<uint32_t>(f) >> 24) & 0x80;
+    uint32_t m;
+    if (std::isnan(f)) {
+        m = 0x7f;
+    } else if (std::isinf(f)) {
+        m = 0x7e;
+    } else {
+        m = float8::round_magnitude(f, 3, 7);
+        if (m > 0x7e) m = 0x7e;
+    }
+    raw_bits_ = (uint8_t)(s | m);
+    return *this;
+}
+
+inline float8_e4m3_t::operator float() const {
+    const uint32_t s = (raw_bits_ & 0x80u) << 24;
+    const uint32_t e = (raw_bits_ >> 3) & 0xf;
+    const uint32_t m = raw_bits_ & 0x7;
+    if (e == 0xf && m == 0x7)
+        return utils::bit_cast<float>(s | 0x7fc00000u);
+    if (e == 0) {
+        // Subnormals are normal numbers in f32.
+        const float v = std::ldexp((float)m, -9);
+        return s ? -v : v;
+    }
+    return utils::bit_cast<float>(s | ((e - 7 + 127) << 23) | (m << 20));
+}
+
+} // namespace impl
+} // namespace dnnl
+
+#endif
@@ -109,6 +109,64 @@ inline float round_fwd(float s) {
     return mxcsr_round(s);
 }
 
+/** Philox4x32-10 counter-based generator: returns a 32-bit random value that
+ * depends on @p idx and @p seed only, so the result is the same regardless
+ * of the order in which the indices are processed. */
+inline uint32_t philox4x32(dim_t idx, uint32_t seed) {
+    const uint32_t M0 = 0xD2511F53, M1 = 0xCD9E8D57;
+    const uint32_t W0 = 0x9E3779B9, W1 = 0xBB67AE85;
+    // Each counter value produces 4 random values.
+    const uint64_t ctr_idx = static_cast<uint64_t>(idx) >> 2;
+    uint32_t ctr[4] = {static_cast<uint32_t>(ctr_idx),
+            static_cast<uint32_t>(ctr_idx >> 32), 0, 0};
+    uint32_t key[2] = {seed, ~seed};
+    for (int r = 0; r < 10; r++) {
+        const uint64_t p0 = static_cast<uint64_t>(M0) * ctr[0];
+        const uint64_t p1 = static_cast<uint64_t>(M1) * ctr[2];
+        const uint32_t hi0 = static_cast<uint32_t>(p0 >> 32);
+        const uint32_t hi1 = static_cast<uint32_t>(p1 >> 32);
+        ctr[0] = hi1 ^ ctr[1] ^ key[0];
+        ctr[1] = static_cast<uint32_t>(p1);
+        ctr[2] = hi0 ^ ctr[3] ^ key[1];
+        ctr[3] = static_cast<uint32_t>(p0);
+        key[0] += W0;
+        key[1] += W1;
+    }
+    return ctr[idx & 3];
+}
+
+/** rounds @p f stochastically to a value representable in @p dst_dt, which
+ * is bf16 or f16. The probability to round away from zero is proportional
+ * to the distance to the value truncated towards zero. The result is exact
+ * in @p dst_dt, so the conversion that follows does not round it again. */
+inline float stochastic_round_fwd(
+        float f, dim_t idx, uint32_t seed, data_type_t dst_dt) {
+    if (!std::isfinite(f)) return f;
+    const uint32_t rnd = philox4x32(idx, seed);
+    if (dst_dt == data_type::bf16) {
+        // bf16 keeps the f32 exponent, so dropping the 16 low bits of the
+        // mantissa after adding random ones is enough, subnormals included.
+        uint32_t bits = utils::bit_cast<uint32_t>(f);
+        bits += rnd >> 16;
+        return utils::bit_cast<float>(bits & 0xffff0000u);
+    }
+    if (dst_dt == data_type::f16) {
+        const float f16_min_normal = 6.103515625e-05f; // 2^-14
+        if (std::fabs(f) >= f16_min_normal) {
+            // f16 normals keep the 10 high bits of the f32 mantissa.
+            uint32_t bits = utils::bit_cast<uint32_t>(f);
+            bits += rnd >> 19;
+            return utils::bit_cast<float>(bits & 0xffffe000u);
+        }
+        // f16 subnormals are multiples of 2^-24.
+        const float two_24 = 16777216.f;
+        const float u = static_cast<float>(rnd >> 8) / two_24;
+        const float q = std::floor(std::fabs(f) * two_24 + u) / two_24;
+        return std::signbit(f) ? -q : q;
+    }
+    return f;
+}
+
 template <typename T, typename A,
         typename U = typename utils::remove_reference<T>::type>
 inline typename utils::enable_if<nstl::is_integral<U>::value, U>::type relu_fwd(
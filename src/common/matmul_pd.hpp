@@ -45,6 +45,9 @@ struct matmul_pd_t : public primitive_desc_t {
 
         if (arg == DNNL_ARG_BIAS && with_bias()) return arg_usage_t::input;
 
+        if (arg == DNNL_ARG_WEIGHTS_PAGE_TABLE && with_paged_weights())
+            return arg_usage_t::input;
+
         if (arg == DNNL_ARG_DST) return arg_usage_t::output;
 
         return primitive_desc_t::arg_usage(arg);
@@ -75,7 +78,7 @@ struct matmul_pd_t : public primitive_desc_t {
     }
 
     int n_inputs() const override {
-        return 2 + with_bias() + n_binary_po_inputs();
+        return 2 + with_bias() + with_paged_weights() + n_binary_po_inputs();
     }
     int n_outputs() const override { return 1; }
 
@@ -101,6 +104,9 @@ struct matmul_pd_t : public primitive_desc_t {
     }
 
     bool with_bias() const { return bias_md_.ndims != 0; }
+    bool with_paged_weights() const {
+        return !attr()->weights_paging_params_.has_default_values();
+    }
     bool batched() const { return ndims() > 2; }
 
     dim_t batch() const {
@@ -135,6 +141,14 @@ struct matmul_pd_t : public primitive_desc_t {
         return ok;
     }
 
+    // The pages of the weights are located with the plain strides, so the
+    // paged weights must have a plain layout known at creation time.
+    bool paged_weights_ok() const {
+        if (!with_paged_weights()) return true;
+        const memory_desc_wrapper wei_d(weights_md_);
+        return wei_d.is_plain() && !wei_d.has_runtime_dims_or_strides();
+    }
+
 protected:
     matmul_desc_t desc_;
 
@@ -152,8 +166,18 @@ protected:
         , bias_md_(desc_.bias_desc)
         , dst_md_(desc_.dst_desc) {}
 
+    // Returns true if none of the tensors uses a sparse encoding.
+    bool is_dense_data() const {
+        for (auto md : {&src_md_, &weights_md_, &dst_md_})
+            if (memory_desc_wrapper(md).is_sparse_desc()) return false;
+        return true;
+    }
+
     // temporary solution to deal with format `any`
+    // Sparse tensors are supported only by dedicated implementations, which
+    // don't rely on this function, so the dense ones reject them here.
     bool set_default_formats() {
+        if (!is_dense_data()) return false;
         for (auto md : {&src_md_, &weights_md_, &bias_md_, &dst_md_}) {
             memory_desc_wrapper mdw(md);
             if (mdw.format_any()) {
@@ -225,7 +225,8 @@ struct memory_desc_wrapper : public c_compatible {
                 max_size = utils::array_product(bd.inner_blks, bd.inner_nblks);
             }
 
-            size_t data_size = max_size * data_type_size();
+            size_t data_size = utils::div_up(max_size * data_type_size(),
+                    types::sub_byte_data_type_multiplier(data_type()));
             if (is_additional_buffer()) {
                 // The additional buffers, typically of data type int32_t, float
                 // are stored at the end of data. Pad the data, so that the
@@ -283,7 +284,9 @@ struct memory_desc_wrapper : public c_compatible {
         if (utils::one_of(format_kind(), format_kind::undef, format_kind::any))
             return false;
         if (has_runtime_dims_or_strides() || has_broadcast()) return false;
-        return nelems(with_padding) * data_type_size() == size();
+        return utils::div_up(nelems(with_padding) * data_type_size(),
+                       types::sub_byte_data_type_multiplier(data_type()))
+                == size();
     }
 
     /** returns true if format is set to `any` */
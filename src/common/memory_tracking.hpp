@@ -163,9 +163,15 @@ enum {
     key_brgemm_primitive_buffer,
     key_brgemm_primitive_buffer_a,
     key_brgemm_primitive_buffer_b,
+    key_brgemm_primitive_buffer_b_mask,
+    key_brgemm_primitive_wei_decomp_scales,
+    key_brgemm_primitive_wei_decomp_zero_points,
+    key_brgemm_primitive_src_dyn_quant_scales,
     key_brgemm_primitive_buffer_comp,
     key_brgemm_primitive_zp_comp_a,
     key_brgemm_primitive_zp_comp_b,
+    key_brgemm_primitive_wei_zp_values,
+    key_brgemm_primitive_dst_amax,
     key_concat_iptrs,
     key_concat_istrides,
     key_concat_nelems,
@@ -214,6 +220,7 @@ enum {
     key_deconv_sum,
     key_deconv_zp,
     key_eltwise_diff_dst,
+    key_eltwise_dst_amax,
     key_eltwise_src,
     key_fusion_forward_scratchpad,
     key_fusion_inout_buffer,
@@ -28,6 +28,7 @@
 
 #include "bfloat16.hpp"
 #include "float16.hpp"
+#include "float8.hpp"
 #include "internal_defs.hpp"
 #include "z_magic.hpp"
 
@@ -174,6 +175,36 @@ struct numeric_limits<float16_t> {
     }
 };
 
+template <>
+struct numeric_limits<float8_e5m2_t> {
+    static constexpr float8_e5m2_t lowest() {
+        return float8_e5m2_t(0xfb, true);
+    }
+
+    static constexpr float8_e5m2_t max() { return float8_e5m2_t(0x7b, true); }
+
+    static constexpr int digits = 3;
+
+    static constexpr float8_e5m2_t epsilon() {
+        return float8_e5m2_t(((0x0f - (digits - 1)) << (digits - 1)), true);
+    }
+};
+
+template <>
+struct numeric_limits<float8_e4m3_t> {
+    static constexpr float8_e4m3_t lowest() {
+        return float8_e4m3_t(0xfe, true);
+    }
+
+    static constexpr float8_e4m3_t max() { return float8_e4m3_t(0x7e, true); }
+
+    static constexpr int digits = 4;
+
+    static constexpr float8_e4m3_t epsilon() {
+        return float8_e4m3_t(((0x07 - (digits - 1)) << (digits - 1)), true);
+    }
+};
+
 template <typename T>
 struct is_integral {
     static constexpr bool value = false;
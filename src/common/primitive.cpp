@@ -14,6 +14,7 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <cstring>
 #include <string>
 
 #include <assert.h>
@@ -30,6 +31,7 @@
 #include "primitive_exec_types.hpp"
 #include "reorder_pd.hpp"
 #include "scratchpad_debug.hpp"
+#include "serialization_stream.hpp"
 #include "stack_checker.hpp"
 #include "stream.hpp"
 #include "utils.hpp"
@@ -41,6 +43,86 @@ using namespace dnnl::impl::primitive_kind;
 namespace dnnl {
 namespace impl {
 
+status_t primitive_t::init(engine_t *engine, bool use_global_scratchpad,
+        const cache_blob_t &cache_blob) {
+    cache_blob_ = cache_blob;
+    if (cache_blob_ && engine->kind() == engine_kind::cpu)
+        CHECK(validate_cache_blob_device(engine));
+    {
+        // Objects created during initialization (e.g. CPU JIT kernels) are
+        // restored from the `cache_blob_` and are registered to be stored
+        // into a cache blob upon a request.
+        cache_blob_registry_t registry(cache_blob_);
+        CHECK(init(engine));
+        cache_blob_objects_ = registry.release();
+    }
+    use_global_scratchpad_ = use_global_scratchpad;
+    // The `cache_blob_` is no longer needed after primitive creation.
+    cache_blob_ = cache_blob_t();
+    return status::success;
+}
+
+size_t primitive_t::get_footprint() const {
+    return sizeof(primitive_t) + sizeof(primitive_desc_t)
+            + get_jit_code_size();
+}
+
+size_t primitive_t::get_jit_code_size() const {
+    size_t size = 0;
+    for (const auto *object : cache_blob_objects_)
+        size += object->get_footprint();
+    return size;
+}
+
+status_t primitive_t::get_cache_blob_size(
+        engine_t *engine, size_t *size) const {
+    if (engine->kind() != engine_kind::cpu) {
+        assert(!"unexpected");
+        return status::runtime_error;
+    }
+    if (!size) return status::invalid_arguments;
+
+    serialization_stream_t sstream;
+    CHECK(engine->serialize_device(sstream));
+    // We need additional sizeof(size_t) bytes to store the size of the
+    // device signature when packing.
+    (*size) += sstream.get_data().size() + sizeof(size_t);
+    for (const auto *object : cache_blob_objects_)
+        CHECK(object->get_cache_blob_size(size));
+    return status::success;
+}
+
+status_t primitive_t::get_cache_blob(
+        engine_t *engine, cache_blob_t &cache_blob) const {
+    if (engine->kind() != engine_kind::cpu) {
+        assert(!"unexpected");
+        return status::runtime_error;
+    }
+
+    serialization_stream_t sstream;
+    CHECK(engine->serialize_device(sstream));
+    const auto &device = sstream.get_data();
+    CHECK(cache_blob.add_binary(device.data(), device.size()));
+    for (const auto *object : cache_blob_objects_)
+        CHECK(object->get_cache_blob(cache_blob));
+    return status::success;
+}
+
+status_t primitive_t::validate_cache_blob_device(engine_t *engine) {
+    serialization_stream_t sstream;
+    CHECK(engine->serialize_device(sstream));
+    const auto &device = sstream.get_data();
+
+    const uint8_t *blob_device = nullptr;
+    size_t blob_device_size = 0;
+    CHECK(cache_blob_.get_binary(&blob_device, &blob_device_size));
+    // A blob created on a different CPU or with a different ISA is rejected.
+    if (blob_device_size != device.size()
+            || std::memcmp(blob_device, device.data(), device.size()) != 0)
+        return status::invalid_arguments;
+    return status::success;
+}
+
 nested_scratchpad_t::nested_scratchpad_t(const exec_ctx_t &master_ctx, int key,
         const std::shared_ptr<primitive_t> &nested_p) {
     auto scratchpad = master_ctx.get_scratchpad_grantor();
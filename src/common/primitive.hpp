@@ -48,35 +48,37 @@ struct primitive_t : public c_compatible {
     virtual status_t init(engine_t *engine) { return status::success; }
 
     status_t init(engine_t *engine, bool use_global_scratchpad,
-            const cache_blob_t &cache_blob) {
-        cache_blob_ = cache_blob;
-        CHECK(init(engine));
-        use_global_scratchpad_ = use_global_scratchpad;
-        // The `cache_blob_` is no longer needed after primitive creation.
-        cache_blob_ = cache_blob_t();
-        return status::success;
-    }
+            const cache_blob_t &cache_blob);
 
     const std::shared_ptr<primitive_desc_t> &pd() const { return pd_; }
     primitive_kind_t kind() const { return pd_->kind(); }
     virtual status_t execute(const exec_ctx_t &ctx) const = 0;
 
+    // The default implementation stores the registered objects (CPU JIT
+    // kernels) prepended with the device signature.
     virtual status_t get_cache_blob(
-            engine_t *engine, cache_blob_t &cache_blob) const {
-        assert(!"unexpected");
-        return status::runtime_error;
-    }
-
-    virtual status_t get_cache_blob_size(engine_t *engine, size_t *size) const {
-        assert(!"unexpected");
-        return status::runtime_error;
-    }
+            engine_t *engine, cache_blob_t &cache_blob) const;
+    virtual status_t get_cache_blob_size(engine_t *engine, size_t *size) const;
 
     virtual status_t create_resource(
             engine_t *engine, resource_mapper_t &mapper) const {
         return status::success;
     }
 
+    // Returns an estimate of memory held by the primitive while it is stored
+    // in the primitive cache: the code of the JIT kernels created during the
+    // initialization and the primitive objects themselves.
+    size_t get_footprint() const;
+    // Returns the size of the code of the JIT kernels created during the
+    // initialization.
+    size_t get_jit_code_size() const;
+    // Returns the JIT kernels created during the initialization. The kernels
+    // may be shared with other primitives.
+    const std::vector<const cache_blob_serializable_t *> &
+    get_cache_blob_objects() const {
+        return cache_blob_objects_;
+    }
+
     bool use_global_scratchpad() const { return use_global_scratchpad_; }
     cache_blob_t cache_blob() const { return cache_blob_; }
 
@@ -108,11 +110,13 @@ protected:
             // created by another thread.
             p = p_future.get().primitive;
             if (!p) return p_future.get().status;
+            primitive_cache_stats().add_hit(pd->kind());
         } else {
             // The requested primitive is NOT present in the cache therefore
             // we have to create it and notify the waiting threads
             // once the creation is done.
             p = std::make_shared<impl_type>(pd);
+            const double start_ms = get_msec();
             status = p->init(engine, use_global_scratchpad, cache_blob);
             if (status != status::success) {
                 // Communicate an error.
@@ -123,6 +127,8 @@ protected:
                 global_primitive_cache.remove_if_invalidated(key);
                 return status;
             } else {
+                primitive_cache_stats().add_miss(pd->kind(),
+                        get_msec() - start_ms, p->get_jit_code_size());
                 // Store the created primitive in the shared future and notify
                 // the waiting threads.
                 p_promise.set_value({p, status});
@@ -146,8 +152,12 @@ protected:
     std::shared_ptr<primitive_desc_t> pd_;
     bool use_global_scratchpad_;
     cache_blob_t cache_blob_;
+    std::vector<const cache_blob_serializable_t *> cache_blob_objects_;
 
 private:
+    // Checks that the cache blob was created for the same device.
+    status_t validate_cache_blob_device(engine_t *engine);
+
     primitive_t() = delete;
     DNNL_DISALLOW_COPY_AND_ASSIGN(primitive_t);
 };
@@ -177,6 +187,11 @@ private:
 #define CTX_IN_MEM(type, arg) \
     static_cast<const ARG_TYPE(type) *>(ctx.host_ptr(arg))
 
+// Returns the `idx`-th buffer of a memory with several buffers, e.g. the
+// values, indices or pointers of a sparse memory.
+#define CTX_IN_SPARSE_MEM(type, arg, idx) \
+    static_cast<const ARG_TYPE(type) *>(ctx.host_ptr(arg, false, nullptr, idx))
+
 // Returns destination memory which may not have been zero pad initialized.
 #define CTX_OUT_MEM(type, arg) static_cast<ARG_TYPE(type) *>(ctx.host_ptr(arg))
 
@@ -93,6 +93,21 @@ status_t zero_points_t::set(int arg, int mask) {
     return status::success;
 }
 
+status_t zero_points_t::set(int arg, int mask, int ndims,
+        const dims_t group_dims, data_type_t data_type) {
+    if (ndims < 0 || ndims > DNNL_MAX_NDIMS) return status::invalid_arguments;
+    const bool is_default = ndims == 0 && data_type == data_type::s32;
+    if (arg != DNNL_ARG_WEIGHTS && !is_default) return status::unimplemented;
+
+    CHECK(set(arg, mask));
+    if (arg == DNNL_ARG_WEIGHTS) {
+        data_type_wei = data_type;
+        group_ndims_wei = ndims;
+        if (ndims > 0) utils::array_copy(group_dims_wei, group_dims, ndims);
+    }
+    return status::success;
+}
+
 } // namespace impl
 } // namespace dnnl
 
@@ -121,6 +136,19 @@ bool primitive_attr_t::has_default_values(dnnl_primitive_attr::skip_mask_t mask,
     CHECK_MASK(smask_t::rnn_weights_qparams, rnn_weights_qparams_);
     CHECK_MASK(smask_t::rnn_weights_projection_qparams,
             rnn_weights_projection_qparams_);
+    CHECK_MASK(smask_t::src_dyn_quant_params, src_dyn_quant_params_);
+    CHECK_MASK(smask_t::weights_paging_params, weights_paging_params_);
+    CHECK_MASK(smask_t::rounding_mode, rounding_mode_);
+    CHECK_MASK(smask_t::dst_amax_params, dst_amax_params_);
+    CHECK_ARG(IMPLICATION((bool)(~mask & smask_t::scales_runtime_groups),
+            scales_.has_default_groups()));
+    CHECK_ARG(IMPLICATION((bool)(~mask & smask_t::scales_runtime_data_type),
+            scales_.has_default_data_type()));
+    CHECK_ARG(IMPLICATION((bool)(~mask & smask_t::zero_points_runtime_groups),
+            zero_points_.has_default_groups()));
+    CHECK_ARG(
+            IMPLICATION((bool)(~mask & smask_t::zero_points_runtime_data_type),
+                    zero_points_.has_default_data_type()));
     CHECK_ARG(IMPLICATION((bool)(~mask & smask_t::sum_dt),
             post_ops_.sum_with_default_dt(dst_dt)));
     bool gpu_attr_ok = IMPLICATION((bool)(~mask & smask_t::gpu_attr),
@@ -426,6 +454,90 @@ status_t dnnl_primitive_attr_set_zero_points_mask(
     return attr->zero_points_.set(arg, mask);
 }
 
+status_t dnnl_primitive_attr_set_scales(primitive_attr_t *attr, int arg,
+        int mask, int ndims, const dims_t group_dims, data_type_t data_type) {
+    bool ok = attr && mask >= 0 && arg >= 0 && ndims >= 0
+            && IMPLICATION(ndims > 0, group_dims != nullptr)
+            && utils::one_of(data_type, data_type::f32,
+                    data_type::bf16, data_type::f16)
+            && attr->output_scales_.has_default_values();
+    if (!ok) return invalid_arguments;
+    for (int d = 0; d < ndims; d++)
+        if (group_dims[d] <= 0) return invalid_arguments;
+    return attr->scales_.set(arg, mask, ndims, group_dims, data_type);
+}
+
+status_t dnnl_primitive_attr_set_zero_points(primitive_attr_t *attr, int arg,
+        int mask, int ndims, const dims_t group_dims, data_type_t data_type) {
+    bool ok = attr && mask >= 0 && ndims >= 0
+            && IMPLICATION(ndims > 0, group_dims != nullptr)
+            && utils::one_of(data_type, data_type::s32,
+                    data_type::s8, data_type::u8, data_type::s4, data_type::u4);
+    if (!ok) return invalid_arguments;
+    for (int d = 0; d < ndims; d++)
+        if (group_dims[d] <= 0) return invalid_arguments;
+    return attr->zero_points_.set(arg, mask, ndims, group_dims, data_type);
+}
+
+status_t dnnl_primitive_attr_set_src_dyn_quant_params(
+        primitive_attr_t *attr, data_type_t data_type) {
+    bool ok = attr
+            && utils::one_of(data_type, data_type::undef, data_type::s8);
+    if (!ok) return invalid_arguments;
+    return attr->src_dyn_quant_params_.set(data_type);
+}
+
+status_t dnnl_primitive_attr_get_src_dyn_quant_params(
+        const primitive_attr_t *attr, data_type_t *data_type) {
+    if (any_null(attr, data_type)) return invalid_arguments;
+    *data_type = attr->src_dyn_quant_params_.data_type_;
+    return success;
+}
+
+status_t dnnl_primitive_attr_set_weights_page_size(
+        primitive_attr_t *attr, dim_t page_size) {
+    bool ok = attr && page_size >= 0 && !is_runtime_value(page_size);
+    if (!ok) return invalid_arguments;
+    return attr->weights_paging_params_.set(page_size);
+}
+
+status_t dnnl_primitive_attr_get_weights_page_size(
+        const primitive_attr_t *attr, dim_t *page_size) {
+    if (any_null(attr, page_size)) return invalid_arguments;
+    *page_size = attr->weights_paging_params_.page_size_;
+    return success;
+}
+
+status_t dnnl_primitive_attr_set_rounding(
+        primitive_attr_t *attr, int arg, rounding_mode_t mode) {
+    bool ok = attr
+            && utils::one_of(mode, rounding_mode::environment,
+                    rounding_mode::stochastic)
+            && arg >= 0 && arg != DNNL_ARG_ATTR_ROUNDING_SEED;
+    if (!ok) return invalid_arguments;
+    return attr->rounding_mode_.set(arg, mode);
+}
+
+status_t dnnl_primitive_attr_get_rounding(
+        const primitive_attr_t *attr, int arg, rounding_mode_t *mode) {
+    if (any_null(attr, mode)) return invalid_arguments;
+    *mode = attr->rounding_mode_.get(arg);
+    return success;
+}
+
+status_t dnnl_primitive_attr_set_dst_amax(
+        primitive_attr_t *attr, int dst_amax) {
+    if (attr == nullptr) return invalid_arguments;
+    return attr->dst_amax_params_.set(dst_amax != 0);
+}
+
+status_t dnnl_primitive_attr_get_dst_amax(
+        const primitive_attr_t *attr, int *dst_amax) {
+    if (any_null(attr, dst_amax)) return invalid_arguments;
+    *dst_amax = attr->dst_amax_params_.enabled_;
+    return success;
+}
+
 status_t dnnl_primitive_attr_get_post_ops(
         const primitive_attr_t *attr, const post_ops_t **post_ops) {
     if (any_null(attr, post_ops)) return invalid_arguments;
@@ -55,6 +55,113 @@ struct rnn_data_qparams_t : public c_compatible {
     float shift_;
 };
 
+// Parameters of the source quantization computed by a primitive at execution.
+// The source is quantized to `data_type_` with a dedicated scale for each row,
+// which is derived from the maximum absolute value of the row.
+struct src_dyn_quant_params_t : public c_compatible {
+    src_dyn_quant_params_t() = default;
+
+    bool has_default_values() const {
+        return data_type_ == data_type::undef;
+    }
+    bool defined() const { return true; }
+
+    status_t set(data_type_t data_type) {
+        data_type_ = data_type;
+        return status::success;
+    }
+
+    bool operator==(const src_dyn_quant_params_t &rhs) const {
+        return data_type_ == rhs.data_type_;
+    }
+
+    data_type_t data_type_ = data_type::undef;
+};
+
+// Parameters of the weights stored in pages. The weights are split into pages
+// of `page_size_` consecutive indices along the outermost of the two last
+// dimensions, and a page table passed at execution maps the logical pages to
+// the physical ones.
+struct weights_paging_params_t : public c_compatible {
+    weights_paging_params_t() = default;
+
+    bool has_default_values() const { return page_size_ == 0; }
+    bool defined() const { return true; }
+
+    status_t set(dim_t page_size) {
+        page_size_ = page_size;
+        return status::success;
+    }
+
+    bool operator==(const weights_paging_params_t &rhs) const {
+        return page_size_ == rhs.page_size_;
+    }
+
+    dim_t page_size_ = 0;
+};
+
+// Computation of the maximum absolute value of the destination, which the
+// primitive writes to the DNNL_ARG_DST_AMAX argument at execution.
+struct dst_amax_params_t : public c_compatible {
+    dst_amax_params_t() = default;
+
+    bool has_default_values() const { return !enabled_; }
+    bool defined() const { return true; }
+
+    status_t set(bool enabled) {
+        enabled_ = enabled;
+        return status::success;
+    }
+
+    bool operator==(const dst_amax_params_t &rhs) const {
+        return enabled_ == rhs.enabled_;
+    }
+
+    bool enabled_ = false;
+};
+
+// Rounding modes of the down-conversions to the data types of the arguments.
+// The arguments not present in the map use the environment rounding mode.
+struct rnd_mode_t : public c_compatible {
+    rnd_mode_t() = default;
+
+    bool has_default_values() const { return rounding_modes_map_.empty(); }
+    bool defined() const { return true; }
+
+    status_t set(int arg, dnnl::impl::rounding_mode_t rm) {
+        if (rm == rounding_mode::environment)
+            rounding_modes_map_.erase(arg);
+        else
+            rounding_modes_map_[arg] = rm;
+        return status::success;
+    }
+
+    dnnl::impl::rounding_mode_t get(int arg) const {
+        const auto it = rounding_modes_map_.find(arg);
+        if (it == rounding_modes_map_.end()) return rounding_mode::environment;
+        return it->second;
+    }
+
+    bool is_stochastic(int arg) const {
+        return get(arg) == rounding_mode::stochastic;
+    }
+
+    // Returns true if no argument but @p arg uses the stochastic rounding and
+    // the data type @p dt of @p arg supports it.
+    bool stochastic_ok(int arg, data_type_t dt) const {
+        for (const auto &p : rounding_modes_map_)
+            if (p.first != arg) return false;
+        return IMPLICATION(is_stochastic(arg),
+                utils::one_of(dt, data_type::bf16, data_type::f16));
+    }
+
+    bool operator==(const rnd_mode_t &rhs) const {
+        return rounding_modes_map_ == rhs.rounding_modes_map_;
+    }
+
+    std::map<int, dnnl::impl::rounding_mode_t> rounding_modes_map_;
+};
+
 struct rnn_tparams_t : public c_compatible {
     rnn_tparams_t()
         : test_mode_(false), scales_(nullptr), ngates_(0), cscale_(0.0f) {}
@@ -184,29 +291,51 @@ struct runtime_scales_t : public c_compatible {
     // runtime_scales_t() = default;
     runtime_scales_t() {}
 
-    status_t set(int mask) {
+    status_t set(int mask) { return set(0, mask, nullptr, data_type::f32); }
+
+    status_t set(int ndims, int mask, const dims_t group_dims,
+            data_type_t data_type) {
+        if (ndims < 0 || ndims > DNNL_MAX_NDIMS)
+            return status::invalid_arguments;
         mask_ = mask;
         is_set_ = true;
+        ndims_ = ndims;
+        if (ndims > 0) utils::array_copy(group_dims_, group_dims, ndims);
+        data_type_ = data_type;
         return status::success;
     }
 
     bool operator==(const runtime_scales_t &rhs) const {
-        return mask_ == rhs.mask_ && is_set_ == rhs.is_set_;
+        return mask_ == rhs.mask_ && is_set_ == rhs.is_set_
+                && ndims_ == rhs.ndims_
+                && IMPLICATION(ndims_ > 0,
+                        utils::array_cmp(group_dims_, rhs.group_dims_, ndims_))
+                && data_type_ == rhs.data_type_;
     }
 
     bool has_default_values() const { return !is_set_; }
+    bool has_default_groups() const { return ndims_ == 0; }
+    bool has_default_data_type() const { return data_type_ == data_type::f32; }
 
     bool defined() const { return has_default_values(); }
 
     void reset() {
         mask_ = 0;
         is_set_ = false;
+        ndims_ = 0;
+        data_type_ = data_type::f32;
     }
 
     // TODO: replace with `-1` to remove `is_set_`.
     // Hide `mask_` under `private:` to force interface usage.
     int mask_ = 0;
     bool is_set_ = false;
+    // Groups of elements sharing a scaling factor along the dimensions
+    // selected by `mask_`, e.g. {32, 1} for groups of 32 values along K of
+    // matmul weights. `ndims_ == 0` means no grouping.
+    int ndims_ = 0;
+    dims_t group_dims_ = {};
+    data_type_t data_type_ = data_type::f32;
 };
 
 struct arg_scales_t : public c_compatible {
@@ -244,6 +373,12 @@ struct arg_scales_t : public c_compatible {
         return scales_[arg].set(mask);
     }
 
+    status_t set(int arg, int mask, int ndims, const dims_t group_dims,
+            data_type_t data_type) {
+        if (!check_arg(arg)) return status::invalid_arguments;
+        return scales_[arg].set(ndims, mask, group_dims, data_type);
+    }
+
     status_t get(int arg, int *mask, bool *is_set) const {
         if (!check_arg(arg)) return status::invalid_arguments;
         const auto &s = get(arg);
@@ -259,6 +394,18 @@ struct arg_scales_t : public c_compatible {
         return status::success;
     }
 
+    bool has_default_groups() const {
+        for (const auto &s : scales_)
+            if (!s.second.has_default_groups()) return false;
+        return true;
+    }
+
+    bool has_default_data_type() const {
+        for (const auto &s : scales_)
+            if (!s.second.has_default_data_type()) return false;
+        return true;
+    }
+
     bool defined() const { return has_default_values(); }
 
     status_t copy_from(const arg_scales_t &other) {
@@ -267,11 +414,13 @@ struct arg_scales_t : public c_compatible {
             // new object.
             if (scales_.count(it->first) == 1) {
                 auto &entry = scales_[it->first];
-                bool exists = entry.mask_ == it->second.mask_;
+                bool exists = entry == it->second;
                 if (exists) continue;
             }
 
-            CHECK(set(it->first, it->second.mask_));
+            const auto &e = it->second;
+            CHECK(set(it->first, e.mask_, e.ndims_, e.group_dims_,
+                    e.data_type_));
         }
         return status::success;
     }
@@ -302,7 +451,12 @@ struct zero_points_t : public c_compatible {
     bool operator==(const zero_points_t &rhs) const {
         return mask_src == rhs.mask_src && mask_wei == rhs.mask_wei
                 && mask_dst == rhs.mask_dst && is_set_src == rhs.is_set_src
-                && is_set_wei == rhs.is_set_wei && is_set_dst == rhs.is_set_dst;
+                && is_set_wei == rhs.is_set_wei && is_set_dst == rhs.is_set_dst
+                && data_type_wei == rhs.data_type_wei
+                && group_ndims_wei == rhs.group_ndims_wei
+                && IMPLICATION(group_ndims_wei > 0,
+                        utils::array_cmp(group_dims_wei, rhs.group_dims_wei,
+                                group_ndims_wei));
     }
 
     // arg-specific checks
@@ -317,14 +471,35 @@ struct zero_points_t : public c_compatible {
         return check_all(&zero_points_t::has_default_values);
     }
 
+    // Only the weights zero points may have groups and a data type other
+    // than s32.
+    bool has_default_groups() const { return group_ndims_wei == 0; }
+    bool has_default_data_type() const {
+        return data_type_wei == data_type::s32;
+    }
+
     status_t get(int arg, int *mask) const;
+    data_type_t get_data_type(int arg) const {
+        return arg == DNNL_ARG_WEIGHTS ? data_type_wei : data_type::s32;
+    }
+    int get_groups_ndims(int arg) const {
+        return arg == DNNL_ARG_WEIGHTS ? group_ndims_wei : 0;
+    }
+    const dim_t *get_groups(int arg) const {
+        return arg == DNNL_ARG_WEIGHTS ? group_dims_wei : nullptr;
+    }
 
     status_t set(int arg, int mask);
     status_t set(int arg) { return set(arg, 0); }
+    status_t set(int arg, int mask, int ndims, const dims_t group_dims,
+            data_type_t data_type);
 
 private:
     bool is_set_src = false, is_set_wei = false, is_set_dst = false;
     int mask_src = 0, mask_wei = 0, mask_dst = 0;
+    data_type_t data_type_wei = data_type::s32;
+    int group_ndims_wei = 0;
+    dims_t group_dims_wei = {};
 
     int get_mask(int arg) const {
         int mask = 0;
@@ -637,6 +812,10 @@ struct dnnl_primitive_attr : public dnnl::impl::c_compatible {
         fpmath_mode_ = other.fpmath_mode_;
         post_ops_.copy_from(other.post_ops_);
         rnn_data_qparams_ = other.rnn_data_qparams_;
+        src_dyn_quant_params_ = other.src_dyn_quant_params_;
+        weights_paging_params_ = other.weights_paging_params_;
+        rounding_mode_ = other.rounding_mode_;
+        dst_amax_params_ = other.dst_amax_params_;
         CHECK(rnn_weights_qparams_.copy_from(other.rnn_weights_qparams_));
         CHECK(rnn_weights_projection_qparams_.copy_from(
                 other.rnn_weights_projection_qparams_));
@@ -662,7 +841,16 @@ struct dnnl_primitive_attr : public dnnl::impl::c_compatible {
         rnn_tparams = 1u << 9,
         sum_dt = 1u << 10,
         rnn_weights_projection_qparams = 1u << 11,
-        gpu_attr = 1u << 12
+        gpu_attr = 1u << 12,
+        scales_runtime_groups = (unsigned)scales_runtime | (1u << 13),
+        scales_runtime_data_type = (unsigned)scales_runtime | (1u << 14),
+        zero_points_runtime_groups = (unsigned)zero_points_runtime | (1u << 15),
+        zero_points_runtime_data_type
+        = (unsigned)zero_points_runtime | (1u << 16),
+        src_dyn_quant_params = 1u << 17,
+        weights_paging_params = 1u << 18,
+        rounding_mode = 1u << 19,
+        dst_amax_params = 1u << 20,
     };
 
     /** Returns true if the attributes have default values.
@@ -685,6 +873,10 @@ struct dnnl_primitive_attr : public dnnl::impl::c_compatible {
                 && rnn_weights_projection_qparams_
                         == rhs.rnn_weights_projection_qparams_
                 && rnn_tparams_ == rhs.rnn_tparams_
+                && src_dyn_quant_params_ == rhs.src_dyn_quant_params_
+                && weights_paging_params_ == rhs.weights_paging_params_
+                && rounding_mode_ == rhs.rounding_mode_
+                && dst_amax_params_ == rhs.dst_amax_params_
                 && ((gpu_attr_ && rhs.gpu_attr_
                             && gpu_attr_->is_equal(*rhs.gpu_attr_))
                         || (!gpu_attr_ && !rhs.gpu_attr_));
@@ -733,6 +925,10 @@ struct dnnl_primitive_attr : public dnnl::impl::c_compatible {
     dnnl::impl::scales_t rnn_weights_qparams_;
     dnnl::impl::scales_t rnn_weights_projection_qparams_;
     dnnl::impl::rnn_tparams_t rnn_tparams_;
+    dnnl::impl::src_dyn_quant_params_t src_dyn_quant_params_;
+    dnnl::impl::weights_paging_params_t weights_paging_params_;
+    dnnl::impl::rnd_mode_t rounding_mode_;
+    dnnl::impl::dst_amax_params_t dst_amax_params_;
 
     std::unique_ptr<dnnl::impl::primitive_attr_item_t> gpu_attr_;
 
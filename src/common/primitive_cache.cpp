@@ -14,6 +14,8 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include "oneapi/dnnl/dnnl_debug.h"
+
 #include "primitive_cache.hpp"
 #include "c_types_map.hpp"
 #include "primitive.hpp"
@@ -29,7 +31,11 @@
 #endif
 
 #include <algorithm>
+#include <cstdlib>
+#include <limits>
+#include <string>
 #include <unordered_map>
+#include <unordered_set>
 
 #ifdef _WIN32
 #include <windows.h>
@@ -48,6 +54,30 @@ size_t get_timestamp() {
 #endif
 }
 
+// Parses the memory limit in bytes. The value may have a `K`, `M` or `G`
+// suffix, e.g. `512M`. Returns 0, i.e. no limit, if the value is invalid.
+size_t get_memory_limit_from_env() {
+    const std::string value
+            = getenv_string_user("PRIMITIVE_CACHE_MEMORY_LIMIT");
+    if (value.empty()) return 0;
+
+    char *end = nullptr;
+    const unsigned long long limit = std::strtoull(value.c_str(), &end, 10);
+    if (end == value.c_str() || value[0] == '-') return 0;
+
+    size_t scale = 1;
+    switch (*end) {
+        case '\0': break;
+        case 'k': scale = 1024; break;
+        case 'm': scale = 1024 * 1024; break;
+        case 'g': scale = 1024 * 1024 * 1024; break;
+        default: return 0;
+    }
+    if (*end != '\0' && *(end + 1) != '\0') return 0;
+    if (limit > std::numeric_limits<size_t>::max() / scale) return 0;
+    return (size_t)limit * scale;
+}
+
 } // namespace
 
 primitive_cache_t &primitive_cache() {
@@ -57,10 +87,65 @@ primitive_cache_t &primitive_cache() {
 #else
     static const int capacity = 0;
 #endif
-    static lru_primitive_cache_t cache(capacity);
+    static const size_t memory_limit = get_memory_limit_from_env();
+    static lru_primitive_cache_t cache(capacity, memory_limit);
     return cache;
 }
 
+primitive_cache_stats_t &primitive_cache_stats() {
+    static primitive_cache_stats_t stats;
+    return stats;
+}
+
+constexpr int primitive_cache_stats_t::nkinds_;
+
+dnnl_primitive_cache_stats_t primitive_cache_stats_t::get(
+        primitive_kind_t kind) const {
+    dnnl_primitive_cache_stats_t stats {};
+    for (int i = 0; i < nkinds_; i++) {
+        if (kind != primitive_kind::undefined && i != kind_index(kind))
+            continue;
+        const auto &c = counters_[i];
+        stats.hits += c.hits.load(std::memory_order_relaxed);
+        stats.misses += c.misses.load(std::memory_order_relaxed);
+        stats.evictions += c.evictions.load(std::memory_order_relaxed);
+        stats.creation_ms
+                += 1e-3 * c.creation_us.load(std::memory_order_relaxed);
+        stats.jit_code_size += c.jit_code_size.load(std::memory_order_relaxed);
+    }
+    return stats;
+}
+
+void primitive_cache_stats_t::reset() {
+    for (auto &c : counters_) {
+        c.hits = 0;
+        c.misses = 0;
+        c.evictions = 0;
+        c.creation_us = 0;
+        c.jit_code_size = 0;
+    }
+}
+
+void primitive_cache_stats_t::dump() const {
+    printf("onednn_verbose,info,primitive_cache,stats,kind,hits,misses,"
+           "evictions,creation_ms,jit_code_size\n");
+    for (int i = 0; i < nkinds_; i++) {
+        const auto &c = counters_[i];
+        if (c.hits == 0 && c.misses == 0 && c.evictions == 0) continue;
+        const char *kind_str = i == nkinds_ - 1
+                ? "internal"
+                : dnnl_prim_kind2str((primitive_kind_t)i);
+        printf("onednn_verbose,info,primitive_cache,stats,%s,%llu,%llu,%llu,"
+               "%g,%llu\n",
+                kind_str, (unsigned long long)c.hits.load(),
+                (unsigned long long)c.misses.load(),
+                (unsigned long long)c.evictions.load(),
+                1e-3 * c.creation_us.load(),
+                (unsigned long long)c.jit_code_size.load());
+    }
+    fflush(stdout);
+}
+
 // Undocumented API, for testing only
 status_t get_primitive_cache_size(int *size) {
     if (size == nullptr) return dnnl::impl::status::invalid_arguments;
@@ -89,90 +174,157 @@ size_t set_primitive_cache_capacity_without_clearing(size_t capacity) {
     return old_capacity;
 }
 
+constexpr int lru_primitive_cache_t::nshards_;
+
+lru_primitive_cache_t::lru_primitive_cache_t(int capacity, size_t memory_limit)
+    : capacity_(capacity)
+    , size_(0)
+    , memory_limit_(memory_limit)
+    , footprint_(0) {}
+
 status_t lru_primitive_cache_t::set_capacity(int capacity) {
-    utils::lock_write_t lock_w(rw_mutex());
+    // Shards are always locked in the same order to avoid deadlocks.
+    for (auto &shard : shards_)
+        shard.mutex_.lock_write();
     capacity_ = (size_t)capacity;
     // Check if number of entries exceeds the new capacity
-    if (cache_mapper().size() > capacity_) {
+    if (size_ > capacity_) {
         // Evict excess entries
-        size_t n_excess_entries = cache_mapper().size() - capacity_;
-        evict(n_excess_entries);
+        size_t n_excess_entries = size_ - capacity_;
+        evict(n_excess_entries, eviction_policy_t::lru);
     }
+    for (auto &shard : shards_)
+        shard.mutex_.unlock_write();
     return status::success;
 }
 
 int lru_primitive_cache_t::get_capacity() const {
-    utils::lock_read_t lock_r(rw_mutex());
     return (int)capacity_;
 }
 
+status_t lru_primitive_cache_t::set_memory_limit(size_t limit) {
+    for (auto &shard : shards_)
+        shard.mutex_.lock_write();
+    memory_limit_ = limit;
+    while (is_over_memory_limit() && size_ > 0)
+        evict(1, eviction_policy_t::size_weighted_lru);
+    for (auto &shard : shards_)
+        shard.mutex_.unlock_write();
+    return status::success;
+}
+
+size_t lru_primitive_cache_t::get_memory_limit() const {
+    return memory_limit_;
+}
+
+size_t lru_primitive_cache_t::get_footprint(primitive_kind_t kind) const {
+    if (kind == primitive_kind::undefined) return footprint_;
+
+    size_t footprint = 0;
+    std::unordered_set<const cache_blob_serializable_t *> kernels;
+    for (const auto &shard : shards_) {
+        utils::lock_read_t lock_r(shard.mutex_);
+        for (const auto &e : shard.cache_mapper()) {
+            // Entries that are still being created are not accounted yet.
+            if (e.first.primitive_kind_ != kind || e.second.footprint_ == 0)
+                continue;
+            const auto *primitive = e.second.value_.get().primitive.get();
+            footprint += primitive->get_footprint()
+                    - primitive->get_jit_code_size();
+            for (const auto *kernel : primitive->get_cache_blob_objects())
+                if (kernels.insert(kernel).second)
+                    footprint += kernel->get_footprint();
+        }
+    }
+    return footprint;
+}
+
 // For undocumented API
 int lru_primitive_cache_t::get_size() const {
-    utils::lock_read_t lock_r(rw_mutex());
-    return (int)cache_mapper().size();
+    return (int)size_;
 }
 
 lru_primitive_cache_t::value_t lru_primitive_cache_t::get_or_add(
         const key_t &key, const value_t &value) {
-    // 1. Section with shared access (read lock)
-    lock_read();
     // Check if the cache is enabled.
-    if (capacity_ == 0) {
-        unlock_read();
-        return value_t();
-    }
+    if (capacity_ == 0) return value_t();
+
+    auto &shard = get_shard(key);
+
+    // 1. Section with shared access to the shard (read lock)
     // Check if the requested entry is present in the cache (likely cache_hit)
-    auto e = get(key);
-    if (e.valid()) {
-        unlock_read();
-        return e;
-    }
+    shard.mutex_.lock_read();
+    auto e = get(shard, key);
+    shard.mutex_.unlock_read();
+    if (e.valid()) return e;
 
-    unlock_read();
+    // 2. Reserve a slot for the new entry. This may evict entries from other
+    // shards, so no shard lock is held at this point.
+    if (!reserve_slot()) return value_t();
 
-    // 2. Section with exclusive access (write lock).
-    // In a multithreaded scenario, in the context of one thread the cache
+    // 3. Section with exclusive access to the shard (write lock).
+    // In a multithreaded scenario, in the context of one thread the shard
     // may have changed by another thread between releasing the read lock and
     // acquiring the write lock (a.k.a. ABA problem), therefore additional
     // checks have to be performed for correctness.
+    shard.mutex_.lock_write();
     // Double check the capacity due to possible race condition
-    lock_write();
     if (capacity_ == 0) {
-        unlock_write();
+        size_--;
+        shard.mutex_.unlock_write();
         return value_t();
     }
 
     // Double check if the requested entry is present in the cache (unlikely
     // cache_hit).
-    e = get(key);
+    e = get(shard, key);
     if (!e.valid()) {
         // If the entry is missing in the cache then add it (cache_miss)
-        add(key, value);
+        add(shard, key, value);
+    } else {
+        // The reserved slot is not needed.
+        size_--;
     }
-    unlock_write();
+    shard.mutex_.unlock_write();
+
+    // The capacity might have been reduced while the slot was reserved.
+    while (size_ > capacity_ && evict_one(eviction_policy_t::lru))
+        ;
     return e;
 }
 
-void lru_primitive_cache_t::add(const key_t &key, const value_t &value) {
-    // std::list::size() method has linear complexity. Check the primitive cache
-    // size using std::unordered_map::size();
-    if (cache_mapper().size() == capacity_) {
-        // Evict the least recently used entry
-        evict(1);
+bool lru_primitive_cache_t::reserve_slot() {
+    size_t size = size_;
+    while (true) {
+        const size_t capacity = capacity_;
+        if (capacity == 0) return false;
+        if (size < capacity) {
+            if (size_.compare_exchange_weak(size, size + 1)) return true;
+            // `size` is updated with the current value on failure.
+            continue;
+        }
+        // If there is nothing to evict then all the entries are the slots
+        // reserved by other threads that haven't added them yet.
+        if (!evict_one(eviction_policy_t::lru)) std::this_thread::yield();
+        size = size_;
     }
+}
 
+void lru_primitive_cache_t::add(
+        shard_t &shard, const key_t &key, const value_t &value) {
     size_t timestamp = get_timestamp();
 
-    auto res = cache_mapper().emplace(std::piecewise_construct,
+    auto res = shard.cache_mapper().emplace(std::piecewise_construct,
             std::forward_as_tuple(key),
             std::forward_as_tuple(value, timestamp));
     MAYBE_UNUSED(res);
     assert(res.second);
 }
 
-lru_primitive_cache_t::value_t lru_primitive_cache_t::get(const key_t &key) {
-    auto it = cache_mapper().find(key);
-    if (it == cache_mapper().end()) return value_t();
+lru_primitive_cache_t::value_t lru_primitive_cache_t::get(
+        shard_t &shard, const key_t &key) {
+    auto it = shard.cache_mapper().find(key);
+    if (it == shard.cache_mapper().end()) return value_t();
 
     size_t timestamp = get_timestamp();
     it->second.timestamp_.store(timestamp);
@@ -180,66 +332,81 @@ lru_primitive_cache_t::value_t lru_primitive_cache_t::get(const key_t &key) {
     return it->second.value_;
 }
 
+void lru_primitive_cache_t::add_footprint(const primitive_t *primitive) {
+    size_t footprint
+            = primitive->get_footprint() - primitive->get_jit_code_size();
+    std::lock_guard<std::mutex> lock(kernel_refs_mutex_);
+    for (const auto *kernel : primitive->get_cache_blob_objects())
+        if (kernel_refs_[kernel]++ == 0) footprint += kernel->get_footprint();
+    footprint_ += footprint;
+}
+
+void lru_primitive_cache_t::remove_footprint(const primitive_t *primitive) {
+    size_t footprint
+            = primitive->get_footprint() - primitive->get_jit_code_size();
+    std::lock_guard<std::mutex> lock(kernel_refs_mutex_);
+    for (const auto *kernel : primitive->get_cache_blob_objects()) {
+        auto it = kernel_refs_.find(kernel);
+        if (it == kernel_refs_.end() || --it->second > 0) continue;
+        footprint += kernel->get_footprint();
+        kernel_refs_.erase(it);
+    }
+    footprint_ -= footprint;
+}
+
+void lru_primitive_cache_t::erase(
+        shard_t &shard, cache_mapper_t::iterator it) {
+    // Only the created primitives are accounted in the footprint.
+    if (it->second.footprint_ != 0)
+        remove_footprint(it->second.value_.get().primitive.get());
+    shard.cache_mapper().erase(it);
+    size_--;
+}
+
 std::shared_ptr<primitive_desc_t> lru_primitive_cache_t::get_pd(
         const key_t &key) {
-    lock_read();
-    if (capacity_ == 0) {
-        unlock_read();
-        return nullptr;
-    }
-    auto e = get(key);
-    unlock_read();
+    if (capacity_ == 0) return nullptr;
+
+    auto &shard = get_shard(key);
+    shard.mutex_.lock_read();
+    auto e = get(shard, key);
+    shard.mutex_.unlock_read();
 
     if (e.valid()) return e.get().primitive->pd();
     return nullptr;
 }
 
 void lru_primitive_cache_t::remove_if_invalidated(const key_t &key) {
-    lock_write();
+    auto &shard = get_shard(key);
+    utils::lock_write_t lock_w(shard.mutex_);
 
-    if (capacity_ == 0) {
-        unlock_write();
-        return;
-    }
-
-    auto it = cache_mapper().find(key);
-    if (it == cache_mapper().end()) {
-        // The entry has been already evicted at this point
-        unlock_write();
-        return;
-    }
+    auto it = shard.cache_mapper().find(key);
+    // The entry has been already evicted at this point
+    if (it == shard.cache_mapper().end()) return;
 
     const auto &value = it->second.value_;
-    if (value.get().primitive) {
-        // If the entry is not invalidated
-        unlock_write();
-        return;
-    }
+    // If the entry is not invalidated
+    if (value.get().primitive) return;
 
     // Remove the invalidated entry
-    cache_mapper().erase(it);
-    unlock_write();
+    erase(shard, it);
 }
 
 void lru_primitive_cache_t::update_entry(
         const key_t &key, const primitive_desc_t *pd) {
-    lock_write();
+    auto &shard = get_shard(key);
+    shard.mutex_.lock_write();
 
-    if (capacity_ == 0) {
-        unlock_write();
-        return;
-    }
-
-    auto it = cache_mapper().find(key);
+    auto it = shard.cache_mapper().find(key);
 
     // There is nothing to do in two cases:
     // 1. The requested entry is not in the cache because it has been evicted
     //    by another thread
     // 2. After the requested entry had been evicted it was inserted again
     //    by another thread
-    if (it == cache_mapper().end()
+    if (it == shard.cache_mapper().end()
             || it->first.thread_id() != key.thread_id()) {
-        unlock_write();
+        shard.mutex_.unlock_write();
         return;
     }
 
@@ -249,46 +416,130 @@ void lru_primitive_cache_t::update_entry(
     // Update key in cache_mapper()
     it->first.op_desc_ = op_desc;
     it->first.attr_ = attr;
-    unlock_write();
+
+    // The primitive is created at this point, so its footprint is known.
+    // The entry footprint includes the shared kernels and is used to pick
+    // the entries to evict.
+    const auto *primitive = it->second.value_.get().primitive.get();
+    if (it->second.footprint_ == 0) {
+        add_footprint(primitive);
+        it->second.footprint_ = primitive->get_footprint();
+    }
+    shard.mutex_.unlock_write();
+
+    enforce_memory_limit();
 }
 
-// Evicts n the least recently used entries
-void lru_primitive_cache_t::evict(size_t n) {
-    using v_t = std::unordered_map<key_t, timed_entry_t>::value_type;
+lru_primitive_cache_t::cache_mapper_t::iterator
+lru_primitive_cache_t::find_victim(shard_t &shard, eviction_policy_t policy,
+        size_t now, double &score) {
+    auto victim = shard.cache_mapper().end();
+    for (auto it = shard.cache_mapper().begin();
+            it != shard.cache_mapper().end(); ++it) {
+        // By default, load() and operator T use sequentially consistent
+        // memory ordering, which enforces writing the timestamps into
+        // registers in the same exact order they are read from the CPU cache
+        // line. Since the timestamps are compared under a lock, this order is
+        // not important, therefore we can safely use the weakest memory
+        // ordering (relaxed). This brings about a few microseconds
+        // performance improvement for default primitive cache capacity.
+        const size_t timestamp
+                = it->second.timestamp_.load(std::memory_order_relaxed);
+        // The timestamp may be updated by a concurrent cache hit after `now`
+        // was taken.
+        const double age = timestamp < now ? (double)(now - timestamp) : 0.;
+        double s = age;
+        if (policy == eviction_policy_t::size_weighted_lru) {
+            // Entries that are still being created have no footprint and
+            // can't reduce it.
+            if (it->second.footprint_ == 0) continue;
+            s = (age + 1.) * it->second.footprint_;
+        }
+        if (victim == shard.cache_mapper().end() || s > score) {
+            victim = it;
+            score = s;
+        }
+    }
+    return victim;
+}
+
+bool lru_primitive_cache_t::evict_one(eviction_policy_t policy) {
+    // Find the shard that contains the entry to evict. Only one shard is
+    // locked at a time, so the found entry is the right one only
+    // approximately when other threads access the cache.
+    const size_t now = get_timestamp();
+    shard_t *victim_shard = nullptr;
+    double victim_score = 0.;
+    for (auto &shard : shards_) {
+        utils::lock_read_t lock_r(shard.mutex_);
+        double score = 0.;
+        auto it = find_victim(shard, policy, now, score);
+        if (it == shard.cache_mapper().end()) continue;
+        if (!victim_shard || score > victim_score) {
+            victim_shard = &shard;
+            victim_score = score;
+        }
+    }
+    if (!victim_shard) return false;
+
+    utils::lock_write_t lock_w(victim_shard->mutex_);
+    // The shard might have been changed by another thread.
+    double score = 0.;
+    auto it = find_victim(*victim_shard, policy, now, score);
+    if (it == victim_shard->cache_mapper().end()) return true;
+    primitive_cache_stats().add_eviction(it->first.primitive_kind_);
+    erase(*victim_shard, it);
+    return true;
+}
 
-    if (n == capacity_) {
-        cache_mapper().clear();
+void lru_primitive_cache_t::enforce_memory_limit() {
+    while (is_over_memory_limit()
+            && evict_one(eviction_policy_t::size_weighted_lru))
+        ;
+}
+
+// Evicts n entries
+void lru_primitive_cache_t::evict(size_t n, eviction_policy_t policy) {
+    if (capacity_ == 0) {
+        for (auto &shard : shards_) {
+            for (const auto &e : shard.cache_mapper())
+                primitive_cache_stats().add_eviction(e.first.primitive_kind_);
+            size_ -= shard.cache_mapper().size();
+            shard.cache_mapper().clear();
+        }
+        footprint_ = 0;
+        std::lock_guard<std::mutex> lock(kernel_refs_mutex_);
+        kernel_refs_.clear();
         return;
     }
 
+    const size_t now = get_timestamp();
     for (size_t e = 0; e < n; e++) {
-        // Find the smallest timestamp
+        // Find the entry to evict among all shards
         // TODO: revisit the eviction algorithm due to O(n) complexity, E.g.
         // maybe evict multiple entries at once.
-        auto it = std::min_element(cache_mapper().begin(), cache_mapper().end(),
-                [&](const v_t &left, const v_t &right) {
-                    // By default, load() and operator T use sequentially
-                    // consistent memory ordering, which enforces writing the
-                    // timestamps into registers in the same exact order they
-                    // are read from the CPU cache line. Since eviction is
-                    // performed under a write lock, this order is not
-                    // important, therefore we can safely use the weakest memory
-                    // ordering (relaxed). This brings about a few microseconds
-                    // performance improvement for default primitive cache
-                    // capacity.
-                    return left.second.timestamp_.load(
-                                   std::memory_order_relaxed)
-                            < right.second.timestamp_.load(
-                                    std::memory_order_relaxed);
-                });
-        auto res = cache_mapper().erase(it->first);
-        MAYBE_UNUSED(res);
-        assert(res);
+        shard_t *victim_shard = nullptr;
+        cache_mapper_t::iterator victim;
+        double victim_score = 0.;
+        for (auto &shard : shards_) {
+            double score = 0.;
+            auto it = find_victim(shard, policy, now, score);
+            if (it == shard.cache_mapper().end()) continue;
+            if (!victim_shard || score > victim_score) {
+                victim_shard = &shard;
+                victim = it;
+                victim_score = score;
+            }
+        }
+        // The rest are the slots reserved by other threads.
+        if (!victim_shard) return;
+        primitive_cache_stats().add_eviction(victim->first.primitive_kind_);
+        erase(*victim_shard, victim);
     }
 }
 
 lru_primitive_cache_t::~lru_primitive_cache_t() {
-    if (cache_mapper().empty()) return;
+    if (size_ == 0) return;
 
 #if defined(_WIN32) \
         && (defined(DNNL_WITH_SYCL) || DNNL_GPU_RUNTIME == DNNL_RUNTIME_OCL)
@@ -297,7 +548,8 @@ lru_primitive_cache_t::~lru_primitive_cache_t() {
     HMODULE handle = LoadLibraryExA(
             "ntdll.dll", nullptr, LOAD_LIBRARY_SEARCH_SYSTEM32);
     if (!handle) {
-        cache_mapper_.release();
+        for (auto &shard : shards_)
+            shard.cache_mapper_.release();
         return;
     }
 
@@ -310,7 +562,8 @@ lru_primitive_cache_t::~lru_primitive_cache_t() {
         auto ret = FreeLibrary(handle);
         assert(ret);
         MAYBE_UNUSED(ret);
-        cache_mapper_.release();
+        for (auto &shard : shards_)
+            shard.cache_mapper_.release();
         return;
     }
 
@@ -324,16 +577,19 @@ lru_primitive_cache_t::~lru_primitive_cache_t() {
         // The whole process is being terminated hence destroying content of
         // the primitive cache cannot be done safely. However we can check
         // all entries and remove those that are not affected e.g. native CPU.
-        for (auto it = cache_mapper().begin(); it != cache_mapper().end();) {
-            const auto &engine_id = it->first.engine_id_;
-            if (engine_id.kind() == engine_kind::cpu
-                    && is_native_runtime(engine_id.runtime_kind())) {
-                it = cache_mapper().erase(it);
-            } else {
-                ++it;
+        for (auto &shard : shards_) {
+            auto &cache_mapper = shard.cache_mapper();
+            for (auto it = cache_mapper.begin(); it != cache_mapper.end();) {
+                const auto &engine_id = it->first.engine_id_;
+                if (engine_id.kind() == engine_kind::cpu
+                        && is_native_runtime(engine_id.runtime_kind())) {
+                    it = cache_mapper.erase(it);
+                } else {
+                    ++it;
+                }
             }
+            shard.cache_mapper_.release();
         }
-        cache_mapper_.release();
     } else {
         // Three scenarios possible:
         // 1. oneDNN is being dynamically unloaded
@@ -343,13 +599,15 @@ lru_primitive_cache_t::~lru_primitive_cache_t() {
         //    the process terminates
         // In all these scenarios content of the primitive cache can be safely
         // destroyed.
-        cache_mapper_.reset();
+        for (auto &shard : shards_)
+            shard.cache_mapper_.reset();
     }
 #else
     // Always destroy the content of the primitive cache for non-Windows OSes,
     // and non-sycl and non-ocl runtimes because there is no a problem with
     // library unloading order in such cases.
-    cache_mapper_.reset();
+    for (auto &shard : shards_)
+        shard.cache_mapper_.reset();
 #endif
 }
 
@@ -373,3 +631,47 @@ dnnl::impl::status_t dnnl_set_primitive_cache_capacity(int capacity) {
 #endif
     return dnnl::impl::status::success;
 }
+
+dnnl::impl::status_t dnnl_get_primitive_cache_memory_limit(size_t *limit) {
+    if (limit == nullptr) return dnnl::impl::status::invalid_arguments;
+    *limit = 0;
+#ifndef DNNL_DISABLE_PRIMITIVE_CACHE
+    *limit = dnnl::impl::primitive_cache().get_memory_limit();
+#endif
+    return dnnl::impl::status::success;
+}
+
+dnnl::impl::status_t dnnl_set_primitive_cache_memory_limit(size_t limit) {
+#ifndef DNNL_DISABLE_PRIMITIVE_CACHE
+    return dnnl::impl::primitive_cache().set_memory_limit(limit);
+#endif
+    return dnnl::impl::status::success;
+}
+
+dnnl::impl::status_t dnnl_get_primitive_cache_footprint(
+        dnnl::impl::primitive_kind_t kind, size_t *footprint) {
+    if (footprint == nullptr) return dnnl::impl::status::invalid_arguments;
+    *footprint = 0;
+#ifndef DNNL_DISABLE_PRIMITIVE_CACHE
+    *footprint = dnnl::impl::primitive_cache().get_footprint(kind);
+#endif
+    return dnnl::impl::status::success;
+}
+
+dnnl::impl::status_t dnnl_get_primitive_cache_stats(
+        dnnl::impl::primitive_kind_t kind,
+        dnnl_primitive_cache_stats_t *stats) {
+    if (stats == nullptr) return dnnl::impl::status::invalid_arguments;
+    *stats = dnnl::impl::primitive_cache_stats().get(kind);
+    return dnnl::impl::status::success;
+}
+
+dnnl::impl::status_t dnnl_reset_primitive_cache_stats() {
+    dnnl::impl::primitive_cache_stats().reset();
+    return dnnl::impl::status::success;
+}
+
+dnnl::impl::status_t dnnl_dump_primitive_cache_stats() {
+    dnnl::impl::primitive_cache_stats().dump();
+    return dnnl::impl::status::success;
+}
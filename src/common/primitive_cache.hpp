@@ -17,8 +17,10 @@
 #ifndef COMMON_PRIMITIVE_CACHE_HPP
 #define COMMON_PRIMITIVE_CACHE_HPP
 
+#include <atomic>
 #include <future>
 #include <memory>
+#include <mutex>
 #include <thread>
 #include <unordered_map>
 
@@ -31,6 +33,7 @@
 namespace dnnl {
 namespace impl {
 
+struct cache_blob_serializable_t;
 struct primitive_t;
 struct primitive_cache_t : public c_compatible {
     struct cache_value_t {
@@ -45,6 +48,12 @@ struct primitive_cache_t : public c_compatible {
     virtual status_t set_capacity(int capacity) = 0;
     virtual int get_capacity() const = 0;
 
+    virtual status_t set_memory_limit(size_t limit) = 0;
+    virtual size_t get_memory_limit() const = 0;
+    // Returns the memory footprint of the cached primitives of a given kind
+    // or of all the primitives if the kind is undefined.
+    virtual size_t get_footprint(primitive_kind_t kind) const = 0;
+
     virtual value_t get_or_add(const key_t &key, const value_t &value) = 0;
     virtual void remove_if_invalidated(const key_t &key) = 0;
     virtual void update_entry(const key_t &key, const primitive_desc_t *pd) = 0;
@@ -52,31 +61,34 @@ struct primitive_cache_t : public c_compatible {
     virtual int get_size() const = 0;
 
     virtual std::shared_ptr<primitive_desc_t> get_pd(const key_t &key) = 0;
-
-protected:
-    static utils::rw_mutex_t &rw_mutex() {
-        static utils::rw_mutex_t mutex;
-        return mutex;
-    }
-
-    void lock_read() { rw_mutex().lock_read(); }
-    void lock_write() { rw_mutex().lock_write(); }
-    void unlock_read() { rw_mutex().unlock_read(); }
-    void unlock_write() { rw_mutex().unlock_write(); }
 };
 
-// The cache uses LRU replacement policy
+// The cache uses LRU replacement policy.
+//
+// The entries are distributed among a fixed number of shards by the key hash.
+// Each shard has its own lock, so threads that look up or add different keys
+// don't contend on a single global lock. Cache hits take a shared (read) lock
+// of a single shard only. The capacity is global: a new entry reserves a slot
+// in the global size counter and, if the cache is full, the least recently
+// used entry among all shards is evicted.
+//
+// Optionally, the cache is limited by the memory footprint of the cached
+// primitives (see `primitive_t::get_footprint()`). When the footprint exceeds
+// the limit the entries are evicted by a size-weighted LRU policy: the entry
+// with the largest product of its age and footprint goes first, so a large
+// rarely used primitive is evicted before a small one used at the same time.
 struct lru_primitive_cache_t : public primitive_cache_t {
-    lru_primitive_cache_t(int capacity) : capacity_(capacity) {
-        cache_mapper_ = utils::make_unique<
-                std::unordered_map<key_t, timed_entry_t>>();
-    }
+    lru_primitive_cache_t(int capacity, size_t memory_limit = 0);
 
     ~lru_primitive_cache_t() override;
 
     status_t set_capacity(int capacity) override;
     int get_capacity() const override;
 
+    status_t set_memory_limit(size_t limit) override;
+    size_t get_memory_limit() const override;
+    size_t get_footprint(primitive_kind_t kind) const override;
+
     value_t get_or_add(const key_t &key, const value_t &value) override;
     void remove_if_invalidated(const key_t &key) override;
     void update_entry(const key_t &key, const primitive_desc_t *pd) override;
@@ -86,38 +98,135 @@ struct lru_primitive_cache_t : public primitive_cache_t {
     std::shared_ptr<primitive_desc_t> get_pd(const key_t &key) override;
 
 private:
-    void evict(size_t n);
-    void add(const key_t &key, const value_t &value);
-    value_t get(const key_t &key);
-
-    size_t capacity_;
     struct timed_entry_t {
         value_t value_;
         std::atomic<size_t> timestamp_;
+        // Zero until the primitive is created.
+        size_t footprint_;
         timed_entry_t(const value_t &value, size_t timestamp)
-            : value_(value), timestamp_(timestamp) {}
+            : value_(value), timestamp_(timestamp), footprint_(0) {}
     };
 
-    std::unordered_map<key_t, timed_entry_t> &cache_mapper() {
-        return *cache_mapper_;
-    }
-
-    const std::unordered_map<key_t, timed_entry_t> &cache_mapper() const {
-        return *cache_mapper_;
-    }
-
     // Each entry in the cache has a corresponding key and timestamp.
     // NOTE: pairs that contain atomics cannot be stored in an unordered_map *as
     // an element*, since it invokes the copy constructor of std::atomic, which
     // is deleted.
-    std::unique_ptr<std::unordered_map<key_t, timed_entry_t>> cache_mapper_;
+    using cache_mapper_t = std::unordered_map<key_t, timed_entry_t>;
+
+    struct shard_t {
+        shard_t() : cache_mapper_(utils::make_unique<cache_mapper_t>()) {}
+
+        cache_mapper_t &cache_mapper() { return *cache_mapper_; }
+        const cache_mapper_t &cache_mapper() const { return *cache_mapper_; }
+
+        mutable utils::rw_mutex_t mutex_;
+        std::unique_ptr<cache_mapper_t> cache_mapper_;
+    };
+
+    static constexpr int nshards_ = 16;
+
+    shard_t &get_shard(const key_t &key) {
+        return shards_[std::hash<key_t>()(key) % nshards_];
+    }
+
+    // The following functions must be called with the shard lock taken.
+    void add(shard_t &shard, const key_t &key, const value_t &value);
+    value_t get(shard_t &shard, const key_t &key);
+    void erase(shard_t &shard, cache_mapper_t::iterator it);
+
+    enum class eviction_policy_t { lru, size_weighted_lru };
+    // Returns the entry of the shard that should be evicted first according
+    // to the policy and its score, or the end iterator if there is nothing to
+    // evict. The shard lock must be taken.
+    cache_mapper_t::iterator find_victim(shard_t &shard,
+            eviction_policy_t policy, size_t now, double &score);
+
+    // Reserves a slot for a new entry evicting the least recently used entries
+    // if needed. Returns false if the cache is disabled.
+    bool reserve_slot();
+    // Evicts one entry according to the policy, takes the shard locks itself.
+    // Returns false if there was nothing to evict.
+    bool evict_one(eviction_policy_t policy);
+    // Evicts entries until the footprint fits the memory limit, takes the
+    // shard locks itself.
+    void enforce_memory_limit();
+    // Evicts n entries according to the policy, all shard locks must be
+    // taken.
+    void evict(size_t n, eviction_policy_t policy);
+    bool is_over_memory_limit() const {
+        return memory_limit_ != 0 && footprint_ > memory_limit_;
+    }
+    // Accounts the footprint of a created primitive in the cache footprint.
+    // The kernels shared by several cached primitives are counted once.
+    void add_footprint(const primitive_t *primitive);
+    void remove_footprint(const primitive_t *primitive);
+
+    std::atomic<size_t> capacity_;
+    // The number of entries in all shards including the reserved slots.
+    std::atomic<size_t> size_;
+    // Zero means that the memory footprint is not limited.
+    std::atomic<size_t> memory_limit_;
+    std::atomic<size_t> footprint_;
+    shard_t shards_[nshards_];
+    // The number of cached primitives that use a kernel.
+    std::mutex kernel_refs_mutex_;
+    std::unordered_map<const cache_blob_serializable_t *, int> kernel_refs_;
 
     // Used for testing.
     friend size_t DNNL_API set_primitive_cache_capacity_without_clearing(
             size_t capacity);
 };
 
+// Statistics of the primitive cache usage broken down by primitive kind.
+// The counters are updated with relaxed atomic operations, so collecting the
+// statistics is cheap enough to be always enabled.
+struct primitive_cache_stats_t {
+    void add_hit(primitive_kind_t kind) {
+        counters(kind).hits.fetch_add(1, std::memory_order_relaxed);
+    }
+    void add_miss(primitive_kind_t kind, double creation_ms,
+            size_t jit_code_size) {
+        auto &c = counters(kind);
+        c.misses.fetch_add(1, std::memory_order_relaxed);
+        c.creation_us.fetch_add(
+                (uint64_t)(creation_ms * 1e3), std::memory_order_relaxed);
+        c.jit_code_size.fetch_add(jit_code_size, std::memory_order_relaxed);
+    }
+    void add_eviction(primitive_kind_t kind) {
+        counters(kind).evictions.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    // Returns the statistics for a given kind or the total statistics if
+    // the kind is undefined.
+    dnnl_primitive_cache_stats_t get(primitive_kind_t kind) const;
+    void reset();
+    // Prints the statistics for each primitive kind that used the cache.
+    void dump() const;
+
+private:
+    struct counters_t {
+        std::atomic<uint64_t> hits {0};
+        std::atomic<uint64_t> misses {0};
+        std::atomic<uint64_t> evictions {0};
+        std::atomic<uint64_t> creation_us {0};
+        std::atomic<uint64_t> jit_code_size {0};
+    };
+
+    // The last slot accumulates the statistics for all internal primitive
+    // kinds.
+    static constexpr int nkinds_ = 64;
+    static int kind_index(primitive_kind_t kind) {
+        return (int)kind < nkinds_ - 1 ? (int)kind : nkinds_ - 1;
+    }
+    counters_t &counters(primitive_kind_t kind) {
+        return counters_[kind_index(kind)];
+    }
+
+    counters_t counters_[nkinds_];
+};
+
 primitive_cache_t &primitive_cache();
+primitive_cache_stats_t &primitive_cache_stats();
 
 // Undocumented API for testing.
 status_t DNNL_API get_primitive_cache_size(int *size);
@@ -0,0 +1,171 @@
+/*******************************************************************************
+* Copyright 2023 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "oneapi/dnnl/dnnl.h"
+
+#include "c_types_map.hpp"
+#include "engine.hpp"
+#include "primitive.hpp"
+#include "primitive_cache.hpp"
+#include "primitive_desc_iface.hpp"
+#include "utils.hpp"
+
+namespace dnnl {
+namespace impl {
+
+namespace {
+
+// A pool of helper threads that create primitives in the background.
+//
+// A primitive is created with the regular `primitive_desc_t::create_primitive`
+// call, which puts a shared future into the primitive cache before the
+// primitive is initialized. Therefore, a primitive creation requested by a
+// user while the same primitive is being created by a helper thread waits for
+// the in-flight future instead of generating the kernels once again.
+//
+// The threads are started on demand and exit once the queue is empty, so the
+// pool doesn't keep any threads when there is nothing to create.
+struct warm_up_pool_t {
+    warm_up_pool_t()
+        : max_threads_(std::max(1u, std::thread::hardware_concurrency())) {
+        // The primitive cache must outlive the pool because the pool waits
+        // for the tasks at destruction.
+        primitive_cache();
+    }
+
+    ~warm_up_pool_t() { wait(); }
+
+    void submit(const std::vector<const primitive_desc_iface_t *> &pds) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (const auto *pd_iface : pds)
+            tasks_.emplace_back(pd_iface->impl(), pd_iface->engine());
+        npending_ += pds.size();
+
+        // All the threads have exited, so they can be joined without waiting.
+        if (nrunning_ == 0) join_threads();
+        const size_t nthreads
+                = std::min(tasks_.size(), max_threads_ - nrunning_);
+        for (size_t i = 0; i < nthreads; i++) {
+            threads_.emplace_back(&warm_up_pool_t::worker, this);
+            nrunning_++;
+        }
+    }
+
+    void wait() {
+        std::unique_lock<std::mutex> lock(mutex_);
+        done_cv_.wait(lock, [&] { return npending_ == 0 && nrunning_ == 0; });
+        join_threads();
+    }
+
+private:
+    struct task_t {
+        task_t(const std::shared_ptr<primitive_desc_t> &pd, engine_t *engine)
+            : pd(pd), engine(engine) {
+            engine->retain();
+        }
+        task_t(task_t &&other) : pd(std::move(other.pd)), engine(other.engine) {
+            other.engine = nullptr;
+        }
+        ~task_t() {
+            if (engine) engine->release();
+        }
+
+        std::shared_ptr<primitive_desc_t> pd;
+        engine_t *engine;
+
+        DNNL_DISALLOW_COPY_AND_ASSIGN(task_t);
+    };
+
+    void worker() {
+        std::unique_lock<std::mutex> lock(mutex_);
+        while (!tasks_.empty()) {
+            task_t task = std::move(tasks_.front());
+            tasks_.pop_front();
+            lock.unlock();
+
+            // The created primitive is kept by the primitive cache. If the
+            // creation fails the cache entry is invalidated and a subsequent
+            // creation by a user reports the error.
+            std::shared_ptr<primitive_t> p;
+            task.pd->create_primitive(p, task.engine);
+            p.reset();
+
+            lock.lock();
+            npending_--;
+        }
+        nrunning_--;
+        done_cv_.notify_all();
+    }
+
+    // Must be called with the mutex taken when no thread is running.
+    void join_threads() {
+        for (auto &t : threads_)
+            t.join();
+        threads_.clear();
+    }
+
+    const size_t max_threads_;
+    std::mutex mutex_;
+    std::condition_variable done_cv_;
+    std::deque<task_t> tasks_;
+    std::vector<std::thread> threads_;
+    // The number of submitted tasks that are not completed yet.
+    size_t npending_ = 0;
+    size_t nrunning_ = 0;
+};
+
+warm_up_pool_t &warm_up_pool() {
+    static warm_up_pool_t pool;
+    return pool;
+}
+
+} // namespace
+
+} // namespace impl
+} // namespace dnnl
+
+using namespace dnnl::impl;
+
+// API
+status_t dnnl_primitive_cache_warm_up(
+        int npds, const primitive_desc_iface_t **pds) {
+    if (npds < 0 || (npds > 0 && pds == nullptr))
+        return status::invalid_arguments;
+    for (int i = 0; i < npds; i++)
+        if (pds[i] == nullptr) return status::invalid_arguments;
+#ifndef DNNL_DISABLE_PRIMITIVE_CACHE
+    // There is nothing to warm up if the primitive cache is disabled.
+    if (npds == 0 || primitive_cache().get_capacity() == 0)
+        return status::success;
+    warm_up_pool().submit({pds, pds + npds});
+#endif
+    return status::success;
+}
+
+status_t dnnl_primitive_cache_warm_up_wait() {
+#ifndef DNNL_DISABLE_PRIMITIVE_CACHE
+    warm_up_pool().wait();
+#endif
+    return status::success;
+}
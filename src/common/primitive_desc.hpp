@@ -109,6 +109,12 @@ struct primitive_desc_t : public c_compatible {
         if ((arg == (DNNL_ARG_ATTR_SCALES | DNNL_ARG_SRC_1))
                 && !attr()->scales_.get(DNNL_ARG_SRC_1).defined())
             return arg_usage_t::input;
+        if (arg == DNNL_ARG_ATTR_ROUNDING_SEED
+                && !attr()->rounding_mode_.has_default_values())
+            return arg_usage_t::input;
+        if (arg == DNNL_ARG_DST_AMAX
+                && !attr()->dst_amax_params_.has_default_values())
+            return arg_usage_t::output;
         if (arg == DNNL_ARG_SCRATCHPAD && !is_zero_md(scratchpad_md()))
             return arg_usage_t::output;
         for (int idx = 0; idx < attr()->post_ops_.len(); ++idx) {
@@ -49,6 +49,7 @@ status_t cvt_primitive_args(const primitive_desc_t *pd, int nargs,
                 extra_inputs += (arg == DNNL_ARG_ATTR_OUTPUT_SCALES)
                         || (arg & DNNL_ARG_ATTR_ZERO_POINTS)
                         || (arg & DNNL_ARG_ATTR_SCALES)
+                        || (arg == DNNL_ARG_ATTR_ROUNDING_SEED)
                         // 1x1 + dw conv fusion
                         || (arg
                                 == (DNNL_ARG_ATTR_POST_OP_DW
@@ -65,7 +66,8 @@ status_t cvt_primitive_args(const primitive_desc_t *pd, int nargs,
                 if (args.count(arg) != 0) return invalid_arguments;
                 args[arg] = {mem, false};
                 n_outputs++;
-                extra_outputs += (arg == DNNL_ARG_SCRATCHPAD);
+                extra_outputs += (arg == DNNL_ARG_SCRATCHPAD)
+                        || (arg == DNNL_ARG_DST_AMAX);
                 break;
             case primitive_desc_t::arg_usage_t::unused: break;
         }
@@ -110,7 +112,8 @@ void exec_ctx_t::register_memory_mapping(void *handle, void *host_ptr) {
     memory_mapping_.insert({handle, host_ptr});
 }
 
-void *exec_ctx_t::host_ptr(int arg, bool do_zeropad, status_t *status_) const {
+void *exec_ctx_t::host_ptr(
+        int arg, bool do_zeropad, status_t *status_, int index) const {
     status_t status = status::success;
     if (status_) *status_ = status;
 
@@ -120,7 +123,7 @@ void *exec_ctx_t::host_ptr(int arg, bool do_zeropad, status_t *status_) const {
     if (do_zeropad) status = mem->zero_pad(*this);
     if (status_) *status_ = status;
 
-    auto *mem_storage = mem->memory_storage();
+    auto *mem_storage = mem->memory_storage(index);
     return host_ptr(mem_storage);
 }
 
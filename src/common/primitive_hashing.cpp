@@ -208,6 +208,13 @@ size_t get_attr_hash(const primitive_attr_t &attr) {
             seed = hash_combine(seed, p.first);
             // scales: mask
             seed = hash_combine(seed, p.second.mask_);
+            // scales: groups
+            const int ndims = p.second.ndims_;
+            seed = hash_combine(seed, ndims);
+            if (ndims > 0)
+                seed = get_array_hash(seed, p.second.group_dims_, ndims);
+            // scales: data type
+            seed = hash_combine(seed, static_cast<size_t>(p.second.data_type_));
         }
     }
     // zero_points
@@ -219,6 +226,16 @@ size_t get_attr_hash(const primitive_attr_t &attr) {
             attr.zero_points_.get(arg, &mask);
             // zero_points: mask
             seed = hash_combine(seed, mask);
+            // zero_points: groups
+            const int ndims = attr.zero_points_.get_groups_ndims(arg);
+            seed = hash_combine(seed, ndims);
+            if (ndims > 0)
+                seed = get_array_hash(
+                        seed, attr.zero_points_.get_groups(arg), ndims);
+            // zero_points: data type
+            seed = hash_combine(seed,
+                    static_cast<size_t>(
+                            attr.zero_points_.get_data_type(arg)));
         }
     // post_ops: entry[:]
     for (int i = 0; i < attr.post_ops_.len(); i++) {
@@ -275,6 +292,18 @@ size_t get_attr_hash(const primitive_attr_t &attr) {
         seed = get_array_hash(seed, attr.rnn_weights_qparams_.scales_,
                 attr.rnn_weights_qparams_.count_);
     }
+    // src_dyn_quant_params: data_type
+    seed = hash_combine(seed,
+            static_cast<size_t>(attr.src_dyn_quant_params_.data_type_));
+    // weights_paging_params: page_size
+    seed = hash_combine(seed, attr.weights_paging_params_.page_size_);
+    // dst_amax_params: enabled
+    seed = hash_combine(seed, attr.dst_amax_params_.enabled_);
+    // rounding_mode: arg, mode
+    for (const auto &p : attr.rounding_mode_.rounding_modes_map_) {
+        seed = hash_combine(seed, p.first);
+        seed = hash_combine(seed, static_cast<size_t>(p.second));
+    }
     if (attr.gpu_attr_) {
         seed = hash_combine(seed, attr.gpu_attr_->get_hash());
     }
@@ -52,6 +52,15 @@ void unpoison_outputs(const exec_args_t &args) {
         msan_unpoison(p, s);
     }
 }
+
+// Cache blobs are supported for OpenCL GPU engines and for CPU engines with
+// a native (non-SYCL) runtime.
+bool is_cache_blob_supported(const engine_t *engine) {
+    const auto ekind = engine->kind();
+    const auto runtime_kind = engine->runtime_kind();
+    if (ekind == engine_kind::gpu) return runtime_kind == runtime_kind::ocl;
+    return ekind == engine_kind::cpu && runtime_kind != runtime_kind::sycl;
+}
 } // namespace
 
 namespace dnnl {
@@ -151,13 +160,8 @@ status_t dnnl_primitive_create_from_cache_blob(
             || size == 0) {
         return invalid_arguments;
     }
-    const auto ekind = primitive_desc_iface->engine()->kind();
-    const auto runtime_kind = primitive_desc_iface->engine()->runtime_kind();
-    if (ekind != engine_kind::gpu
-            || (ekind == engine_kind::gpu
-                    && runtime_kind != runtime_kind::ocl)) {
+    if (!is_cache_blob_supported(primitive_desc_iface->engine()))
         return status::unimplemented;
-    }
 
     cache_blob_t cb(const_cast<uint8_t *>(cache_blob), size);
     return dnnl::impl::primitive_create(
@@ -210,13 +214,8 @@ status_t dnnl_primitive_get_cache_blob(const primitive_iface_t *primitive_iface,
         return status::invalid_arguments;
     }
 
-    const auto ekind = primitive_iface->engine()->kind();
-    const auto runtime_kind = primitive_iface->engine()->runtime_kind();
-    if (ekind != engine_kind::gpu
-            || (ekind == engine_kind::gpu
-                    && runtime_kind != runtime_kind::ocl)) {
+    if (!is_cache_blob_supported(primitive_iface->engine()))
         return status::unimplemented;
-    }
 
     if (!cache_blob) {
         size_t sz = 0;
@@ -144,6 +144,10 @@ void serialize_attr(
         for (const auto &p : attr.scales_.scales_) {
             sstream.write(&p.first);
             sstream.write(&p.second.mask_);
+            sstream.write(&p.second.ndims_);
+            if (p.second.ndims_ > 0)
+                sstream.write(p.second.group_dims_, p.second.ndims_);
+            sstream.write(&p.second.data_type_);
         }
     }
     // zero_points
@@ -155,6 +159,14 @@ void serialize_attr(
             attr.zero_points_.get(arg, &mask);
             // zero_points: mask
             sstream.write(&mask);
+            // zero_points: groups
+            const int ndims = attr.zero_points_.get_groups_ndims(arg);
+            sstream.write(&ndims);
+            if (ndims > 0)
+                sstream.write(attr.zero_points_.get_groups(arg), ndims);
+            // zero_points: data type
+            const data_type_t dt = attr.zero_points_.get_data_type(arg);
+            sstream.write(&dt);
         }
     // post_ops: entry[:]
     for (int i = 0; i < attr.post_ops_.len(); i++) {
@@ -199,6 +211,17 @@ void serialize_attr(
         sstream.write(attr.rnn_weights_qparams_.scales_,
                 attr.rnn_weights_qparams_.count_);
     }
+    // src_dyn_quant_params: data_type
+    sstream.write(&attr.src_dyn_quant_params_.data_type_);
+    // weights_paging_params: page_size
+    sstream.write(&attr.weights_paging_params_.page_size_);
+    // dst_amax_params: enabled
+    sstream.write(&attr.dst_amax_params_.enabled_);
+    // rounding_mode: arg, mode
+    for (const auto &p : attr.rounding_mode_.rounding_modes_map_) {
+        sstream.write(&p.first);
+        sstream.write(&p.second);
+    }
     if (attr.gpu_attr_) {
         attr.gpu_attr_->serialize(sstream);
     } else {
@@ -170,6 +170,18 @@ protected:
         }
         return ok;
     }
+
+    // Only a common zero point for the quantized destination is supported.
+    bool attr_zero_points_ok() const {
+        const auto &zp = attr()->zero_points_;
+        if (!zp.has_default_values(DNNL_ARG_SRC)
+                || !zp.has_default_values(DNNL_ARG_WEIGHTS))
+            return false;
+        if (zp.has_default_values(DNNL_ARG_DST)) return true;
+        return zp.common(DNNL_ARG_DST)
+                && utils::one_of(dst_md()->data_type, data_type::s8,
+                        data_type::u8);
+    }
 };
 
 struct softmax_bwd_pd_t : public softmax_pd_t {
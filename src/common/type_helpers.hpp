@@ -85,18 +85,31 @@ inline size_t data_type_size(data_type_t data_type) {
     switch ((int)data_type) {
         case f16: return sizeof(prec_traits<f16>::type);
         case bf16: return sizeof(prec_traits<bf16>::type);
+        case f8_e5m2: return sizeof(prec_traits<f8_e5m2>::type);
+        case f8_e4m3: return sizeof(prec_traits<f8_e4m3>::type);
         case tf32: // the tf32 type is an f32
         case f32: return sizeof(prec_traits<f32>::type);
         case f64: return sizeof(prec_traits<f64>::type);
         case s32: return sizeof(prec_traits<s32>::type);
         case s8: return sizeof(prec_traits<s8>::type);
         case u8: return sizeof(prec_traits<u8>::type);
+        // Two values of the 4-bit types share a byte, the byte is the
+        // smallest addressable unit though.
+        case s4:
+        case u4: return 1;
         case data_type::undef:
         default: assert(!"unknown data_type");
     }
     return (size_t)-1; /* not supposed to be reachable */
 }
 
+/** returns the number of values packed in a byte for the sub-byte data types
+ * and 1 for the rest */
+inline int sub_byte_data_type_multiplier(data_type_t data_type) {
+    using namespace data_type;
+    return utils::one_of(data_type, s4, u4) ? 2 : 1;
+}
+
 template <typename T>
 inline T max_value(data_type_t data_type) {
     using namespace data_type;
@@ -106,6 +119,8 @@ inline T max_value(data_type_t data_type) {
     switch (data_type) {
         CASE(f16);
         CASE(bf16);
+        CASE(f8_e5m2);
+        CASE(f8_e4m3);
         CASE(s32);
         CASE(s8);
         CASE(u8);
@@ -127,6 +142,8 @@ inline float max_value(data_type_t data_type) {
     switch (data_type) {
         CASE(f16);
         CASE(bf16);
+        CASE(f8_e5m2);
+        CASE(f8_e4m3);
         CASE(s8);
         CASE(u8);
         // INT_MAX is not representable in float. The nearest float to it is
@@ -265,6 +282,8 @@ inline data_type_t default_accum_data_type(
 
     if (one_of(f16, src_dt, dst_dt)) return f32;
     if (one_of(bf16, src_dt, dst_dt)) return f32;
+    if (one_of(f8_e5m2, src_dt, dst_dt)) return f32;
+    if (one_of(f8_e4m3, src_dt, dst_dt)) return f32;
     if (one_of(f32, src_dt, dst_dt)) return f32;
     if (one_of(f64, src_dt, dst_dt)) return f64;
     if (one_of(s32, src_dt, dst_dt)) return s32;
@@ -285,7 +304,14 @@ inline data_type_t default_accum_data_type(data_type_t src_dt,
     if (everyone_is(f64, src_dt, wei_dt)) return f64;
 
     if (one_of(prop_kind, forward_training, forward_inference)) {
-        if ((src_dt == u8 || src_dt == s8) && wei_dt == s8) return s32;
+        if (one_of(src_dt, u8, s8) && one_of(wei_dt, s8, u8)) return s32;
+        // The 4-bit and 8-bit floating-point weights are decompressed to
+        // the floating-point source. The 8-bit integer weights are either
+        // decompressed or multiplied by the dynamically quantized source,
+        // whose results are scaled back to floating point.
+        if (one_of(wei_dt, s8, u8, s4, u4, f8_e5m2, f8_e4m3)
+                && one_of(src_dt, f32, bf16, f16))
+            return f32;
         if (one_of(f16, src_dt, wei_dt)) return f32;
     } else if (prop_kind == backward_data) {
         if (one_of(src_dt, f32, s32, s8, u8) && wei_dt == s8
@@ -304,7 +330,7 @@ inline data_type_t default_accum_data_type(data_type_t src_dt,
 
 inline bool is_integral_dt(data_type_t dt) {
     using namespace data_type;
-    return utils::one_of(dt, s32, s8, u8);
+    return utils::one_of(dt, s32, s8, u8, s4, u4);
 }
 
 template <typename data_t>
@@ -922,7 +948,9 @@ inline bool memory_desc_sanity_check(int ndims, const dims_t dims,
     if (ndims == 0) return true;
 
     bool ok = dims != nullptr && 0 < ndims && ndims <= DNNL_MAX_NDIMS
-            && utils::one_of(data_type, f16, bf16, f32, f64, s32, s8, u8);
+            && utils::one_of(
+                    data_type, f16, bf16, f32, f64, s32, s8, u8, s4, u4,
+                    f8_e5m2, f8_e4m3);
     if (!ok) return false;
 
     bool has_runtime_dims = false;
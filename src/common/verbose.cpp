@@ -15,6 +15,7 @@
 *******************************************************************************/
 
 #include <atomic>
+#include <cstdarg>
 #include <sstream>
 #include <type_traits>
 
@@ -157,6 +158,21 @@ double get_msec() {
 #endif
 }
 
+void verbose_printf_info(const char *fmt, ...) {
+#if !defined(DISABLE_VERBOSE)
+    char msg[256];
+    va_list args;
+    va_start(args, fmt);
+    vsnprintf(msg, sizeof(msg), fmt, args);
+    va_end(args);
+
+    std::string stamp;
+    if (get_verbose_timestamp()) stamp = "," + std::to_string(get_msec());
+    printf("onednn_verbose%s,info,%s\n", stamp.c_str(), msg);
+    fflush(stdout);
+#endif
+}
+
 #if defined(DISABLE_VERBOSE)
 void pd_info_t::init(
         dnnl::impl::engine_t *, const dnnl::impl::primitive_desc_t *) {}
@@ -374,8 +390,24 @@ std::string md2desc_str(const memory_desc_t *md) {
     return s;
 }
 
+namespace {
+// Prints the data type and the groups of quantization parameters as
+// `:dt[:g0xg1...]`.
+void print_qparams_dt_and_groups(std::ostream &ss, data_type_t dt, int ndims,
+        const dim_t *groups) {
+    ss << ":" << dnnl_dt2str(dt);
+    if (ndims == 0) return;
+    ss << ":";
+    for (int d = 0; d < ndims; d++)
+        ss << (d ? "x" : "") << groups[d];
+}
+} // namespace
+
 std::ostream &operator<<(std::ostream &ss, const runtime_scales_t &oscale) {
     ss << oscale.mask_;
+    if (!oscale.has_default_data_type() || !oscale.has_default_groups())
+        print_qparams_dt_and_groups(
+                ss, oscale.data_type_, oscale.ndims_, oscale.group_dims_);
     return ss;
 }
 
@@ -473,6 +505,10 @@ std::ostream &operator<<(std::ostream &ss, const primitive_attr_t *attr) {
             zp.get(arg, &mask);
 
             ss << delim << arg2str(arg) << ":" << mask;
+            const data_type_t dt = zp.get_data_type(arg);
+            const int ndims = zp.get_groups_ndims(arg);
+            if (dt != data_type::s32 || ndims > 0)
+                print_qparams_dt_and_groups(ss, dt, ndims, zp.get_groups(arg));
             delim = attr_delim;
         }
         ss << " ";
@@ -539,6 +575,31 @@ std::ostream &operator<<(std::ostream &ss, const primitive_attr_t *attr) {
            << ";";
     }
 
+    const src_dyn_quant_params_t &dq = attr->src_dyn_quant_params_;
+    if (!dq.has_default_values()) {
+        ss << "attr-src-dyn-quant:" << dq.data_type_ << " ";
+    }
+
+    const weights_paging_params_t &wp = attr->weights_paging_params_;
+    if (!wp.has_default_values()) {
+        ss << "attr-wei-page-size:" << wp.page_size_ << " ";
+    }
+
+    if (!attr->dst_amax_params_.has_default_values()) ss << "attr-dst-amax ";
+
+    const rnd_mode_t &rm = attr->rounding_mode_;
+    if (!rm.has_default_values()) {
+        std::string delim = empty_delim;
+        ss << "attr-rounding-mode:";
+        for (const auto &map_entry : rm.rounding_modes_map_) {
+            const bool is_sr = map_entry.second == rounding_mode::stochastic;
+            ss << delim << arg2str(map_entry.first) << ":"
+               << (is_sr ? "stochastic" : "environment");
+            delim = attr_delim;
+        }
+        ss << " ";
+    }
+
     return ss;
 }
 
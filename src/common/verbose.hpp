@@ -37,6 +37,11 @@ int get_verbose();
 bool get_verbose_timestamp();
 double get_msec();
 
+// Prints an info line with the verbose prefix and, if enabled, the timestamp:
+// `onednn_verbose[,timestamp],info,<message>`. The message is formatted as
+// in printf.
+void verbose_printf_info(const char *fmt, ...);
+
 /// A container for primitive desc verbose string.
 struct primitive_desc_t;
 struct pd_info_t {
@@ -23,6 +23,10 @@
 #include "cpu/cpu_memory_storage.hpp"
 #include "cpu/cpu_stream.hpp"
 
+#if DNNL_X64
+#include "cpu/x64/cpu_isa_traits.hpp"
+#endif
+
 namespace dnnl {
 namespace impl {
 namespace cpu {
@@ -52,6 +56,24 @@ status_t cpu_engine_t::create_stream(stream_t **stream,
 }
 #endif
 
+status_t cpu_engine_t::serialize_device(
+        serialization_stream_t &sstream) const {
+    // JIT code stored in a cache blob is valid only for the ISA it was
+    // generated for, hence the effective ISA and the hints are a part of the
+    // device signature.
+    const auto isa = platform::get_effective_cpu_isa();
+    sstream.write(&isa);
+    const auto isa_hints = platform::get_cpu_isa_hints();
+    sstream.write(&isa_hints);
+#if DNNL_X64
+    const auto &cpu = x64::cpu();
+    const int cpu_signature[]
+            = {cpu.displayFamily, cpu.displayModel, cpu.stepping};
+    sstream.write(cpu_signature, sizeof(cpu_signature) / sizeof(int));
+#endif
+    return status::success;
+}
+
 engine_t *get_service_engine() {
     static std::unique_ptr<engine_t, engine_deleter_t> cpu_engine;
     static std::once_flag initialized;
@@ -26,6 +26,7 @@
 #include "common/engine.hpp"
 #include "common/engine_id.hpp"
 #include "common/impl_list_item.hpp"
+#include "common/serialization_stream.hpp"
 
 #include "cpu/platform.hpp"
 
@@ -152,6 +153,8 @@ public:
         return {};
     }
 
+    status_t serialize_device(serialization_stream_t &sstream) const override;
+
 protected:
     ~cpu_engine_t() override = default;
 };
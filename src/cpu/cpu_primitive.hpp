@@ -130,4 +130,35 @@
 #define DEFINE_ZERO_POINT_VALUE(zero_point, mem_arg) \
     DEFINE_ZERO_POINT_VALUE_ATTR(pd()->attr(), zero_point, mem_arg)
 
+#define DEFINE_ROUNDING_SEED_ATTR(attr, seed) \
+    uint32_t seed = 0; \
+    if (!attr->rounding_mode_.has_default_values()) { \
+        const auto seed_d = ctx.memory_mdw(DNNL_ARG_ATTR_ROUNDING_SEED); \
+        bool ok = seed_d.data_type() == data_type::s32 \
+                && seed_d.nelems() == 1; \
+        if (!ok) return status::invalid_arguments; \
+        const int32_t *seed_ptr \
+                = CTX_IN_MEM(const int32_t *, DNNL_ARG_ATTR_ROUNDING_SEED); \
+        if (seed_ptr == nullptr) return status::invalid_arguments; \
+        seed = static_cast<uint32_t>(*seed_ptr); \
+    } \
+    MAYBE_UNUSED(seed);
+
+#define DEFINE_ROUNDING_SEED(seed) DEFINE_ROUNDING_SEED_ATTR(pd()->attr(), seed)
+
+#define DEFINE_DST_AMAX_BUFFER_ATTR(attr, dst_amax) \
+    float *dst_amax = nullptr; \
+    if (!attr->dst_amax_params_.has_default_values()) { \
+        const auto amax_d = ctx.memory_mdw(DNNL_ARG_DST_AMAX); \
+        bool ok = amax_d.data_type() == data_type::f32 \
+                && amax_d.nelems() == 1; \
+        if (!ok) return status::invalid_arguments; \
+        dst_amax = CTX_OUT_MEM(float *, DNNL_ARG_DST_AMAX); \
+        if (dst_amax == nullptr) return status::invalid_arguments; \
+    } \
+    MAYBE_UNUSED(dst_amax);
+
+#define DEFINE_DST_AMAX_BUFFER(dst_amax) \
+    DEFINE_DST_AMAX_BUFFER_ATTR(pd()->attr(), dst_amax)
+
 #endif // CPU_CPU_PRIMITIVE_HPP
@@ -22,9 +22,11 @@
 #include "cpu/matmul/gemm_x8s8s32x_matmul.hpp"
 #include "cpu/matmul/ref_matmul.hpp"
 #include "cpu/matmul/ref_matmul_int8.hpp"
+#include "cpu/matmul/ref_sparse_matmul.hpp"
 
 #if DNNL_X64
 #include "cpu/x64/matmul/brgemm_matmul.hpp"
+#include "cpu/x64/matmul/jit_uni_sparse_matmul.hpp"
 using namespace dnnl::impl::cpu::x64::matmul;
 using namespace dnnl::impl::cpu::x64;
 #elif DNNL_AARCH64 && DNNL_AARCH64_USE_ACL
@@ -34,6 +36,12 @@ using namespace dnnl::impl::cpu::aarch64;
 
 #endif
 
+#ifdef DNNL_EXPERIMENTAL_SPARSE
+#define CPU_INSTANCE_SPARSE(...) __VA_ARGS__
+#else
+#define CPU_INSTANCE_SPARSE(...)
+#endif
+
 namespace dnnl {
 namespace impl {
 namespace cpu {
@@ -44,6 +52,9 @@ using namespace dnnl::impl::cpu::matmul;
 
 // clang-format off
 constexpr impl_list_item_t impl_list[] = REG_MATMUL_P({
+        CPU_INSTANCE_SPARSE(CPU_INSTANCE_AVX512(jit_uni_sparse_matmul_t<avx512_core>))
+        CPU_INSTANCE_SPARSE(CPU_INSTANCE_AVX2(jit_uni_sparse_matmul_t<avx2>))
+        CPU_INSTANCE_SPARSE(CPU_INSTANCE(ref_sparse_matmul_t))
         CPU_INSTANCE_AARCH64_ACL(acl_matmul_t)
         CPU_INSTANCE_AMX(brgemm_matmul_t<avx512_core_amx_fp16>)
         CPU_INSTANCE_AMX(brgemm_matmul_t<avx512_core_amx>)
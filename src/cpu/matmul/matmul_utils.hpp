@@ -18,7 +18,11 @@
 #ifndef CPU_MATMUL_UTILS_HPP
 #define CPU_MATMUL_UTILS_HPP
 
+#include <algorithm>
+
+#include "common/dnnl_thread.hpp"
 #include "common/memory_desc_wrapper.hpp"
+#include "common/primitive.hpp"
 #include "common/utils.hpp"
 
 #include "cpu/binary_injector_utils.hpp"
@@ -166,6 +170,60 @@ private:
     }
 };
 
+// Splits the rows of a CSR matrix with `nrows` rows and row `pointers`
+// between `nthr` threads so that each thread gets a contiguous range of rows
+// with about the same number of non-zero entries. Unlike `balance211()` on
+// rows, this keeps the threads equally loaded when the non-zero entries are
+// unevenly distributed across the rows.
+inline void balance_csr_rows(dim_t nrows, const int32_t *pointers, int nthr,
+        int ithr, dim_t &row_start, dim_t &row_end) {
+    const dim_t nnz = pointers[nrows] - pointers[0];
+    // Returns the first row that starts at or after the `work`-th entry.
+    auto find_row = [&](dim_t work) -> dim_t {
+        if (work >= nnz) return nrows;
+        const int32_t *p = std::lower_bound(
+                pointers, pointers + nrows, pointers[0] + work);
+        return p - pointers;
+    };
+    if (nnz == 0) {
+        balance211(nrows, nthr, ithr, row_start, row_end);
+        return;
+    }
+    row_start = ithr == 0 ? 0 : find_row(nnz * ithr / nthr);
+    row_end = ithr == nthr - 1 ? nrows : find_row(nnz * (ithr + 1) / nthr);
+}
+
+// The paged weights are split into pages along K when the stride of K is not
+// smaller than the stride of N, and along N otherwise.
+inline bool is_wei_paged_along_k(const memory_desc_wrapper &wei_d) {
+    const int ndims = wei_d.ndims();
+    const auto &strides = wei_d.blocking_desc().strides;
+    return strides[ndims - 2] >= strides[ndims - 1];
+}
+
+// Returns the page table of the paged weights after checking that it holds
+// an s32 entry for every page of the paged dimension.
+inline status_t get_wei_page_table(const exec_ctx_t &ctx,
+        const memory_desc_wrapper &wei_d, dim_t page_size,
+        const int32_t *&page_table) {
+    const int ndims = wei_d.ndims();
+    const dim_t paged_dim = is_wei_paged_along_k(wei_d)
+            ? wei_d.dims()[ndims - 2]
+            : wei_d.dims()[ndims - 1];
+    const auto pt_d = ctx.memory_mdw(DNNL_ARG_WEIGHTS_PAGE_TABLE);
+    if (pt_d.data_type() != data_type::s32
+            || pt_d.nelems() < utils::div_up(paged_dim, page_size))
+        return status::invalid_arguments;
+    page_table = CTX_IN_MEM(const int32_t *, DNNL_ARG_WEIGHTS_PAGE_TABLE);
+    return page_table ? status::success : status::invalid_arguments;
+}
+
+// Maps a logical index along the paged dimension to the physical one.
+inline dim_t get_wei_paged_idx(
+        const int32_t *page_table, dim_t page_size, dim_t idx) {
+    return page_table[idx / page_size] * page_size + idx % page_size;
+}
+
 } // namespace matmul
 } // namespace cpu
 } // namespace impl
@@ -18,6 +18,8 @@
 #include <float.h>
 #include <math.h>
 
+#include <vector>
+
 #include "common/c_types_map.hpp"
 #include "common/dnnl_thread.hpp"
 #include "common/math_utils.hpp"
@@ -45,6 +47,8 @@ status_t ref_matmul_t::execute_ref(const exec_ctx_t &ctx) const {
     DEFINE_ARG_SCALES_BUFFER(src_scales, DNNL_ARG_SRC);
     DEFINE_ARG_SCALES_BUFFER(wei_scales, DNNL_ARG_WEIGHTS);
     DEFINE_ARG_SCALES_BUFFER(dst_scales, DNNL_ARG_DST);
+    DEFINE_DST_AMAX_BUFFER(dst_amax);
+    if (dst_amax) *dst_amax = 0.f;
 
     const auto src_d = ctx.memory_mdw(DNNL_ARG_SRC, pd()->src_md());
     const auto weights_d = ctx.memory_mdw(DNNL_ARG_WEIGHTS, pd()->weights_md());
@@ -65,6 +69,18 @@ status_t ref_matmul_t::execute_ref(const exec_ctx_t &ctx) const {
     const dim_t K = helper.K();
     const dim_t batch = helper.batch();
 
+    // The pages of the weights are located through the page table.
+    const bool with_paged_wei = pd()->with_paged_weights();
+    const dim_t wei_page_size
+            = pd()->attr()->weights_paging_params_.page_size_;
+    const int32_t *wei_page_table = nullptr;
+    if (with_paged_wei)
+        CHECK(get_wei_page_table(
+                ctx, weights_d, wei_page_size, wei_page_table));
+    const bool is_wei_paged_k
+            = with_paged_wei && is_wei_paged_along_k(weights_d);
+    const bool is_wei_paged_n = with_paged_wei && !is_wei_paged_k;
+
     const int src_mask
             = utils::get_dims_mask(dst_d.dims(), src_d.dims(), ndims);
     const int wei_mask
@@ -80,12 +96,16 @@ status_t ref_matmul_t::execute_ref(const exec_ctx_t &ctx) const {
         utils::copy_dims_with_mask(
                 weights_dims_idx, dst_dims_idx, ndims, wei_mask);
         src_dims_idx[ndims - 2] = m;
-        weights_dims_idx[ndims - 1] = n;
+        weights_dims_idx[ndims - 1] = is_wei_paged_n
+                ? get_wei_paged_idx(wei_page_table, wei_page_size, n)
+                : n;
         auto &src_k_dim = src_dims_idx[ndims - 1];
         auto &wei_k_dim = weights_dims_idx[ndims - 2];
         for (dim_t k = 0; k < K; ++k) {
             src_k_dim = k;
-            wei_k_dim = k;
+            wei_k_dim = is_wei_paged_k
+                    ? get_wei_paged_idx(wei_page_table, wei_page_size, k)
+                    : k;
             const auto src_off = src_d.off_v(src_dims_idx);
             const auto weights_off = weights_d.off_v(weights_dims_idx);
             const float s
@@ -118,8 +138,16 @@ status_t ref_matmul_t::execute_ref(const exec_ctx_t &ctx) const {
 
     auto sum_dt = pd()->attr()->post_ops_.get_sum_dt(dst_d.data_type());
 
+    DEFINE_ROUNDING_SEED(rnd_seed);
+    const bool with_dst_sround
+            = pd()->attr()->rounding_mode_.is_stochastic(DNNL_ARG_DST);
+
+    const int nthr = dnnl_get_current_num_threads();
+    std::vector<float> amax_partial(dst_amax ? nthr : 0, 0.f);
+
     // computations
-    parallel_nd(batch, M, N, [&](dim_t mb, dim_t m, dim_t n) {
+    parallel_nd_ext(nthr, batch, M, N, [&](int ithr, int, dim_t mb, dim_t m,
+                                               dim_t n) {
         dims_t dst_dims_idx;
         // account for M, N dims for index calculations
         const size_t l_offset = mb * M * N + m * N + n;
@@ -138,11 +166,23 @@ status_t ref_matmul_t::execute_ref(const exec_ctx_t &ctx) const {
             args.dst_md = pd()->dst_md();
             ref_post_ops->execute(d, args);
         }
+        if (dst_amax)
+            amax_partial[ithr] = nstl::max(amax_partial[ithr], ::fabsf(d));
         if (with_dst_scales) d *= dst_scales[0];
+        if (with_dst_sround)
+            d = math::stochastic_round_fwd(
+                    d, l_offset, rnd_seed, dst_d.data_type());
         io::store_float_value(dst_d.data_type(), d, dst, dst_off);
         utils::dim_iterator(dst_d.dims(), dst_dims_idx, batch_ndims);
     });
 
+    if (dst_amax) {
+        float amax = 0.f;
+        for (const float v : amax_partial)
+            amax = nstl::max(amax, v);
+        *dst_amax = amax;
+    }
+
     return status::success;
 }
 
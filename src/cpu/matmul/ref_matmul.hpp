@@ -49,10 +49,12 @@ struct ref_matmul_t : public primitive_t {
             const auto bia_type = weights_md(1)->data_type;
             const auto dst_type = dst_md(0)->data_type;
 
+            // The 8-bit floating-point weights are up-converted on loading.
+            const bool is_f8_wei = utils::one_of(wei_type, f8_e5m2, f8_e4m3);
             bool ok = utils::one_of(src_type, f32, bf16, f16)
-                    && utils::one_of(wei_type, f32, bf16, f16)
+                    && utils::one_of(wei_type, f32, bf16, f16, f8_e5m2, f8_e4m3)
                     && utils::one_of(dst_type, f32, bf16, f16)
-                    && src_type == wei_type
+                    && (src_type == wei_type || is_f8_wei)
                     && IMPLICATION(src_type == f32, dst_type == f32)
                     && IMPLICATION(src_type == bf16,
                             utils::one_of(dst_type, f32, bf16))
@@ -68,10 +70,16 @@ struct ref_matmul_t : public primitive_t {
                                             utils::one_of(bia_type, f32, bf16)))
                     && platform::has_data_type_support(src_type)
                     && attr()->has_default_values(smask_t::scales_runtime
-                                    | smask_t::post_ops | smask_t::sum_dt,
+                                    | smask_t::post_ops | smask_t::sum_dt
+                                    | smask_t::weights_paging_params
+                                    | smask_t::rounding_mode
+                                    | smask_t::dst_amax_params,
                             dst_type)
+                    && attr_.rounding_mode_.stochastic_ok(
+                            DNNL_ARG_DST, dst_type)
                     && attr_.post_ops_.check_sum_consistent_dt(dst_type)
                     && attr_scales_ok() && set_default_formats()
+                    && paged_weights_ok()
                     && attr_.set_default_formats(dst_md(0)) == status::success;
             return ok ? status::success : status::unimplemented;
         }
@@ -70,6 +70,18 @@ status_t ref_matmul_int8_t::execute_ref(const exec_ctx_t &ctx) const {
     const dim_t K = helper.K();
     const dim_t batch = helper.batch();
 
+    // The pages of the weights are located through the page table.
+    const bool with_paged_wei = pd()->with_paged_weights();
+    const dim_t wei_page_size
+            = pd()->attr()->weights_paging_params_.page_size_;
+    const int32_t *wei_page_table = nullptr;
+    if (with_paged_wei)
+        CHECK(get_wei_page_table(
+                ctx, weights_d, wei_page_size, wei_page_table));
+    const bool is_wei_paged_k
+            = with_paged_wei && is_wei_paged_along_k(weights_d);
+    const bool is_wei_paged_n = with_paged_wei && !is_wei_paged_k;
+
     const int src_mask
             = utils::get_dims_mask(dst_d.dims(), src_d.dims(), ndims);
     const int wei_mask
@@ -91,12 +103,16 @@ status_t ref_matmul_int8_t::execute_ref(const exec_ctx_t &ctx) const {
         utils::copy_dims_with_mask(
                 weights_dims_idx, dst_dims_idx, ndims, wei_mask);
         src_dims_idx[ndims - 2] = m;
-        weights_dims_idx[ndims - 1] = n;
+        weights_dims_idx[ndims - 1] = is_wei_paged_n
+                ? get_wei_paged_idx(wei_page_table, wei_page_size, n)
+                : n;
         auto &src_k_dim = src_dims_idx[ndims - 1];
         auto &wei_k_dim = weights_dims_idx[ndims - 2];
         for (dim_t k = 0; k < K; ++k) {
             src_k_dim = k;
-            wei_k_dim = k;
+            wei_k_dim = is_wei_paged_k
+                    ? get_wei_paged_idx(wei_page_table, wei_page_size, k)
+                    : k;
             const auto src_off = src_d.off_v(src_dims_idx);
             const auto weights_off = weights_d.off_v(weights_dims_idx);
             int s = io::load_int_value(src_d.data_type(), src, src_off);
@@ -0,0 +1,115 @@
+/*******************************************************************************
+* Copyright 2023 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "oneapi/dnnl/dnnl_config.h"
+
+#ifdef DNNL_EXPERIMENTAL_SPARSE
+
+#include <vector>
+
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/type_helpers.hpp"
+
+#include "cpu/ref_io_helper.hpp"
+
+#include "cpu/matmul/matmul_utils.hpp"
+#include "cpu/matmul/ref_sparse_matmul.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace matmul {
+
+status_t ref_sparse_matmul_t::execute(const exec_ctx_t &ctx) const {
+    status_t status = status::success;
+    auto dst = CTX_OUT_CLEAN_MEM(void *, DNNL_ARG_DST, status);
+    CHECK(status);
+
+    const auto src_dt = pd()->src_md(0)->data_type;
+    const auto wei_dt = pd()->weights_md(0)->data_type;
+    const auto dst_dt = pd()->dst_md(0)->data_type;
+
+    const dim_t M = pd()->M();
+    const dim_t N = pd()->N();
+    const dim_t K = pd()->K();
+
+    if (pd()->is_src_sparse()) {
+        const auto src_values
+                = CTX_IN_SPARSE_MEM(const void *, DNNL_ARG_SRC, 0);
+        const auto src_indices
+                = CTX_IN_SPARSE_MEM(const int32_t *, DNNL_ARG_SRC, 1);
+        const auto src_pointers
+                = CTX_IN_SPARSE_MEM(const int32_t *, DNNL_ARG_SRC, 2);
+        const auto weights = CTX_IN_MEM(const void *, DNNL_ARG_WEIGHTS);
+
+        parallel(0, [&](const int ithr, const int nthr) {
+            dim_t m_start {0}, m_end {0};
+            balance_csr_rows(M, src_pointers, nthr, ithr, m_start, m_end);
+            std::vector<float> acc(N);
+            for (dim_t m = m_start; m < m_end; m++) {
+                std::fill(acc.begin(), acc.end(), 0.f);
+                for (dim_t j = src_pointers[m]; j < src_pointers[m + 1]; j++) {
+                    const dim_t k = src_indices[j];
+                    const float a = io::load_float_value(src_dt, src_values, j);
+                    for (dim_t n = 0; n < N; n++)
+                        acc[n] += a
+                                * io::load_float_value(
+                                        wei_dt, weights, k * N + n);
+                }
+                for (dim_t n = 0; n < N; n++)
+                    io::store_float_value(dst_dt, acc[n], dst, m * N + n);
+            }
+        });
+    } else {
+        const auto src = CTX_IN_MEM(const void *, DNNL_ARG_SRC);
+        const auto wei_values
+                = CTX_IN_SPARSE_MEM(const void *, DNNL_ARG_WEIGHTS, 0);
+        const auto wei_indices
+                = CTX_IN_SPARSE_MEM(const int32_t *, DNNL_ARG_WEIGHTS, 1);
+        const auto wei_pointers
+                = CTX_IN_SPARSE_MEM(const int32_t *, DNNL_ARG_WEIGHTS, 2);
+
+        parallel(0, [&](const int ithr, const int nthr) {
+            dim_t m_start {0}, m_end {0};
+            balance211(M, nthr, ithr, m_start, m_end);
+            std::vector<float> acc(N);
+            for (dim_t m = m_start; m < m_end; m++) {
+                std::fill(acc.begin(), acc.end(), 0.f);
+                for (dim_t k = 0; k < K; k++) {
+                    const float a
+                            = io::load_float_value(src_dt, src, m * K + k);
+                    if (a == 0.f) continue;
+                    for (dim_t j = wei_pointers[k]; j < wei_pointers[k + 1];
+                            j++)
+                        acc[wei_indices[j]] += a
+                                * io::load_float_value(wei_dt, wei_values, j);
+                }
+                for (dim_t n = 0; n < N; n++)
+                    io::store_float_value(dst_dt, acc[n], dst, m * N + n);
+            }
+        });
+    }
+
+    return status::success;
+}
+
+} // namespace matmul
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
@@ -0,0 +1,110 @@
+/*******************************************************************************
+* Copyright 2023 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_MATMUL_REF_SPARSE_MATMUL_HPP
+#define CPU_MATMUL_REF_SPARSE_MATMUL_HPP
+
+#include "oneapi/dnnl/dnnl_config.h"
+
+#ifdef DNNL_EXPERIMENTAL_SPARSE
+
+#include "common/c_types_map.hpp"
+#include "common/primitive.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/platform.hpp"
+
+#include "cpu/matmul/cpu_matmul_pd.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace matmul {
+
+// Multiplies a sparse matrix in the CSR encoding by a dense one. Either the
+// source or the weights can be sparse.
+struct ref_sparse_matmul_t : public primitive_t {
+    struct pd_t : public cpu_matmul_pd_t {
+        using cpu_matmul_pd_t::cpu_matmul_pd_t;
+
+        DECLARE_COMMON_PD_T("ref:any", ref_sparse_matmul_t);
+
+        status_t init(engine_t *engine) {
+            using namespace data_type;
+            const auto src_type = src_md(0)->data_type;
+            const auto wei_type = weights_md(0)->data_type;
+            const auto dst_type = dst_md(0)->data_type;
+
+            const bool ok = utils::one_of(src_type, f32, bf16, f16)
+                    && src_type == wei_type
+                    && utils::one_of(dst_type, f32, src_type)
+                    && platform::has_data_type_support(src_type)
+                    && ndims() == 2 && !with_bias()
+                    && !has_runtime_dims_or_strides()
+                    && attr()->has_default_values() && formats_ok();
+            return ok ? status::success : status::unimplemented;
+        }
+
+        bool is_src_sparse() const {
+            return memory_desc_wrapper(src_md(0)).is_sparse_desc();
+        }
+
+    private:
+        // Exactly one of the inputs is a CSR matrix with s32 metadata, the
+        // other tensors are plain.
+        bool formats_ok() {
+            const memory_desc_wrapper src_d(src_md(0));
+            const memory_desc_wrapper wei_d(weights_md(0));
+            if (src_d.is_sparse_desc() == wei_d.is_sparse_desc()) return false;
+
+            const memory_desc_wrapper sparse_d
+                    = src_d.is_sparse_desc() ? src_d : wei_d;
+            if (sparse_d.encoding() != sparse_encoding::csr
+                    || sparse_d.metadata_type(0) != data_type::s32
+                    || sparse_d.metadata_type(1) != data_type::s32)
+                return false;
+
+            auto &dense_md = src_d.is_sparse_desc() ? weights_md_ : src_md_;
+            for (auto md : {&dense_md, &dst_md_}) {
+                memory_desc_wrapper mdw(md);
+                if (mdw.format_any()
+                        && memory_desc_init_by_tag(*md, format_tag::ab)
+                                != status::success)
+                    return false;
+                if (!memory_desc_wrapper(md).matches_tag(format_tag::ab))
+                    return false;
+            }
+            return true;
+        }
+    };
+
+    ref_sparse_matmul_t(const pd_t *apd) : primitive_t(apd) {}
+
+    status_t execute(const exec_ctx_t &ctx) const override;
+
+private:
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+};
+
+} // namespace matmul
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+#endif
@@ -42,6 +42,7 @@ status_t ref_binary_t::execute_ref(const exec_ctx_t &ctx) const {
     const float *scales[2];
     ASSIGN_ARG_SCALE_VALUE(scales[0], DNNL_ARG_SRC_0);
     ASSIGN_ARG_SCALE_VALUE(scales[1], DNNL_ARG_SRC_1);
+    DEFINE_ROUNDING_SEED(rnd_seed);
 
     const memory_desc_wrapper src0_d(pd()->src_md(0));
     const memory_desc_wrapper src1_d(pd()->src_md(1));
@@ -56,6 +57,8 @@ status_t ref_binary_t::execute_ref(const exec_ctx_t &ctx) const {
     const auto nelems = dst_d.nelems();
     const auto ndims = pd()->ndims();
     const auto has_postops = pd()->attr()->post_ops_.len() != 0;
+    const bool with_dst_sround
+            = pd()->attr()->rounding_mode_.is_stochastic(DNNL_ARG_DST);
     const auto is_inplace
             = static_cast<const void *>(src0) == static_cast<void *>(dst);
     bool has_padding = false;
@@ -117,6 +120,8 @@ status_t ref_binary_t::execute_ref(const exec_ctx_t &ctx) const {
             ref_post_ops->execute(acc, args);
         }
 
+        if (with_dst_sround)
+            acc = math::stochastic_round_fwd(acc, i, rnd_seed, dst_dt);
         io::store_float_value(dst_dt, acc, dst, off_C);
     });
 
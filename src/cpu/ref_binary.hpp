@@ -48,8 +48,10 @@ struct ref_binary_t : public primitive_t {
                     && platform::has_data_type_support(src_md(1)->data_type)
                     && platform::has_data_type_support(dst_md()->data_type)
                     && set_default_params() == status::success
-                    && attr()->has_default_values(
-                            sm::post_ops | sm::scales_runtime)
+                    && attr()->has_default_values(sm::post_ops
+                            | sm::scales_runtime | sm::rounding_mode)
+                    && attr()->rounding_mode_.stochastic_ok(
+                            DNNL_ARG_DST, dst_md()->data_type)
                     && IMPLICATION(!attr()->scales_.has_default_values(),
                             check_scales_mask())
                     && attr_.set_default_formats(dst_md(0)) == status::success;
@@ -15,12 +15,16 @@
 *******************************************************************************/
 
 #include <assert.h>
+#include <math.h>
+
+#include <vector>
 
 #include "common/c_types_map.hpp"
 #include "common/dnnl_thread.hpp"
 #include "common/math_utils.hpp"
 #include "common/type_helpers.hpp"
 
+#include "cpu/cpu_primitive.hpp"
 #include "cpu/ref_eltwise.hpp"
 #include "cpu/simple_q10n.hpp"
 
@@ -81,6 +85,9 @@ status_t ref_eltwise_fwd_t<data_type>::execute_forward_nCspBc_padded(
 template <data_type_t data_type>
 status_t ref_eltwise_fwd_t<data_type>::execute_forward_generic(
         const exec_ctx_t &ctx) const {
+    DEFINE_DST_AMAX_BUFFER(dst_amax);
+    if (dst_amax) *dst_amax = 0.f;
+
     /* fast return */
     if (pd()->has_zero_dim_memory()) return status::success;
 
@@ -101,8 +108,15 @@ status_t ref_eltwise_fwd_t<data_type>::execute_forward_generic(
     const float beta = pd()->desc()->beta;
     const int ndims = pd()->ndims();
 
-    parallel_nd(
-            MB, C, D, H, W, [&](dim_t n, dim_t c, dim_t d, dim_t h, dim_t w) {
+    DEFINE_ROUNDING_SEED(rnd_seed);
+    const bool with_dst_sround
+            = pd()->attr()->rounding_mode_.is_stochastic(DNNL_ARG_DST);
+
+    const int nthr = dnnl_get_current_num_threads();
+    std::vector<float> amax_partial(dst_amax ? nthr : 0, 0.f);
+
+    parallel_nd_ext(nthr, MB, C, D, H, W,
+            [&](int ithr, int, dim_t n, dim_t c, dim_t d, dim_t h, dim_t w) {
                 auto data_p_off = DATA_OFF(src_d, n, c, d, h, w);
                 float res = compute_eltwise_scalar_fwd(
                         alg_kind, src[data_p_off], alpha, beta);
@@ -114,8 +128,21 @@ status_t ref_eltwise_fwd_t<data_type>::execute_forward_generic(
                 args.dst_md = pd()->dst_md();
                 ref_post_ops->execute(res, args);
 
+                if (dst_amax)
+                    amax_partial[ithr]
+                            = nstl::max(amax_partial[ithr], ::fabsf(res));
+                if (with_dst_sround)
+                    res = math::stochastic_round_fwd(
+                            res, data_l_off, rnd_seed, data_type);
                 dst[data_p_off] = cpu::saturate_and_round<data_t>(res);
             });
+
+    if (dst_amax) {
+        float amax = 0.f;
+        for (const float v : amax_partial)
+            amax = nstl::max(amax, v);
+        *dst_amax = amax;
+    }
     return status::success;
 }
 
@@ -269,6 +296,8 @@ status_t ref_eltwise_bwd_t<data_type>::execute_backward_dense(
 template struct ref_eltwise_fwd_t<data_type::f32>;
 template struct ref_eltwise_fwd_t<data_type::bf16>;
 template struct ref_eltwise_fwd_t<data_type::f16>;
+template struct ref_eltwise_fwd_t<data_type::f8_e5m2>;
+template struct ref_eltwise_fwd_t<data_type::f8_e4m3>;
 template struct ref_eltwise_fwd_t<data_type::s32>;
 template struct ref_eltwise_fwd_t<data_type::s8>;
 template struct ref_eltwise_fwd_t<data_type::u8>;
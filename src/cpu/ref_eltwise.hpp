@@ -51,7 +51,11 @@ struct ref_eltwise_fwd_t : public primitive_t {
                     && utils::everyone_is(
                             data_type, src_md()->data_type, dst_md()->data_type)
                     && platform::has_data_type_support(data_type)
-                    && attr()->has_default_values(sm::post_ops)
+                    && attr()->has_default_values(
+                            sm::post_ops | sm::rounding_mode
+                            | sm::dst_amax_params)
+                    && attr()->rounding_mode_.stochastic_ok(
+                            DNNL_ARG_DST, data_type)
                     && set_default_formats_common() && src_d == dst_d
                     && attr_.set_default_formats(dst_md(0)) == status::success;
             if (!ok) return status::unimplemented;
@@ -67,7 +71,10 @@ struct ref_eltwise_fwd_t : public primitive_t {
                     && src_d.only_padded_dim(1) && src_d.is_dense(true);
 
             const auto &po = attr()->post_ops_;
-            if (has_zero_dim_memory() || !po.has_default_values())
+            const auto &rm = attr()->rounding_mode_;
+            const auto &amax = attr()->dst_amax_params_;
+            if (has_zero_dim_memory() || !po.has_default_values()
+                    || !rm.has_default_values() || !amax.has_default_values())
                 use_dense_ = use_nCspBc_padded_ = false;
 
             return status::success;
@@ -16,8 +16,10 @@
 
 #include "common/c_types_map.hpp"
 #include "common/dnnl_thread.hpp"
+#include "common/math_utils.hpp"
 #include "common/type_helpers.hpp"
 
+#include "cpu/cpu_primitive.hpp"
 #include "cpu/ref_io_helper.hpp"
 
 #include "cpu/ref_inner_product.hpp"
@@ -161,6 +163,10 @@ status_t ref_inner_product_bwd_weights_t::execute_backward_weights(
     const auto OC = pd()->OC();
     const auto IC = pd()->IC();
 
+    DEFINE_ROUNDING_SEED(rnd_seed);
+    const bool with_diff_wei_sround
+            = pd()->attr()->rounding_mode_.is_stochastic(DNNL_ARG_DIFF_WEIGHTS);
+
     parallel_nd(OC, IC, [&](dim_t oc, dim_t ic) {
         const dim_t KD = pd()->KD();
         const dim_t KH = pd()->KH();
@@ -182,6 +188,12 @@ status_t ref_inner_product_bwd_weights_t::execute_backward_weights(
             }
             const auto diff_wei_off = ref_ip_utils::get_weights_off(
                     diff_weights_d, ndims, oc, ic, kd, kh, kw);
+            if (with_diff_wei_sround) {
+                const dim_t l_off = (((oc * IC + ic) * KD + kd) * KH + kh) * KW
+                        + kw;
+                dw = math::stochastic_round_fwd(
+                        dw, l_off, rnd_seed, diff_weights_d.data_type());
+            }
             io::store_float_value(
                     diff_weights_d.data_type(), dw, diff_weights, diff_wei_off);
         }
@@ -131,6 +131,7 @@ struct ref_inner_product_bwd_weights_t : public primitive_t {
 
         status_t init(engine_t *engine) {
             using namespace data_type;
+            using smask_t = primitive_attr_t::skip_mask_t;
             const auto src_type = src_md(0)->data_type;
             const auto diff_wei_type = diff_weights_md(0)->data_type;
             const auto diff_bia_type = diff_weights_md(1)->data_type;
@@ -146,7 +147,10 @@ struct ref_inner_product_bwd_weights_t : public primitive_t {
                     && utils::one_of(diff_wei_type, f32, src_type)
                     && IMPLICATION(with_bias(),
                             utils::one_of(diff_bia_type, f32, src_type))
-                    && diff_dst_type == src_type && attr()->has_default_values()
+                    && diff_dst_type == src_type
+                    && attr()->has_default_values(smask_t::rounding_mode)
+                    && attr()->rounding_mode_.stochastic_ok(
+                            DNNL_ARG_DIFF_WEIGHTS, diff_wei_type)
                     && set_default_params(allow_all_tags) == status::success;
             return ok ? status::success : status::unimplemented;
         }
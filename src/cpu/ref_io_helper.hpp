@@ -61,10 +61,20 @@ inline float load_float_value(data_type_t dt, const void *ptr, dim_t idx) {
     switch (dt) {
         CASE(bf16);
         CASE(f16);
+        CASE(f8_e5m2);
+        CASE(f8_e4m3);
         CASE(f32);
         CASE(s32);
         CASE(s8);
         CASE(u8);
+        case s4:
+        case u4: {
+            // Two values share a byte, the first one is in the lower half.
+            const uint8_t byte
+                    = reinterpret_cast<const uint8_t *>(ptr)[idx / 2];
+            const int v = idx % 2 ? byte >> 4 : byte & 0xf;
+            return static_cast<float>(dt == s4 ? (v ^ 8) - 8 : v);
+        }
         default: assert(!"bad data_type");
     }
 
@@ -85,6 +95,8 @@ inline void store_float_value(data_type_t dt, float val, void *ptr, dim_t idx) {
     switch (dt) {
         CASE(bf16);
         CASE(f16);
+        CASE(f8_e5m2);
+        CASE(f8_e4m3);
         CASE(f32);
         CASE(s32);
         CASE(s8);
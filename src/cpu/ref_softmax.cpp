@@ -45,6 +45,7 @@ status_t ref_softmax_fwd_t::execute_forward_dense(const exec_ctx_t &ctx) const {
 
     DEFINE_ARG_SCALES_BUFFER(src_scales, DNNL_ARG_SRC);
     DEFINE_ARG_SCALES_BUFFER(dst_scales, DNNL_ARG_DST);
+    DEFINE_ZERO_POINT_VALUE(dst_zero_point, DNNL_ARG_DST);
 
     float *scratchpad_int8 = ctx.get_scratchpad_grantor().template get<float>(
             key_softmax_interim_store);
@@ -166,7 +167,7 @@ status_t ref_softmax_fwd_t::execute_forward_dense(const exec_ctx_t &ctx) const {
             } else if (pd()->is_logsoftmax()) {
                 val = d - space_denom;
             }
-            val *= src_scales[0] * dst_scales[0];
+            val = val * src_scales[0] * dst_scales[0] + dst_zero_point;
             io::store_float_value(dst_d.data_type(), val, dst_data, c);
         }
         if (zero_padding) {
@@ -188,6 +189,7 @@ status_t ref_softmax_fwd_t::execute_forward_generic(
 
     DEFINE_ARG_SCALES_BUFFER(src_scales, DNNL_ARG_SRC);
     DEFINE_ARG_SCALES_BUFFER(dst_scales, DNNL_ARG_DST);
+    DEFINE_ZERO_POINT_VALUE(dst_zero_point, DNNL_ARG_DST);
 
     float *scratchpad_int8 = ctx.get_scratchpad_grantor().template get<float>(
             key_softmax_interim_store);
@@ -279,7 +281,7 @@ status_t ref_softmax_fwd_t::execute_forward_generic(
                 } else if (pd()->is_logsoftmax()) {
                     d -= sd;
                 }
-                d *= src_scales[0] * dst_scales[0];
+                d = d * src_scales[0] * dst_scales[0] + dst_zero_point;
                 io::store_float_value(dst_d.data_type(), d, dst, dst_off);
             }
         }
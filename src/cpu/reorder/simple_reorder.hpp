@@ -2090,7 +2090,9 @@ struct simple_reorder_impl<SIMPLE_REORDER_TEMPL_CALL,
                 && !input_d.is_additional_buffer()
                 && attr->has_default_values(skip_mask_t::scales_runtime
                         | skip_mask_t::zero_points_runtime
-                        | skip_mask_t::post_ops)
+                        | skip_mask_t::post_ops | skip_mask_t::rounding_mode)
+                && attr->rounding_mode_.stochastic_ok(
+                        DNNL_ARG_DST, output_d.data_type())
                 && simple_po_check(attr);
     }
 
@@ -2104,6 +2106,10 @@ struct simple_reorder_impl<SIMPLE_REORDER_TEMPL_CALL,
         // TODO: apply zero padding inside parallel_nd()
         ctx.zero_pad_output(DNNL_ARG_TO);
 
+        DEFINE_ROUNDING_SEED_ATTR(pd->attr(), rnd_seed);
+        const bool with_dst_sround
+                = pd->attr()->rounding_mode_.is_stochastic(DNNL_ARG_DST);
+
         parallel_nd(D_start, D_mask, D_rest,
                 [&](ptrdiff_t ds, ptrdiff_t dm, ptrdiff_t dr) {
                     const float src_scale
@@ -2118,6 +2124,9 @@ struct simple_reorder_impl<SIMPLE_REORDER_TEMPL_CALL,
                     float f = src_scale * ((float)i - src_zp);
                     if (beta) f += beta * o;
                     f = f * dst_scale + dst_zp;
+                    if (with_dst_sround)
+                        f = math::stochastic_round_fwd(
+                                f, e, rnd_seed, type_o);
                     o = _qz_a1b0<data_type::f32, type_o>()(f);
                 });
 
@@ -2145,7 +2154,8 @@ struct simple_reorder_t : public primitive_t {
                     && attr->has_default_values(skip_mask_t::scales_runtime
                             | skip_mask_t::zero_points
                             | skip_mask_t::zero_points_runtime
-                            | skip_mask_t::post_ops)
+                            | skip_mask_t::post_ops
+                            | skip_mask_t::rounding_mode)
                     && simple_reorder_impl<SIMPLE_REORDER_TEMPL_CALL,
                             spec>::is_applicable(src_md, dst_md, attr);
             if (!args_ok) return status::invalid_arguments;
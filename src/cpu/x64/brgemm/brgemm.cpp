@@ -108,6 +108,9 @@ void brgemm_kernel_execute_postops(const brgemm_kernel_t *brg_kernel, int bs,
     brgemm_p.b_zp_compensations = post_ops_data.b_zp_compensations;
     brgemm_p.c_zp_values = post_ops_data.c_zp_values;
     brgemm_p.ptr_dst_scales = post_ops_data.dst_scales;
+    brgemm_p.ptr_src_row_scales = post_ops_data.src_row_scales;
+    brgemm_p.b_zp_values = post_ops_data.b_zp_values;
+    brgemm_p.ptr_dst_amax = post_ops_data.dst_amax;
     assert(brg_kernel);
     (*brg_kernel)(&brgemm_p);
 }
@@ -142,6 +145,9 @@ void brgemm_kernel_execute_postops(const brgemm_kernel_t *brg_kernel, int bs,
     brgemm_p.b_zp_compensations = post_ops_data.b_zp_compensations;
     brgemm_p.c_zp_values = post_ops_data.c_zp_values;
     brgemm_p.ptr_dst_scales = post_ops_data.dst_scales;
+    brgemm_p.ptr_src_row_scales = post_ops_data.src_row_scales;
+    brgemm_p.b_zp_values = post_ops_data.b_zp_values;
+    brgemm_p.ptr_dst_amax = post_ops_data.dst_amax;
     assert(brg_kernel);
     (*brg_kernel)(&brgemm_p);
 }
@@ -0,0 +1,94 @@
+/*******************************************************************************
+* Copyright 2023 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "common/verbose.hpp"
+
+#include "cpu/x64/brgemm/brgemm.hpp"
+#include "cpu/x64/brgemm/brgemm_containers.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+namespace brgemm_containers {
+
+brgemm_kernel_container_t::~brgemm_kernel_container_t() {
+    for (size_t i = 0; i < size_; i++)
+        brgemm_kernel_destroy(entries_[i].kernel.load());
+}
+
+void brgemm_kernel_container_t::resize(size_t n, const char *name) {
+    for (size_t i = 0; i < size_; i++)
+        brgemm_kernel_destroy(entries_[i].kernel.load());
+    entries_.reset(n ? new entry_t[n] : nullptr);
+    size_ = n;
+    name_ = name ? name : "";
+    num_registered_ = 0;
+    num_materialized_ = 0;
+    status_ = status::success;
+}
+
+status_t brgemm_kernel_container_t::insert(
+        size_t idx, const brgemm_t &brg, bool lazy) {
+    if (idx >= size_) return status::invalid_arguments;
+    auto &e = entries_[idx];
+    if (e.brg) return status::success;
+
+    e.brg = &brg;
+    num_registered_++;
+    if (lazy) return status::success;
+
+    brgemm_kernel_t *kernel = nullptr;
+    const status_t st = brgemm_kernel_create(&kernel, brg);
+    if (st != status::success) {
+        e.brg = nullptr;
+        num_registered_--;
+        return st;
+    }
+    e.kernel.store(kernel, std::memory_order_release);
+    num_materialized_++;
+    return status::success;
+}
+
+const brgemm_kernel_t *brgemm_kernel_container_t::materialize(
+        size_t idx) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto &e = entries_[idx];
+    // The kernel might have been generated by another thread meanwhile.
+    brgemm_kernel_t *kernel = e.kernel.load(std::memory_order_acquire);
+    if (kernel) return kernel;
+    // Don't retry the generation that has already failed once.
+    if (status_.load() != status::success) return nullptr;
+
+    const status_t st = brgemm_kernel_create(&kernel, *e.brg);
+    if (st != status::success) {
+        status_ = st;
+        return nullptr;
+    }
+    e.kernel.store(kernel, std::memory_order_release);
+    const int n = ++num_materialized_;
+
+    if (get_verbose() >= 2)
+        verbose_printf_info("cpu,brgemm,lazy_kernel:%s,materialized:%d/%d",
+                name_.c_str(), n, num_registered_);
+    return kernel;
+}
+
+} // namespace brgemm_containers
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
@@ -0,0 +1,104 @@
+/*******************************************************************************
+* Copyright 2023 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_X64_BRGEMM_BRGEMM_CONTAINERS_HPP
+#define CPU_X64_BRGEMM_BRGEMM_CONTAINERS_HPP
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <string>
+
+#include "common/c_types_map.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/x64/brgemm/brgemm_types.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+namespace brgemm_containers {
+
+// A set of brgemm kernels indexed by a primitive-specific kernel index.
+//
+// Kernels that are taken on every execution are generated when they are
+// inserted, i.e. at primitive creation. Kernels for rarely-taken tails can be
+// inserted lazily: only the descriptor is recorded and the kernel is generated
+// on its first use, which is safe to happen concurrently from several threads.
+//
+// The descriptors are not copied, so they must outlive the container. This is
+// the case for the descriptors that belong to a primitive descriptor.
+struct DNNL_API brgemm_kernel_container_t {
+    brgemm_kernel_container_t() = default;
+    ~brgemm_kernel_container_t();
+
+    // Resets the container to `n` empty slots. `name` is used for verbose
+    // reporting of lazily generated kernels.
+    void resize(size_t n, const char *name = "");
+    size_t size() const { return size_; }
+
+    // Registers a kernel for the descriptor `brg` at `idx`. A slot that is
+    // already registered is kept as is.
+    status_t insert(size_t idx, const brgemm_t &brg, bool lazy = false);
+    bool is_registered(size_t idx) const {
+        return idx < size_ && entries_[idx].brg != nullptr;
+    }
+
+    // Returns the kernel at `idx`, generating it if it was inserted lazily.
+    // Returns nullptr if the kernel generation failed, the error is reported
+    // by `status()` then.
+    const brgemm_kernel_t *get(size_t idx) const {
+        assert(is_registered(idx));
+        const brgemm_kernel_t *kernel
+                = entries_[idx].kernel.load(std::memory_order_acquire);
+        if (kernel) return kernel;
+        return materialize(idx);
+    }
+    const brgemm_kernel_t *operator[](size_t idx) const { return get(idx); }
+
+    // Returns the first error that happened during lazy kernel generation.
+    status_t status() const { return status_.load(); }
+
+    int num_registered() const { return num_registered_; }
+    int num_materialized() const { return num_materialized_.load(); }
+
+private:
+    struct entry_t {
+        const brgemm_t *brg = nullptr;
+        std::atomic<brgemm_kernel_t *> kernel {nullptr};
+    };
+
+    const brgemm_kernel_t *materialize(size_t idx) const;
+
+    std::unique_ptr<entry_t[]> entries_;
+    size_t size_ = 0;
+    std::string name_;
+    int num_registered_ = 0;
+    mutable std::atomic<int> num_materialized_ {0};
+    mutable std::atomic<status_t> status_ {status::success};
+    mutable std::mutex mutex_;
+
+    DNNL_DISALLOW_COPY_AND_ASSIGN(brgemm_kernel_container_t);
+};
+
+} // namespace brgemm_containers
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
@@ -17,6 +17,8 @@
 #ifndef CPU_X64_BRGEMM_BRGEMM_TYPES_HPP
 #define CPU_X64_BRGEMM_BRGEMM_TYPES_HPP
 
+#include <memory>
+
 #include "common/primitive_attr.hpp"
 #include "cpu/platform.hpp"
 #include "cpu/x64/cpu_isa_traits.hpp"
@@ -160,6 +162,11 @@ struct DNNL_API brgemm_attr_t {
     // If "true" then batchsize is allowed to change on each kernel call
     // and there is no unrolling by batchsize in kernel
     bool var_bs {false};
+    // If "true" then the batch size passed on kernel call may be zero, e.g.
+    // when the caller drops the batch elements whose B blocks are zeros only.
+    // In this case the kernel only initializes C and applies post-ops.
+    // Not supported by the AMX unrolled kernel.
+    bool allow_empty_batch {false};
     bool postops_only {false};
 
     int hint_bd_block {0};
@@ -250,6 +257,8 @@ struct brgemm_t {
     bool req_cal_comp_pads = false;
     bool req_s8s8_compensation = false;
     brgemm_broadcast_t zp_type_a = brgemm_broadcast_t::none;
+    // With per_n B zero points the compensation of a row is multiplied by the
+    // zero point of every column of B.
     brgemm_broadcast_t zp_type_b = brgemm_broadcast_t::none;
     brgemm_broadcast_t zp_type_c = brgemm_broadcast_t::none;
     brgemm_kernel_innermost_loop_t innermost_loop = brgemm_ld_loop_innermost;
@@ -269,6 +278,12 @@ struct brgemm_t {
 
     brgemm_prf_t prfA, prfB, prfC;
     bool with_dst_scales = false;
+    // Per-row scales applied to the accumulated values along with the
+    // regular scales, e.g. the scales of the rows of A quantized on the fly.
+    bool with_src_row_scales = false;
+    // Running maximum and minimum of the values after post-ops are stored to
+    // a per-thread buffer to compute the maximum absolute value of C.
+    bool with_dst_amax = false;
 
     bool is_row_major() const {
         assert(layout != brgemm_layout_undef);
@@ -388,6 +403,9 @@ struct brgemm_kernel_params_t {
     size_t skip_accm = 0;
     int32_t zp_a_val = 1;
     const void *ptr_dst_scales = nullptr;
+    const void *ptr_src_row_scales = nullptr;
+    const void *b_zp_values = nullptr;
+    void *ptr_dst_amax = nullptr;
 };
 
 template <cpu_isa_t isa, typename Vmm>
@@ -406,26 +424,30 @@ struct brgemm_kernel_t {
 template <cpu_isa_t isa, typename Vmm>
 struct brgemm_kernel_common_t : public brgemm_kernel_t {
     brgemm_kernel_common_t(const brgemm_t abrd);
-    ~brgemm_kernel_common_t();
 
     status_t create_kernel();
     void operator()(brgemm_kernel_params_t *) const;
 
 private:
-    jit_brgemm_kernel_t<isa, Vmm> *brgemm_kernel_ = nullptr;
+    brgemm_t brg_;
+    // The JIT kernel may be shared with other brgemm kernels with the same
+    // descriptor (see jit_kernel_registry_t).
+    std::shared_ptr<jit_brgemm_kernel_t<isa, Vmm>> brgemm_kernel_;
 
     DNNL_DISALLOW_COPY_AND_ASSIGN(brgemm_kernel_common_t);
 };
 
 struct brgemm_amx_uker_t : public brgemm_kernel_t {
     brgemm_amx_uker_t(const brgemm_t abrd);
-    ~brgemm_amx_uker_t();
 
     status_t create_kernel();
     void operator()(brgemm_kernel_params_t *) const;
 
 private:
-    jit_brgemm_amx_uker_base_t *brgemm_kernel_ = nullptr;
+    brgemm_t brg_;
+    // The JIT kernel may be shared with other brgemm kernels with the same
+    // descriptor (see jit_kernel_registry_t).
+    std::shared_ptr<jit_brgemm_amx_uker_base_t> brgemm_kernel_;
 
     DNNL_DISALLOW_COPY_AND_ASSIGN(brgemm_amx_uker_t);
 };
@@ -433,13 +455,15 @@ private:
 template <cpu_isa_t isa, typename Vmm>
 struct brdgmm_kernel_t : public brgemm_kernel_t {
     brdgmm_kernel_t(const brgemm_t abrd);
-    ~brdgmm_kernel_t();
 
     status_t create_kernel();
     void operator()(brgemm_kernel_params_t *) const;
 
 private:
-    jit_brdgmm_kernel_base_t<isa, Vmm> *brgemm_kernel_ = nullptr;
+    brgemm_t brg_;
+    // The JIT kernel may be shared with other brgemm kernels with the same
+    // descriptor (see jit_kernel_registry_t).
+    std::shared_ptr<jit_brdgmm_kernel_base_t<isa, Vmm>> brgemm_kernel_;
 
     DNNL_DISALLOW_COPY_AND_ASSIGN(brdgmm_kernel_t);
 };
@@ -473,6 +497,11 @@ private:
 /// @param dst_scales - Vector of inverted scale factor values for matix C,
 ///     common scale vector type only is supported, it must be broadcasted to
 ///     vector of simd width length.
+/// @param src_row_scales - Scale factor values for rows of matrix A.
+/// @param b_zp_values - B matrix zero point values for every column, used
+///     with per_n B zero points.
+/// @param dst_amax - Buffer of 2 * 16 float values for the running maximum and
+///     minimum of the values after post-ops, used with `with_dst_amax`.
 ///
 struct brgemm_post_ops_data_t {
     brgemm_post_ops_data_t() = default;
@@ -484,7 +513,9 @@ struct brgemm_post_ops_data_t {
             const void *b_zp_compensations = nullptr,
             const void *c_zp_values = nullptr, bool skip_accumulation = false,
             int32_t zp_a_val = 1, bool do_only_comp = false,
-            bool do_only_zp_a_val = false, const float *dst_scales = nullptr)
+            bool do_only_zp_a_val = false, const float *dst_scales = nullptr,
+            const float *src_row_scales = nullptr,
+            const int32_t *b_zp_values = nullptr, float *dst_amax = nullptr)
         : bias(bias)
         , scales(scales)
         , binary_post_ops_rhs(binary_post_ops_rhs)
@@ -499,7 +530,10 @@ struct brgemm_post_ops_data_t {
         , zp_a_val {zp_a_val}
         , do_only_comp {do_only_comp}
         , do_only_zp_a_val {do_only_zp_a_val}
-        , dst_scales(dst_scales) {}
+        , dst_scales(dst_scales)
+        , src_row_scales(src_row_scales)
+        , b_zp_values(b_zp_values)
+        , dst_amax(dst_amax) {}
 
     const void *bias = nullptr;
     const float *scales = nullptr;
@@ -516,6 +550,9 @@ struct brgemm_post_ops_data_t {
     const bool do_only_comp = false;
     const bool do_only_zp_a_val = false;
     const float *dst_scales = nullptr;
+    const float *src_row_scales = nullptr;
+    const int32_t *b_zp_values = nullptr;
+    float *dst_amax = nullptr;
 };
 
 } // namespace x64
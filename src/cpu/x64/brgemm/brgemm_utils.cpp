@@ -22,6 +22,7 @@
 #include "common/c_types_map.hpp"
 #include "common/dnnl_thread.hpp"
 #include "common/nstl.hpp"
+#include "common/serialization.hpp"
 #include "common/type_helpers.hpp"
 #include "common/utils.hpp"
 
@@ -83,7 +84,8 @@ bool can_dispatch_uker(const brgemm_t *brg) {
     return brg->is_tmm
             && one_of(brg->type, brgemm_addr, brgemm_offs, brgemm_static_offs)
             && brg->brgattr.use_uker
-            && !brg->brgattr.generate_skip_accumulation;
+            && !brg->brgattr.generate_skip_accumulation
+            && !brg->brgattr.allow_empty_batch;
 }
 
 void maybe_try_bf32(brgemm_t *brg) {
@@ -857,6 +859,155 @@ void init_brdgmm_conf(brgemm_t *brg, cpu_isa_t isa, brgemm_batch_kind_t type,
     brg->load_dim = N;
 }
 
+void serialize(serialization_stream_t &sstream, const brgemm_t &brg) {
+    const auto write_prf = [&](const brgemm_prf_t &prf) {
+        sstream.write(&prf.dist1);
+        sstream.write(&prf.dist2);
+    };
+
+    sstream.write(&brg.bcast_dim);
+    sstream.write(&brg.load_dim);
+    sstream.write(&brg.reduce_dim);
+    sstream.write(&brg.LDA);
+    sstream.write(&brg.LDB);
+    sstream.write(&brg.LDC);
+    sstream.write(&brg.LDD);
+    sstream.write(&brg.isa_user);
+    sstream.write(&brg.isa_impl);
+    sstream.write(&brg.LDA2);
+    sstream.write(&brg.LDB2);
+    sstream.write(&brg.LDC2_M);
+    sstream.write(&brg.LDC2_N);
+    sstream.write(&brg.is_blocked);
+    sstream.write(&brg.alpha);
+    sstream.write(&brg.beta);
+    sstream.write(&brg.bdb);
+    sstream.write(&brg.bd_block);
+    sstream.write(&brg.bdb_tail);
+    sstream.write(&brg.bdb2);
+    sstream.write(&brg.bd_block2);
+    sstream.write(&brg.bdb2_tail);
+    sstream.write(&brg.ldb);
+    sstream.write(&brg.ld_block);
+    sstream.write(&brg.ldb_tail);
+    sstream.write(&brg.ldb2);
+    sstream.write(&brg.ld_block2);
+    sstream.write(&brg.ldb2_tail);
+    sstream.write(&brg.rdb);
+    sstream.write(&brg.rd_block);
+    sstream.write(&brg.rdb_tail);
+    sstream.write(&brg.rd_step);
+    sstream.write(&brg.ld_step);
+    sstream.write(&brg.dt_a);
+    sstream.write(&brg.dt_c);
+    sstream.write(&brg.dt_b);
+    sstream.write(&brg.dt_d);
+    sstream.write(&brg.dt_bias);
+    sstream.write(&brg.typesize_A);
+    sstream.write(&brg.typesize_B);
+    sstream.write(&brg.typesize_C);
+    sstream.write(&brg.typesize_D);
+    sstream.write(&brg.typesize_bias);
+    sstream.write(&brg.is_ymm);
+    sstream.write(&brg.is_zmm);
+    sstream.write(&brg.is_tmm);
+    sstream.write(&brg.is_int8);
+    sstream.write(&brg.is_int8_tmm);
+    sstream.write(&brg.is_bf16);
+    sstream.write(&brg.is_bf16_tmm);
+    sstream.write(&brg.is_bf16_emu);
+    sstream.write(&brg.is_f16);
+    sstream.write(&brg.is_f16_tmm);
+    sstream.write(&brg.is_f32);
+    sstream.write(&brg.is_bf32);
+    sstream.write(&brg.has_vnni);
+    sstream.write(&brg.stride_a);
+    sstream.write(&brg.stride_b);
+    sstream.write(&brg.layout);
+    sstream.write(&brg.type);
+    sstream.write(&brg.load_nt_A);
+    sstream.write(&brg.load_nt_B);
+    sstream.write(&brg.embd_bcst);
+    sstream.write(&brg.is_dgmm);
+    sstream.write(&brg.with_bias);
+    sstream.write(&brg.with_sum);
+    sstream.write(&brg.sum_scale);
+    sstream.write(&brg.sum_zp);
+    sstream.write(&brg.sum_dt);
+    sstream.write(&brg.with_eltwise);
+    sstream.write(&brg.with_binary);
+    sstream.write(&brg.with_scales);
+    sstream.write(&brg.req_cal_comp_pads);
+    sstream.write(&brg.req_s8s8_compensation);
+    sstream.write(&brg.zp_type_a);
+    sstream.write(&brg.zp_type_b);
+    sstream.write(&brg.zp_type_c);
+    sstream.write(&brg.innermost_loop);
+    sstream.write(&brg.is_oc_scale);
+    sstream.write(&brg.is_M_tail);
+    sstream.write(&brg.interleave_tilestores_);
+    write_prf(brg.prfA);
+    write_prf(brg.prfB);
+    write_prf(brg.prfC);
+    sstream.write(&brg.with_dst_scales);
+    sstream.write(&brg.with_src_row_scales);
+    sstream.write(&brg.with_dst_amax);
+
+    // The attributes and the destination memory descriptor define post-ops.
+    const bool with_attr = brg.attr != nullptr;
+    sstream.write(&with_attr);
+    if (with_attr) serialization::serialize_attr(sstream, *brg.attr);
+    const bool with_dst_md = brg.dst_md != nullptr;
+    sstream.write(&with_dst_md);
+    if (with_dst_md) serialization::serialize_md(sstream, *brg.dst_md);
+
+    const auto &brgattr = brg.brgattr;
+    sstream.write(&brgattr.max_bs);
+    sstream.write(&brgattr.max_top_vpad);
+    sstream.write(&brgattr.max_bottom_vpad);
+    sstream.write(&brgattr.hint_expected_A_size);
+    sstream.write(&brgattr.hint_expected_B_size);
+    sstream.write(&brgattr.hint_expected_C_size);
+    sstream.write(&brgattr.hint_innermost_loop);
+    sstream.write(&brgattr.hint_loop_order);
+    sstream.write(&brgattr.hint_prefetching);
+    write_prf(brgattr.hint_prfA);
+    write_prf(brgattr.hint_prfB);
+    write_prf(brgattr.hint_prfC);
+    sstream.write(&brgattr.wary_tail_read);
+    sstream.write(&brgattr.generate_skip_accumulation);
+    sstream.write(&brgattr.bd_mask_level);
+    // The kernels read the mask and the static offsets at generation time,
+    // so their content defines the code.
+    if (brgattr.bd_mask_level && brgattr.bd_mask)
+        sstream.write(brgattr.bd_mask, brg.bcast_dim);
+    if (brg.type == brgemm_static_offs && brgattr.static_offsets) {
+        for (int i = 0; i < brgattr.max_bs; i++) {
+            sstream.write(&brgattr.static_offsets[i].offset.A);
+            sstream.write(&brgattr.static_offsets[i].offset.B);
+            sstream.write(&brgattr.static_offsets[i].vvpad.top);
+            sstream.write(&brgattr.static_offsets[i].vvpad.bottom);
+        }
+    }
+    sstream.write(&brgattr.use_uker);
+    sstream.write(&brgattr.use_interleave_stores);
+    sstream.write(&brgattr.fpmath_mode);
+    sstream.write(&brgattr.LDA2);
+    sstream.write(&brgattr.LDB2);
+    sstream.write(&brgattr.LDC2_M);
+    sstream.write(&brgattr.LDC2_N);
+    sstream.write(&brgattr.var_bs);
+    sstream.write(&brgattr.allow_empty_batch);
+    sstream.write(&brgattr.postops_only);
+    sstream.write(&brgattr.hint_bd_block);
+    sstream.write(&brgattr.hint_ld_block);
+    sstream.write(&brgattr.hint_bd_block2);
+    sstream.write(&brgattr.hint_ld_block2);
+    sstream.write(&brgattr.hint_load_nt_A);
+    sstream.write(&brgattr.hint_load_nt_B);
+    sstream.write(&brgattr.K_koef);
+}
+
 } // namespace brgemm_utils
 } // namespace x64
 } // namespace cpu
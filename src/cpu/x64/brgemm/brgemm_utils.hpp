@@ -20,8 +20,10 @@
 #include "cpu/x64/brgemm/brgemm.hpp"
 
 #include "cpu/x64/cpu_isa_traits.hpp"
+#include "cpu/x64/jit_kernel_registry.hpp"
 
 #include "common/c_types_map.hpp"
+#include "common/serialization_stream.hpp"
 
 namespace dnnl {
 namespace impl {
@@ -59,6 +61,24 @@ void init_brdgmm_conf(brgemm_t *brg, cpu_isa_t isa, brgemm_batch_kind_t type,
         float alpha, float beta, dim_t LDA, dim_t LDC, dim_t M, dim_t N,
         const brgemm_strides_t *strides = nullptr);
 
+// Writes all the fields of the brgemm descriptor that define the generated
+// kernel code, including the content of the referenced attributes, memory
+// descriptor, bd mask and static offsets.
+// NOTE: a new field of `brgemm_t` that affects the kernel code must be added
+// here, otherwise kernels with different code may be shared.
+void serialize(serialization_stream_t &sstream, const brgemm_t &brg);
+
+// Creates a JIT kernel for the brgemm descriptor or takes the kernel with
+// identical code created for another brgemm descriptor earlier.
+template <typename kernel_t>
+status_t get_or_create_kernel(
+        std::shared_ptr<kernel_t> &kernel, const brgemm_t &brg) {
+    serialization_stream_t key;
+    serialize(key, brg);
+    return jit_kernel_registry().get_or_create(
+            kernel, key, [&]() { return new kernel_t(brg); });
+}
+
 } // namespace brgemm_utils
 
 } // namespace x64
@@ -20,6 +20,7 @@
 #include "common/utils.hpp"
 
 #include "cpu/x64/brgemm/brgemm_types.hpp"
+#include "cpu/x64/brgemm/brgemm_utils.hpp"
 #include "cpu/x64/brgemm/jit_brdgmm_kernel.hpp"
 #include "cpu/x64/cpu_barrier.hpp"
 #include "cpu/x64/injectors/jit_uni_postops_injector.hpp"
@@ -1006,13 +1007,11 @@ void jit_brdgmm_kernel_base_t<isa, Wmm>::generate() {
 }
 
 template <cpu_isa_t isa, typename Wmm>
-brdgmm_kernel_t<isa, Wmm>::brdgmm_kernel_t(const brgemm_t abrd) {
-    brgemm_kernel_ = new jit_brdgmm_kernel_base_t<isa, Wmm>(abrd);
-}
+brdgmm_kernel_t<isa, Wmm>::brdgmm_kernel_t(const brgemm_t abrd) : brg_(abrd) {}
 
 template <cpu_isa_t isa, typename Wmm>
 status_t brdgmm_kernel_t<isa, Wmm>::create_kernel() {
-    return brgemm_kernel_->create_kernel();
+    return brgemm_utils::get_or_create_kernel(brgemm_kernel_, brg_);
 }
 
 template <cpu_isa_t isa, typename Wmm>
@@ -1021,11 +1020,6 @@ void brdgmm_kernel_t<isa, Wmm>::operator()(
     (*brgemm_kernel_)(params);
 }
 
-template <cpu_isa_t isa, typename Wmm>
-brdgmm_kernel_t<isa, Wmm>::~brdgmm_kernel_t() {
-    delete brgemm_kernel_;
-}
-
 template struct brdgmm_kernel_t<avx512_core_fp16, Xbyak::Zmm>;
 template struct brdgmm_kernel_t<avx512_core_bf16, Xbyak::Zmm>;
 template struct brdgmm_kernel_t<avx512_core_vnni, Xbyak::Zmm>;
@@ -23,6 +23,7 @@
 #include "cpu/platform.hpp"
 #include "cpu/x64/brgemm/brgemm.hpp"
 #include "cpu/x64/brgemm/brgemm_types.hpp"
+#include "cpu/x64/brgemm/brgemm_utils.hpp"
 #include "cpu/x64/injectors/jit_uni_postops_injector.hpp"
 #include "cpu/x64/jit_generator.hpp"
 
@@ -97,6 +98,12 @@ struct jit_brgemm_amx_uker_base_t : public jit_generator {
 
     DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_brgemm_amx_uker_base_t)
 
+    // Non-default sum scale and zero point are passed to the kernel by
+    // address of the `brg` fields.
+    bool is_relocatable() const override {
+        return !brg.with_sum || (brg.sum_scale == 1.f && brg.sum_zp == 0);
+    }
+
     brgemm_t brg;
 
 private:
@@ -2193,22 +2200,16 @@ void jit_brgemm_amx_uker_base_t::generate() {
     }
 }
 
-brgemm_amx_uker_t::brgemm_amx_uker_t(const brgemm_t abrd) {
-    brgemm_kernel_ = new jit_brgemm_amx_uker_base_t(abrd);
-}
+brgemm_amx_uker_t::brgemm_amx_uker_t(const brgemm_t abrd) : brg_(abrd) {}
 
 status_t brgemm_amx_uker_t::create_kernel() {
-    return brgemm_kernel_->create_kernel();
+    return brgemm_utils::get_or_create_kernel(brgemm_kernel_, brg_);
 }
 
 void brgemm_amx_uker_t::operator()(brgemm_kernel_params_t *params) const {
     (*brgemm_kernel_)(params);
 }
 
-brgemm_amx_uker_t::~brgemm_amx_uker_t() {
-    delete brgemm_kernel_;
-}
-
 } // namespace x64
 } // namespace cpu
 } // namespace impl
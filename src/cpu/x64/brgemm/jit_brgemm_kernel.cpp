@@ -23,6 +23,7 @@
 
 #include "cpu/platform.hpp"
 #include "cpu/x64/brgemm/brgemm_types.hpp"
+#include "cpu/x64/brgemm/brgemm_utils.hpp"
 #include "cpu/x64/cpu_barrier.hpp"
 #include "cpu/x64/injectors/jit_uni_postops_injector.hpp"
 #include "cpu/x64/jit_avx512_core_bf16cvt.hpp"
@@ -104,6 +105,12 @@ struct jit_brgemm_kernel_t : public jit_generator {
 
     DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_brgemm_kernel_t)
 
+    // Non-default sum scale and zero point are passed to the kernel by
+    // address of the `brg` fields.
+    bool is_relocatable() const override {
+        return !brg.with_sum || (brg.sum_scale == 1.f && brg.sum_zp == 0);
+    }
+
     brgemm_t brg;
 
 private:
@@ -174,9 +181,14 @@ private:
     const reg64_t reg_aux_zp_comp_b = reg_rdb_loop;
     const reg64_t reg_zp_c_values = reg_rdb_loop;
     const reg64_t reg_aux_zp_c_values = reg_rdb_loop;
+    const reg64_t reg_zp_b_values = reg_rdb_loop;
+    const reg64_t reg_aux_zp_b_values = reg_rdb_loop;
+    const reg64_t reg_src_row_scales = reg_rdb_loop;
+    const reg64_t reg_aux_src_row_scales = reg_rdb_loop;
 
     const reg64_t reg_aux_scales = reg_aux_B;
     const reg64_t reg_aux_dst_scales = reg_aux_B;
+    const reg64_t reg_aux_dst_amax = reg_aux_B;
     const reg64_t reg_do_post_ops = reg_rdb_loop;
     const reg64_t reg_do_comp = reg_rdb_loop;
     const reg64_t reg_skip_accm = reg_rdb_loop;
@@ -225,7 +237,12 @@ private:
     constexpr static int reg_zp_a_val_offs_ = 200;
     constexpr static int reg_do_comp_offs_ = 208;
     constexpr static int reg_dst_scales_offs_ = 216;
-    constexpr static int stack_space_needed_ = 224;
+    constexpr static int reg_src_row_scales_offs_ = 224;
+    constexpr static int reg_aux_src_row_scales_offs_ = 232;
+    constexpr static int reg_zp_b_values_offs_ = 240;
+    constexpr static int reg_aux_zp_b_values_offs_ = 248;
+    constexpr static int reg_dst_amax_offs_ = 256;
+    constexpr static int stack_space_needed_ = 264;
 
     bool is_ldb_loop_ = false;
     bool handle_binary_po_offset_ = false;
@@ -364,6 +381,9 @@ private:
     int zp_comp_b_offset(int bd) const noexcept;
     int bdb_zp_comp_b_offset(int bd_block2) const noexcept;
     int zp_c_values_offset(int ld, bool is_tail = false) const noexcept;
+    int zp_b_values_offset(int ld, bool is_tail = false) const noexcept;
+    int src_row_scales_offset(int bd) const noexcept;
+    int bdb_src_row_scales_offset(int bd_block2) const noexcept;
 
     bool n_bcast_1_load = false;
     bool vpad_exist = false;
@@ -535,6 +555,18 @@ int jit_brgemm_kernel_t<isa, Wmm>::bdb_zp_comp_b_offset(
     return zp_comp_b_offset(bd_block2 * brg.bd_block);
 }
 
+template <cpu_isa_t isa, typename Wmm>
+int jit_brgemm_kernel_t<isa, Wmm>::src_row_scales_offset(
+        int bd) const noexcept {
+    return sizeof(float) * bd;
+}
+
+template <cpu_isa_t isa, typename Wmm>
+int jit_brgemm_kernel_t<isa, Wmm>::bdb_src_row_scales_offset(
+        int bd_block2) const noexcept {
+    return src_row_scales_offset(bd_block2 * brg.bd_block);
+}
+
 template <cpu_isa_t isa, typename Wmm>
 int jit_brgemm_kernel_t<isa, Wmm>::zp_c_values_offset(
         int ld, bool is_tail) const noexcept {
@@ -545,6 +577,17 @@ int jit_brgemm_kernel_t<isa, Wmm>::zp_c_values_offset(
 
     return 0;
 }
+
+template <cpu_isa_t isa, typename Wmm>
+int jit_brgemm_kernel_t<isa, Wmm>::zp_b_values_offset(
+        int ld, bool is_tail) const noexcept {
+    if (brg.zp_type_b == brgemm_broadcast_t::per_n) {
+        return (is_tail) ? sizeof(int32_t) * brg.ldb_tail
+                         : sizeof(int32_t) * ld * brg.ld_block;
+    }
+
+    return 0;
+}
 template <cpu_isa_t isa, typename Wmm>
 typename jit_brgemm_kernel_t<isa, Wmm>::Vmm
 jit_brgemm_kernel_t<isa, Wmm>::vmm_mask(const Vmm vmm_in, bool mask_flag,
@@ -630,6 +673,11 @@ void jit_brgemm_kernel_t<isa, Wmm>::advance_ldb_post_op_regs() {
         add(reg_aux_zp_c_values, zp_c_values_offset(1));
         mov(ptr[rsp + reg_aux_zp_c_values_offs_], reg_aux_zp_c_values);
     }
+    if (brg.zp_type_b == brgemm_broadcast_t::per_n) {
+        mov(reg_aux_zp_b_values, ptr[rsp + reg_aux_zp_b_values_offs_]);
+        add(reg_aux_zp_b_values, zp_b_values_offset(1));
+        mov(ptr[rsp + reg_aux_zp_b_values_offs_], reg_aux_zp_b_values);
+    }
 }
 
 template <cpu_isa_t isa, typename Wmm>
@@ -661,6 +709,11 @@ void jit_brgemm_kernel_t<isa, Wmm>::restore_ldb_post_op_regs(int ld_block2) {
         sub(reg_aux_zp_c_values, zp_c_values_offset(ld_block2 - 1));
         mov(ptr[rsp + reg_aux_zp_c_values_offs_], reg_aux_zp_c_values);
     }
+    if (brg.zp_type_b == brgemm_broadcast_t::per_n) {
+        mov(reg_aux_zp_b_values, ptr[rsp + reg_aux_zp_b_values_offs_]);
+        sub(reg_aux_zp_b_values, zp_b_values_offset(ld_block2 - 1));
+        mov(ptr[rsp + reg_aux_zp_b_values_offs_], reg_aux_zp_b_values);
+    }
 }
 
 template <cpu_isa_t isa, typename Wmm>
@@ -670,6 +723,11 @@ void jit_brgemm_kernel_t<isa, Wmm>::advance_bdb_post_op_regs(int adj_bd_block) {
         add(reg_aux_zp_comp_b, bdb_zp_comp_b_offset(1));
         mov(ptr[rsp + reg_aux_zp_comp_b_offs_], reg_aux_zp_comp_b);
     }
+    if (brg.with_src_row_scales) {
+        mov(reg_aux_src_row_scales, ptr[rsp + reg_aux_src_row_scales_offs_]);
+        add(reg_aux_src_row_scales, bdb_src_row_scales_offset(1));
+        mov(ptr[rsp + reg_aux_src_row_scales_offs_], reg_aux_src_row_scales);
+    }
     if (with_binary_per_oc_sp_bcast_) {
         const injector_utils::register_preserve_guard_t register_guard(
                 this, {reg_aux_binary_postops_oc_l});
@@ -693,6 +751,15 @@ void jit_brgemm_kernel_t<isa, Wmm>::restore_bdb_post_op_regs(int bd_block2) {
             sub(reg_aux_zp_comp_b, bdb_zp_comp_b_offset(bd_block2 - 1));
             mov(ptr[rsp + reg_aux_zp_comp_b_offs_], reg_aux_zp_comp_b);
         }
+        if (brg.with_src_row_scales) {
+            post_processed = true;
+            mov(reg_aux_src_row_scales,
+                    ptr[rsp + reg_aux_src_row_scales_offs_]);
+            sub(reg_aux_src_row_scales,
+                    bdb_src_row_scales_offset(bd_block2 - 1));
+            mov(ptr[rsp + reg_aux_src_row_scales_offs_],
+                    reg_aux_src_row_scales);
+        }
         if (with_binary_per_oc_sp_bcast_) {
             post_processed = true;
             const injector_utils::register_preserve_guard_t register_guard(
@@ -771,6 +838,13 @@ void jit_brgemm_kernel_t<isa, Wmm>::ldb_regs_shift(
                           : zp_c_values_offset(ld_block2));
         mov(ptr[rsp + reg_aux_zp_c_values_offs_], reg_aux_zp_c_values);
     }
+    if (brg.zp_type_b == brgemm_broadcast_t::per_n) {
+        mov(reg_aux_zp_b_values, ptr[rsp + reg_aux_zp_b_values_offs_]);
+        add(reg_aux_zp_b_values,
+                (is_tail) ? zp_b_values_offset(1, true)
+                          : zp_b_values_offset(ld_block2));
+        mov(ptr[rsp + reg_aux_zp_b_values_offs_], reg_aux_zp_b_values);
+    }
 }
 
 template <cpu_isa_t isa, typename Wmm>
@@ -793,6 +867,11 @@ void jit_brgemm_kernel_t<isa, Wmm>::advance_bd_block2_post_op_regs(
         add(reg_zp_comp_b, bdb_zp_comp_b_offset(bd_block2));
         mov(ptr[rsp + reg_zp_comp_b_offs_], reg_zp_comp_b);
     }
+    if (brg.with_src_row_scales) {
+        mov(reg_src_row_scales, ptr[rsp + reg_src_row_scales_offs_]);
+        add(reg_src_row_scales, bdb_src_row_scales_offset(bd_block2));
+        mov(ptr[rsp + reg_src_row_scales_offs_], reg_src_row_scales);
+    }
 }
 
 template <cpu_isa_t isa, typename Wmm>
@@ -836,11 +915,20 @@ void jit_brgemm_kernel_t<isa, Wmm>::copy_post_ops_stack_values_to_aux(
             mov(reg_zp_c_values, ptr[rsp + reg_zp_c_values_offs_]);
             mov(ptr[rsp + reg_aux_zp_c_values_offs_], reg_zp_c_values);
         }
+
+        if (brg.zp_type_b == brgemm_broadcast_t::per_n) {
+            mov(reg_zp_b_values, ptr[rsp + reg_zp_b_values_offs_]);
+            mov(ptr[rsp + reg_aux_zp_b_values_offs_], reg_zp_b_values);
+        }
     }
     if (brg.zp_type_b != brgemm_broadcast_t::none) {
         mov(reg_zp_comp_b, ptr[rsp + reg_zp_comp_b_offs_]);
         mov(ptr[rsp + reg_aux_zp_comp_b_offs_], reg_zp_comp_b);
     }
+    if (brg.with_src_row_scales) {
+        mov(reg_src_row_scales, ptr[rsp + reg_src_row_scales_offs_]);
+        mov(ptr[rsp + reg_aux_src_row_scales_offs_], reg_src_row_scales);
+    }
     if (with_binary_per_oc_sp_bcast_) {
         mov(reg_aux_binary_postops_oc_l,
                 ptr[rsp + reg_binary_postops_oc_l_offs_]);
@@ -922,6 +1010,11 @@ void jit_brgemm_kernel_t<isa, Wmm>::read_params() {
         mov(ptr[rsp + reg_zp_comp_b_offs_], reg_zp_comp_b);
     }
 
+    if (brg.zp_type_b == brgemm_broadcast_t::per_n) {
+        mov(reg_zp_b_values, ptr[param1 + GET_OFF(b_zp_values)]);
+        mov(ptr[rsp + reg_zp_b_values_offs_], reg_zp_b_values);
+    }
+
     if (brg.zp_type_c != brgemm_broadcast_t::none) {
         mov(reg_zp_c_values, ptr[param1 + GET_OFF(c_zp_values)]);
         mov(ptr[rsp + reg_zp_c_values_offs_], reg_zp_c_values);
@@ -932,6 +1025,16 @@ void jit_brgemm_kernel_t<isa, Wmm>::read_params() {
         mov(ptr[rsp + reg_dst_scales_offs_], reg_dst_scales);
     }
 
+    if (brg.with_src_row_scales) {
+        mov(reg_src_row_scales, ptr[param1 + GET_OFF(ptr_src_row_scales)]);
+        mov(ptr[rsp + reg_src_row_scales_offs_], reg_src_row_scales);
+    }
+
+    if (brg.with_dst_amax) {
+        mov(reg_aux_dst_amax, ptr[param1 + GET_OFF(ptr_dst_amax)]);
+        mov(ptr[rsp + reg_dst_amax_offs_], reg_aux_dst_amax);
+    }
+
     mov(reg_do_post_ops, ptr[param1 + GET_OFF(do_post_ops)]);
     mov(ptr[rsp + reg_do_post_ops_offs_], reg_do_post_ops);
 
@@ -1166,6 +1269,21 @@ void jit_brgemm_kernel_t<isa, Wmm>::store_accumulators_apply_post_ops(
         }
     }
 
+    if (brg.with_src_row_scales) {
+        mov(reg_aux_src_row_scales, ptr[rsp + reg_aux_src_row_scales_offs_]);
+        for (int bd = 0; bd < bd_block; bd++) {
+            auto vmm_row_scale = vmm_tmp(0);
+            uni_vbroadcastss(vmm_row_scale,
+                    ptr[reg_aux_src_row_scales + src_row_scales_offset(bd)]);
+            for (int ld = 0; ld < ld_block2; ld++) {
+                auto vmm = accm(ld_block2, bd, ld);
+                if (dq2ps_required && !brg.with_scales)
+                    uni_vcvtdq2ps(vmm, vmm);
+                uni_vmulps(vmm, vmm, vmm_row_scale);
+            }
+        }
+    }
+
     if (brg.with_bias) { mov(reg_aux_bias, ptr[rsp + reg_aux_bias_offs_]); }
     for (int ld = 0; ld < ld_block2; ld++) {
         auto vmm_bias = vmm_tmp(0);
@@ -1177,7 +1295,8 @@ void jit_brgemm_kernel_t<isa, Wmm>::store_accumulators_apply_post_ops(
         }
         for (int bd = 0; bd < bd_block; bd++) {
             auto vmm = accm(ld_block2, bd, ld);
-            if (dq2ps_required && !brg.with_scales) uni_vcvtdq2ps(vmm, vmm);
+            if (dq2ps_required && !brg.with_scales && !brg.with_src_row_scales)
+                uni_vcvtdq2ps(vmm, vmm);
             if (brg.with_bias) uni_vaddps(vmm, vmm, vmm_bias);
         }
     }
@@ -1185,6 +1304,32 @@ void jit_brgemm_kernel_t<isa, Wmm>::store_accumulators_apply_post_ops(
     if (postops_injector_)
         apply_post_ops(bd_block, ld_block2, ldb_and_bdb_offset, is_ld_tail);
 
+    if (brg.with_dst_amax) {
+        // The running maximum and minimum are kept in two vectors of the
+        // thread buffer, the lanes beyond the tail are not updated.
+        assert(is_superset(brg.isa_impl, avx512_core));
+        mov(reg_aux_dst_amax, ptr[rsp + reg_dst_amax_offs_]);
+        auto vmm_range = vmm_tmp(0);
+        constexpr int min_offset = 16 * sizeof(float);
+        for (const bool is_max : {true, false}) {
+            const auto addr
+                    = ptr[reg_aux_dst_amax + (is_max ? 0 : min_offset)];
+            uni_vmovups(vmm_range, addr);
+            for_(int bd = 0; bd < bd_block; bd++)
+            for (int ld = 0; ld < ld_block2; ld++) {
+                const bool is_tail = is_ld_tail && ld + 1 == ld_block2;
+                const Vmm vmm_range_masked
+                        = vmm_mask(vmm_range, is_tail, true, k_mask);
+                auto vmm = accm(ld_block2, bd, ld);
+                if (is_max)
+                    vmaxps(vmm_range_masked, vmm_range, vmm);
+                else
+                    vminps(vmm_range_masked, vmm_range, vmm);
+            }
+            uni_vmovups(addr, vmm_range);
+        }
+    }
+
     if (brg.with_dst_scales) {
         mov(reg_aux_dst_scales, ptr[rsp + reg_dst_scales_offs_]);
         auto vmm_dst_scales = vmm_tmp(0);
@@ -1334,7 +1479,29 @@ void jit_brgemm_kernel_t<isa, Wmm>::apply_compensation(
         maybe_set_avx_mask(is_ld_tail);
     }
 
-    if (brg.zp_type_b != brgemm_broadcast_t::none) {
+    if (brg.zp_type_b == brgemm_broadcast_t::per_n) {
+        // The compensation of a row is multiplied by the zero point of every
+        // column. Only the Intel AVX-512 kernels support it, so the tail is
+        // loaded with a mask.
+        assert(is_superset(brg.isa_impl, avx512_core));
+        for (int ld = 0; ld < ld_block2; ld++) {
+            const bool is_tail = is_ld_tail && ld + 1 == ld_block2;
+            const auto vmm_zp_b_values = vmm_tmp(0);
+            const auto vmm_zp_comp_b = vmm_tmp(1);
+            mov(reg_aux_zp_b_values, ptr[rsp + reg_aux_zp_b_values_offs_]);
+            uni_vmovups(vmm_mask(vmm_zp_b_values, is_tail, false, k_mask),
+                    EVEX_compress_addr(
+                            reg_aux_zp_b_values, zp_b_values_offset(ld)));
+            mov(reg_aux_zp_comp_b, ptr[rsp + reg_aux_zp_comp_b_offs_]);
+            for (int bd = 0; bd < bd_block; bd++) {
+                auto vmm = accm(ld_block2, bd, ld);
+                uni_vpbroadcastd(vmm_zp_comp_b,
+                        ptr[reg_aux_zp_comp_b + zp_comp_b_offset(bd)]);
+                uni_vpmulld(vmm_zp_comp_b, vmm_zp_comp_b, vmm_zp_b_values);
+                uni_vpaddd(vmm, vmm, vmm_zp_comp_b);
+            }
+        }
+    } else if (brg.zp_type_b != brgemm_broadcast_t::none) {
         mov(reg_aux_zp_comp_b, ptr[rsp + reg_aux_zp_comp_b_offs_]);
         for (int bd = 0; bd < bd_block; bd++) {
             int zp_comp_b_off = zp_comp_b_offset(bd);
@@ -1430,7 +1597,7 @@ void jit_brgemm_kernel_t<isa, Wmm>::store_accumulators(int bd_block2,
     const bool are_post_ops_applicable = one_of(true, brg.with_eltwise,
             brg.with_binary, brg.with_scales, brg.with_bias, brg.with_sum,
             brg.dt_d != brg.dt_c, brg.req_s8s8_compensation, has_zero_points,
-            brg.with_dst_scales);
+            brg.with_dst_scales, brg.with_src_row_scales, brg.with_dst_amax);
     const bool need_to_apply_alpha_beta = brg.beta != 0.f || brg.alpha != 1.f;
 
     maybe_set_avx_mask(is_ld_tail);
@@ -1511,6 +1678,7 @@ void jit_brgemm_kernel_t<isa, Wmm>::store_accumulators(int bd_block2,
                         advance_bdb_post_op_regs(adj_bd_block);
                         post_processed |= utils::one_of(true,
                                 brg.zp_type_b != brgemm_broadcast_t::none,
+                                brg.with_src_row_scales,
                                 with_binary_per_oc_sp_bcast_);
                     }
                     if (post_processed) mov(reg_buf, ptr[rsp + reg_buf_offs_]);
@@ -1986,7 +2154,7 @@ void jit_brgemm_kernel_t<isa, Wmm>::ldb_loop(int bd_block2, bool is_bdb_tail,
         bool skip_accumulation) {
 
     Label ldb_loop_label;
-    Label BS_loop_label;
+    Label BS_loop_label, BS_loop_end_label;
 
     copy_post_ops_stack_values_to_aux(is_reg_tail);
 
@@ -2075,7 +2243,13 @@ void jit_brgemm_kernel_t<isa, Wmm>::ldb_loop(int bd_block2, bool is_bdb_tail,
                 mov(reg_bdb_loop, ptr[rsp + reg_bdb_loop_offs_]);
             }
 
-            if (brg.brgattr.max_bs > 1) mov(reg_BS_loop, reg_BS);
+            if (brg.brgattr.max_bs > 1) {
+                mov(reg_BS_loop, reg_BS);
+                if (brg.brgattr.allow_empty_batch) {
+                    cmp(reg_BS_loop, 0);
+                    jle(BS_loop_end_label, T_NEAR);
+                }
+            }
             L_aligned(BS_loop_label, 64);
             {
                 if (check_top_vpad || check_bottom_vpad) {
@@ -2146,6 +2320,7 @@ void jit_brgemm_kernel_t<isa, Wmm>::ldb_loop(int bd_block2, bool is_bdb_tail,
                     jg(BS_loop_label, T_NEAR);
                 }
             }
+            L(BS_loop_end_label);
         }
 
         if (is_ldb_loop_)
@@ -2465,13 +2640,12 @@ brgemm_attr_t::brgemm_attr_t()
     , LDC2_N(0) {}
 
 template <cpu_isa_t isa, typename Wmm>
-brgemm_kernel_common_t<isa, Wmm>::brgemm_kernel_common_t(const brgemm_t abrd) {
-    brgemm_kernel_ = new jit_brgemm_kernel_t<isa, Wmm>(abrd);
-}
+brgemm_kernel_common_t<isa, Wmm>::brgemm_kernel_common_t(const brgemm_t abrd)
+    : brg_(abrd) {}
 
 template <cpu_isa_t isa, typename Wmm>
 status_t brgemm_kernel_common_t<isa, Wmm>::create_kernel() {
-    return brgemm_kernel_->create_kernel();
+    return brgemm_utils::get_or_create_kernel(brgemm_kernel_, brg_);
 }
 
 template <cpu_isa_t isa, typename Wmm>
@@ -2480,11 +2654,6 @@ void brgemm_kernel_common_t<isa, Wmm>::operator()(
     (*brgemm_kernel_)(params);
 }
 
-template <cpu_isa_t isa, typename Wmm>
-brgemm_kernel_common_t<isa, Wmm>::~brgemm_kernel_common_t() {
-    delete brgemm_kernel_;
-}
-
 // isa specific instantiations are required because
 // post-ops require template isa param.
 template struct brgemm_kernel_common_t<avx512_core_amx_fp16, Xbyak::Tmm>;
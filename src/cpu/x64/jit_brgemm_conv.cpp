@@ -404,11 +404,12 @@ status_t brgemm_convolution_fwd_t<isa, use_inversion>::add_brg_kernel(
     if (N <= 0 || K <= 0) return status::success;
     auto brg_idx = _pd->get_brg_idx(bs, M - 1, i_init, i_N, i_K);
     auto brg = brgs[brg_idx];
-    if (!brg_kernels_[brg_idx] && brg && brg->bcast_dim > 0 && brg->load_dim > 0
-            && brg->reduce_dim > 0) {
-        brgemm_kernel_t *brg_kernel = nullptr;
-        CHECK(brgemm_kernel_create(&brg_kernel, *brg));
-        CHECK(safe_ptr_assign(brg_kernels_[brg_idx], brg_kernel));
+    if (!brg_kernels_.is_registered(brg_idx) && brg && brg->bcast_dim > 0
+            && brg->load_dim > 0 && brg->reduce_dim > 0) {
+        // Only the kernel for full blocks is taken on every execution, the
+        // kernels for tails and padded areas are generated on the first use.
+        const bool is_tail = i_N || i_K || M != jcp.M;
+        CHECK(brg_kernels_.insert(brg_idx, *brg, is_tail));
         if (is_amx) {
             CHECK(brgemm_init_tiles(*brg, &brg_kernel_palettes_[brg_idx].a[0]));
         }
@@ -581,12 +582,9 @@ status_t brgemm_convolution_fwd_t<isa, use_inversion>::init(engine_t *engine) {
             = (jcp.src_zero_point || jcp.s8s8_avx512) && !jcp.req_brg_comp_pad;
 
     // ---- Initialize arrays ---------------------
-    brg_kernels_.resize(_pd->brgs_sz_);
+    brg_kernels_.resize(_pd->brgs_sz_, _pd->name());
     brg_kernel_palettes_.resize(_pd->brgs_sz_);
 
-    for (int i = 0; i < _pd->brgs_sz_; i++)
-        brg_kernels_[i] = nullptr;
-
     int num_po_kernels = nstl::max(jcp.M, jcp.M_tail);
     kernels_po_.resize(num_po_kernels * 2 * 2);
     for (int i = 0; i < num_po_kernels; i++) {
@@ -1088,6 +1086,9 @@ status_t brgemm_convolution_fwd_t<isa, use_inversion>::execute(
         if (is_amx) { amx_tile_release(); }
     });
 
+    // Reports a failure of a lazy kernel generation during the execution.
+    CHECK(brg_kernels_.status());
+
     if (_pd->wants_zero_pad_dst()) ctx.memory(DNNL_ARG_DST)->zero_pad(ctx);
 
     return status::success;
@@ -1247,8 +1248,8 @@ void brgemm_convolution_fwd_t<isa, use_inversion>::call_brgemm_kernel(
     const auto _pd = pd();
     const auto &jcp = _pd->jcp_;
 
-    const auto brg_ker = brg_kernels_[brg_idx].get();
-    assert(brg_ker != nullptr);
+    const auto brg_ker = brg_kernels_.get(brg_idx);
+    if (brg_ker == nullptr) return;
 
     const auto do_only_pass_comp = !do_postops && jcp.src_zero_point
             && (jcp.req_brg_comp_pad || jcp.max_vpad > 0);
@@ -0,0 +1,150 @@
+/*******************************************************************************
+* Copyright 2023 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cstring>
+#include <string>
+
+#include "common/serialization_stream.hpp"
+
+#include "cpu/x64/jit_generator.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+status_t jit_generator::serialize(std::vector<uint8_t> &data) const {
+    serialization_stream_t sstream;
+
+    const std::string kernel_name = name();
+    const size_t name_len = kernel_name.size();
+    sstream.write(&name_len);
+    sstream.write(kernel_name.c_str(), name_len);
+
+    const int relocatable = is_relocatable();
+    sstream.write(&relocatable);
+    if (!relocatable) {
+        data = sstream.get_data();
+        return status::success;
+    }
+
+    // The label addresses recorded on emission are stored as offsets from
+    // the code start.
+    const size_t code_size = getSize();
+    const uint8_t *code = CodeGenerator::getCode();
+    const uint64_t code_start = reinterpret_cast<uint64_t>(code);
+    std::vector<uint8_t> relocated_code(code, code + code_size);
+    const std::vector<uint64_t> &relocs = label_addr_offsets_;
+    for (const auto offt : relocs) {
+        uint64_t value;
+        std::memcpy(&value, code + offt, sizeof(value));
+        if (value < code_start || value > code_start + code_size)
+            return status::runtime_error;
+        value -= code_start;
+        std::memcpy(&relocated_code[offt], &value, sizeof(value));
+    }
+
+    const size_t nrelocs = relocs.size();
+    sstream.write(&nrelocs);
+    sstream.write(relocs.data(), nrelocs);
+    sstream.write(&code_size);
+    sstream.write(relocated_code.data(), code_size);
+
+    data = sstream.get_data();
+    return status::success;
+}
+
+status_t jit_generator::get_cache_blob_size(size_t *size) const {
+    if (!size) return status::invalid_arguments;
+    std::vector<uint8_t> data;
+    CHECK(serialize(data));
+    // We need additional sizeof(size_t) bytes to store the size of the
+    // binary when packing.
+    (*size) += data.size() + sizeof(size_t);
+    return status::success;
+}
+
+status_t jit_generator::get_cache_blob(cache_blob_t &cache_blob) const {
+    std::vector<uint8_t> data;
+    CHECK(serialize(data));
+    return cache_blob.add_binary(data.data(), data.size());
+}
+
+status_t jit_generator::restore_from_cache_blob(
+        cache_blob_t &cache_blob, bool &restored) {
+    restored = false;
+
+    const uint8_t *data = nullptr;
+    size_t data_size = 0;
+    CHECK(cache_blob.get_binary(&data, &data_size));
+
+    size_t pos = 0;
+    const auto read = [&](void *dst, size_t size) {
+        if (pos + size > data_size) return false;
+        std::memcpy(dst, data + pos, size);
+        pos += size;
+        return true;
+    };
+
+    // The kernels are stored in the order of their creation, a different
+    // kernel name means that the blob doesn't match the primitive.
+    size_t name_len = 0;
+    if (!read(&name_len, sizeof(name_len)) || name_len != std::strlen(name())
+            || pos + name_len > data_size
+            || std::memcmp(data + pos, name(), name_len) != 0)
+        return status::invalid_arguments;
+    pos += name_len;
+
+    int relocatable = 0;
+    if (!read(&relocatable, sizeof(relocatable)))
+        return status::invalid_arguments;
+    // The kernel wasn't stored and has to be generated.
+    if (!relocatable) return status::success;
+    if (!is_relocatable()) return status::invalid_arguments;
+
+    size_t nrelocs = 0;
+    if (!read(&nrelocs, sizeof(nrelocs))
+            || nrelocs > data_size / sizeof(uint64_t))
+        return status::invalid_arguments;
+    std::vector<uint64_t> relocs(nrelocs);
+    if (!read(relocs.data(), nrelocs * sizeof(uint64_t)))
+        return status::invalid_arguments;
+    size_t code_size = 0;
+    if (!read(&code_size, sizeof(code_size)) || pos + code_size != data_size)
+        return status::invalid_arguments;
+    for (const auto offt : relocs)
+        if (offt + sizeof(uint64_t) > code_size)
+            return status::invalid_arguments;
+
+    db(data + pos, code_size);
+    // The code buffer is not reallocated anymore, so its start is final.
+    const uint64_t code_start
+            = reinterpret_cast<uint64_t>(CodeGenerator::getCode());
+    for (const auto offt : relocs) {
+        uint64_t value;
+        std::memcpy(&value, data + pos + offt, sizeof(value));
+        rewrite(offt, value + code_start, sizeof(value));
+    }
+    label_addr_offsets_ = std::move(relocs);
+
+    restored = true;
+    return status::success;
+}
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
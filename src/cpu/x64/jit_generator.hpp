@@ -21,6 +21,7 @@
 #include <vector>
 
 #include "common/bit_cast.hpp"
+#include "common/cache_blob.hpp"
 #include "common/compiler_workarounds.hpp"
 #include "common/type_helpers.hpp"
 #include "common/utils.hpp"
@@ -145,6 +146,7 @@ constexpr Xbyak::Operand::Code abi_not_param_reg =
 
 class jit_generator : public Xbyak::MmapAllocator,
                       public Xbyak::CodeGenerator,
+                      public cache_blob_serializable_t,
                       public c_compatible {
 public:
     using c_compatible::operator new;
@@ -2643,11 +2645,38 @@ public:
                   /*allocator=*/this)
         , max_cpu_isa_(max_cpu_isa) {}
 
-    virtual ~jit_generator() {}
+    virtual ~jit_generator() {
+        if (auto *registry = cache_blob_registry_t::get())
+            registry->remove(this);
+    }
 
     virtual const char *name() const = 0;
     virtual const char *source_file() const = 0;
 
+    // Returns true if the generated code doesn't embed absolute addresses of
+    // host data (e.g. pointers to static tables or to primitive attributes)
+    // and hence can be stored into a cache blob and loaded into a different
+    // process. Addresses of labels within the kernel are relocated.
+    virtual bool is_relocatable() const { return false; }
+
+    // Absolute addresses of labels are only emitted by mov(reg, label) and
+    // putL(label). Their positions are recorded for the relocation of the
+    // code stored into a cache blob.
+    using Xbyak::CodeGenerator::mov;
+    void mov(const Xbyak::Reg64 &reg, const Xbyak::Label &label) {
+        Xbyak::CodeGenerator::mov(reg, label);
+        label_addr_offsets_.push_back(getSize() - sizeof(size_t));
+    }
+    using Xbyak::CodeGenerator::putL;
+    void putL(const Xbyak::Label &label) {
+        Xbyak::CodeGenerator::putL(label);
+        label_addr_offsets_.push_back(getSize() - sizeof(size_t));
+    }
+
+    status_t get_cache_blob_size(size_t *size) const override;
+    status_t get_cache_blob(cache_blob_t &cache_blob) const override;
+    size_t get_footprint() const override { return getSize(); }
+
     void register_jit_code(const Xbyak::uint8 *code, size_t code_size) const {
         jit_utils::register_jit_code(code, code_size, name(), source_file());
     }
@@ -2665,13 +2694,29 @@ public:
         int err_code = Xbyak::GetError();
         if (err_code == Xbyak::ERR_CANT_ALLOC) return status::out_of_memory;
         if (err_code != Xbyak::ERR_NONE) return status::runtime_error;
-        generate();
+        // When a primitive is created from a cache blob the code is copied
+        // from the blob instead of being generated.
+        auto *registry = cache_blob_registry_t::get();
+        bool is_restored = false;
+        if (registry && registry->cache_blob())
+            CHECK(restore_from_cache_blob(registry->cache_blob(), is_restored));
+        if (!is_restored) generate();
         jit_ker_ = getCode();
-        return (jit_ker_) ? status::success : status::runtime_error;
+        if (!jit_ker_) return status::runtime_error;
+        if (registry) registry->add(this);
+        return status::success;
     }
 
 private:
     const cpu_isa_t max_cpu_isa_;
+    // Offsets of the absolute label addresses within the code.
+    std::vector<uint64_t> label_addr_offsets_;
+
+    // Serializes the kernel name and, for relocatable kernels, the code
+    // with the label addresses converted to offsets from the code start.
+    status_t serialize(std::vector<uint8_t> &data) const;
+    status_t restore_from_cache_blob(cache_blob_t &cache_blob, bool &restored);
+
     const Xbyak::uint8 *getCode() {
         this->ready();
         if (!is_initialized()) return nullptr;
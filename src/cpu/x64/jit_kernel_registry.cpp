@@ -0,0 +1,92 @@
+/*******************************************************************************
+* Copyright 2023 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "common/primitive_cache.hpp"
+
+#include "cpu/x64/jit_kernel_registry.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+jit_kernel_registry_t::jit_kernel_registry_t() {
+    // The kernels of the primitives stored in the primitive cache refer to
+    // the registry at destruction, so the registry must outlive the cache.
+    primitive_cache();
+}
+
+jit_kernel_registry_t &jit_kernel_registry() {
+    static jit_kernel_registry_t registry;
+    return registry;
+}
+
+size_t get_jit_kernel_registry_size() {
+    return jit_kernel_registry().size();
+}
+
+void jit_kernel_registry_t::deleter_t::operator()(jit_generator *kernel) const {
+    {
+        std::lock_guard<std::mutex> lock(registry_->mutex_);
+        auto it = registry_->kernels_.find(key_);
+        // Another kernel with the same key might have been inserted after
+        // this one had expired.
+        if (it != registry_->kernels_.end() && it->second.expired())
+            registry_->kernels_.erase(it);
+    }
+    delete kernel;
+}
+
+std::string jit_kernel_registry_t::make_key(
+        const std::type_info &type, const serialization_stream_t &key) {
+    std::string full_key(type.name());
+    // The type name can't contain a null character, so it separates the
+    // type from the configuration unambiguously.
+    full_key.push_back('\0');
+    const auto &data = key.get_data();
+    full_key.append(data.begin(), data.end());
+    return full_key;
+}
+
+std::shared_ptr<jit_generator> jit_kernel_registry_t::find(
+        const std::string &key) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = kernels_.find(key);
+    if (it == kernels_.end()) return nullptr;
+    return it->second.lock();
+}
+
+void jit_kernel_registry_t::insert(
+        const std::string &key, const std::shared_ptr<jit_generator> &kernel) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto &entry = kernels_[key];
+    // If the same kernel has been created concurrently by another thread,
+    // keep the one that is already registered.
+    if (entry.expired()) entry = kernel;
+}
+
+size_t jit_kernel_registry_t::size() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    size_t n = 0;
+    for (const auto &e : kernels_)
+        n += !e.second.expired();
+    return n;
+}
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
@@ -0,0 +1,119 @@
+/*******************************************************************************
+* Copyright 2023 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_X64_JIT_KERNEL_REGISTRY_HPP
+#define CPU_X64_JIT_KERNEL_REGISTRY_HPP
+
+#include <memory>
+#include <mutex>
+#include <string>
+#include <typeinfo>
+#include <unordered_map>
+
+#include "common/c_types_map.hpp"
+#include "common/cache_blob.hpp"
+#include "common/serialization_stream.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/x64/jit_generator.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+// A process-wide registry of JIT kernels that allows primitives to share
+// kernels with byte-identical code instead of generating the same code again.
+//
+// A kernel is identified by its type and a serialized configuration that
+// completely defines the generated code. The registry doesn't own the kernels:
+// it keeps weak references, so a kernel is destroyed once the last primitive
+// that uses it is destroyed.
+//
+// The registry is disabled while a primitive is created from a cache blob
+// because the kernels have to be restored from the blob in the same order as
+// they were stored.
+struct jit_kernel_registry_t {
+    jit_kernel_registry_t();
+
+    // Returns a kernel of type `kernel_t` with the configuration `key`. If
+    // there is no such kernel yet, it is created with `create()`, which
+    // returns a pointer to a new kernel object.
+    template <typename kernel_t, typename create_t>
+    status_t get_or_create(std::shared_ptr<kernel_t> &kernel,
+            const serialization_stream_t &key, const create_t &create) {
+        static_assert(std::is_base_of<jit_generator, kernel_t>::value,
+                "kernel_t must be a jit_generator");
+        auto *cb_registry = cache_blob_registry_t::get();
+        const bool is_restoring = cb_registry && cb_registry->cache_blob();
+
+        const std::string full_key = make_key(typeid(kernel_t), key);
+        if (!is_restoring) {
+            kernel = std::static_pointer_cast<kernel_t>(find(full_key));
+            if (kernel) {
+                // The kernel is a part of the primitive being created, so it
+                // has to be stored in the primitive cache blob too.
+                if (cb_registry) cb_registry->add(kernel.get());
+                return status::success;
+            }
+        }
+
+        std::unique_ptr<kernel_t> new_kernel(create());
+        if (!new_kernel) return status::out_of_memory;
+        CHECK(new_kernel->create_kernel());
+        kernel = std::shared_ptr<kernel_t>(
+                new_kernel.release(), deleter_t(this, full_key));
+        insert(full_key, kernel);
+        return status::success;
+    }
+
+    // Returns the number of alive kernels in the registry.
+    size_t size() const;
+
+private:
+    struct deleter_t {
+        deleter_t(jit_kernel_registry_t *registry, const std::string &key)
+            : registry_(registry), key_(key) {}
+        void operator()(jit_generator *kernel) const;
+
+    private:
+        jit_kernel_registry_t *registry_;
+        std::string key_;
+    };
+
+    static std::string make_key(
+            const std::type_info &type, const serialization_stream_t &key);
+    std::shared_ptr<jit_generator> find(const std::string &key);
+    void insert(const std::string &key,
+            const std::shared_ptr<jit_generator> &kernel);
+
+    mutable std::mutex mutex_;
+    std::unordered_map<std::string, std::weak_ptr<jit_generator>> kernels_;
+
+    DNNL_DISALLOW_COPY_AND_ASSIGN(jit_kernel_registry_t);
+};
+
+jit_kernel_registry_t &jit_kernel_registry();
+
+// Undocumented API for testing.
+size_t DNNL_API get_jit_kernel_registry_size();
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
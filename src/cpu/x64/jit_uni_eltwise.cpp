@@ -14,12 +14,17 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <cmath>
+
 #include "common/bfloat16.hpp"
 #include "common/c_types_map.hpp"
 #include "common/dnnl_thread.hpp"
+#include "common/memory_tracking.hpp"
 #include "common/nstl.hpp"
 #include "common/utils.hpp"
 
+#include "cpu/cpu_primitive.hpp"
+
 #include "cpu/x64/jit_avx512_core_bf16cvt.hpp"
 #include "cpu/x64/jit_generator.hpp"
 
@@ -41,8 +46,13 @@ struct jit_args_t {
     const void *dst; // fwd: dst;  bwd: diff_src;
     const void *diff_dst; // fwd: nullptr;  bwd: diff_dst;
     size_t work_amount;
+    float *dst_amax; // fwd: running max and min of dst or nullptr; bwd: nullptr
 };
 
+// The buffer of the destination dynamic range holds a vector of the running
+// maximum followed by one of the running minimum for every thread.
+static constexpr dim_t dst_amax_elems_per_thr = 2 * 16;
+
 struct jit_uni_eltwise_kernel : public jit_generator {
     jit_uni_eltwise_kernel(const eltwise_pd_t *pd, const char *name)
         : jit_generator(name), pd_(pd) {}
@@ -79,7 +89,9 @@ struct jit_uni_kernel_t : public jit_uni_eltwise_kernel {
         , vlen_(is_bf16() || is_f16() ? cpu_isa_traits<isa>::vlen / 2
                                       : cpu_isa_traits<isa>::vlen)
         , simd_w_(vlen_ / dtype_size())
-        , is_fwd_(pd_->is_fwd()) {
+        , is_fwd_(pd_->is_fwd())
+        , with_dst_amax_(is_fwd_
+                  && !pd_->attr()->dst_amax_params_.has_default_values()) {
 
         const auto &desc = *pd_->desc();
         // we can consider that there's no auxiliary vregs on fwd path
@@ -99,9 +111,24 @@ struct jit_uni_kernel_t : public jit_uni_eltwise_kernel {
                 {data_type()}, io_conf, io_tail_conf, io_bf16_conf);
     }
 
+    // Only the first lane holds the value with the tail, the rest of the lanes
+    // hold the function computed on zeros.
+    void update_dst_range(const int vmm_idx, const bool tail) {
+        if (tail) {
+            uni_vmaxss(Xmm(vmm_dst_max.getIdx()), Xmm(vmm_dst_max.getIdx()),
+                    Xmm(vmm_idx));
+            uni_vminss(Xmm(vmm_dst_min.getIdx()), Xmm(vmm_dst_min.getIdx()),
+                    Xmm(vmm_idx));
+        } else {
+            uni_vmaxps(vmm_dst_max, vmm_dst_max, Vmm(vmm_idx));
+            uni_vminps(vmm_dst_min, vmm_dst_min, Vmm(vmm_idx));
+        }
+    }
+
     void compute_dst(const bool tail) {
         io_[data_type()]->load(ptr[reg_src], vmm_src, tail);
         eltwise_injector_->compute_vector(vmm_src.getIdx());
+        if (with_dst_amax_) update_dst_range(vmm_src.getIdx(), tail);
         if (!is_fwd_) {
             io_[data_type()]->load(ptr[reg_diff_dst], vmm_diff_dst, tail);
             uni_vmulps(vmm_src, vmm_src, vmm_diff_dst);
@@ -125,6 +152,7 @@ struct jit_uni_kernel_t : public jit_uni_eltwise_kernel {
             const auto vdiff_dst
                     = i == 0 ? vmm_diff_dst_even : vmm_diff_dst_odd;
             eltwise_injector_->compute_vector(vsrc.getIdx());
+            if (with_dst_amax_) update_dst_range(vsrc.getIdx(), false);
             if (!is_fwd_) uni_vmulps(vsrc, vsrc, vdiff_dst);
             io_[data_type()]->store(vsrc, ptr[reg_dst + i * vlen_], tail);
         }
@@ -201,6 +229,11 @@ struct jit_uni_kernel_t : public jit_uni_eltwise_kernel {
         if (!is_fwd_) mov(reg_diff_dst, ptr[param + GET_OFF(diff_dst)]);
         mov(reg_work_amount, ptr[param + GET_OFF(work_amount)]);
         eltwise_injector_->load_table_addr();
+        if (with_dst_amax_) {
+            mov(reg_dst_amax, ptr[param + GET_OFF(dst_amax)]);
+            uni_vpxor(vmm_dst_max, vmm_dst_max, vmm_dst_max);
+            uni_vpxor(vmm_dst_min, vmm_dst_min, vmm_dst_min);
+        }
 
         // TODO: consider improving.
         // This piece of code is responsible for the preserve_zero function
@@ -214,6 +247,11 @@ struct jit_uni_kernel_t : public jit_uni_eltwise_kernel {
         // perspective and will complicate the compute logic significantly.
         compute();
 
+        if (with_dst_amax_) {
+            uni_vmovups(ptr[reg_dst_amax], vmm_dst_max);
+            uni_vmovups(ptr[reg_dst_amax + 16 * sizeof(float)], vmm_dst_min);
+        }
+
         postamble();
 
         eltwise_injector_->prepare_table();
@@ -225,12 +263,14 @@ private:
     const int vlen_;
     const int simd_w_;
     const bool is_fwd_;
+    const bool with_dst_amax_;
     const int tail_size_ = 1;
 
     Reg64 reg_src = rax;
     Reg64 reg_dst = r8;
     Reg64 reg_injector_table = r9;
     Reg64 reg_diff_dst = r10;
+    Reg64 reg_dst_amax = reg_diff_dst; // used on forward only
     Reg64 reg_work_amount = rsi;
     Reg64 imm_addr64 = rbx;
     Reg64 reg_tmp = r14;
@@ -248,6 +288,9 @@ private:
     Vmm vmm_src_odd = Vmm(8);
     Vmm vmm_diff_dst_even = vmm_diff_dst;
     Vmm vmm_diff_dst_odd = Vmm(9);
+    // the running maximum and minimum of the destination
+    Vmm vmm_dst_max = Vmm(10);
+    Vmm vmm_dst_min = Vmm(11);
     std::unique_ptr<jit_uni_eltwise_injector_f32<isa>> eltwise_injector_;
     io::jit_io_multi_dt_helper_t<Vmm> io_;
 
@@ -278,9 +321,20 @@ status_t jit_uni_eltwise_fwd_t<isa, d_type>::pd_t::init(engine_t *engine) {
             && eltwise_injector::is_supported(isa, desc_.alg_kind)
             // refer to a comment in jit_uni_kernel why this is needed
             && IMPLICATION(!src_d.is_dense(), is_zero_preserved())
-            && attr()->has_default_values() && set_default_formats_common()
+            && attr()->has_default_values(
+                    primitive_attr_t::skip_mask_t::dst_amax_params)
+            && set_default_formats_common()
             && src_d == memory_desc_wrapper(dst_md());
-    return ok ? status::success : status::unimplemented;
+    if (!ok) return status::unimplemented;
+
+    if (!attr()->dst_amax_params_.has_default_values()) {
+        nthr_ = dnnl_get_max_threads();
+        auto scratchpad = scratchpad_registry().registrar();
+        scratchpad.template book<float>(
+                memory_tracking::names::key_eltwise_dst_amax,
+                static_cast<size_t>(nthr_) * dst_amax_elems_per_thr, 64);
+    }
+    return status::success;
 }
 
 template <cpu_isa_t isa, data_type_t d_type>
@@ -301,6 +355,7 @@ status_t jit_uni_eltwise_fwd_t<isa, d_type>::execute(
         const exec_ctx_t &ctx) const {
     auto src = CTX_IN_MEM(const data_t *, DNNL_ARG_SRC);
     auto dst = CTX_OUT_MEM(data_t *, DNNL_ARG_DST);
+    DEFINE_DST_AMAX_BUFFER(dst_amax);
 
     const memory_desc_wrapper data_d(pd()->src_md());
     const auto nelems = data_d.nelems(true);
@@ -309,7 +364,18 @@ status_t jit_uni_eltwise_fwd_t<isa, d_type>::execute(
     src += data_d.offset0();
     dst += data_d.offset0();
 
-    parallel(0, [&](const int ithr, const int nthr) {
+    // Every thread keeps the range of its part of the destination in its own
+    // slot, the slots are reduced once the parallel section is over.
+    float *dst_range = nullptr;
+    int amax_nthr = 0;
+    if (dst_amax) {
+        dst_range = ctx.get_scratchpad_grantor().template get<float>(
+                memory_tracking::names::key_eltwise_dst_amax);
+        amax_nthr = nstl::min(pd()->nthr_, dnnl_get_current_num_threads());
+        utils::array_set(dst_range, 0, amax_nthr * dst_amax_elems_per_thr);
+    }
+
+    parallel(amax_nthr, [&](const int ithr, const int nthr) {
         dim_t start {0}, end {0};
 
         balance211(utils::div_up(nelems, simd_w), nthr, ithr, start, end);
@@ -322,9 +388,18 @@ status_t jit_uni_eltwise_fwd_t<isa, d_type>::execute(
         args.dst = dst + start;
         args.diff_dst = nullptr;
         args.work_amount = end - start;
+        args.dst_amax = dst_range ? dst_range + ithr * dst_amax_elems_per_thr
+                                  : nullptr;
         (*kernel_)(&args);
     });
 
+    if (dst_amax) {
+        float amax = 0.f;
+        for (dim_t i = 0; i < amax_nthr * dst_amax_elems_per_thr; i++)
+            amax = nstl::max(amax, std::fabs(dst_range[i]));
+        *dst_amax = amax;
+    }
+
     return status::success;
 }
 
@@ -396,6 +471,7 @@ status_t jit_uni_eltwise_bwd_t<isa, d_type>::execute(
         args.dst = diff_src + start;
         args.diff_dst = diff_dst + start;
         args.work_amount = end - start;
+        args.dst_amax = nullptr;
         (*kernel_)(&args);
     });
 
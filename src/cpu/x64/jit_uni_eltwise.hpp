@@ -49,6 +49,10 @@ struct jit_uni_eltwise_fwd_t : public primitive_t {
                 jit_uni_eltwise_fwd_t);
 
         status_t init(engine_t *engine);
+
+        // The number of threads the buffer of the destination dynamic range
+        // is booked for.
+        int nthr_ = 0;
     };
 
     jit_uni_eltwise_fwd_t(const pd_t *apd);
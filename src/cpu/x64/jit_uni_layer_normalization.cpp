@@ -58,6 +58,7 @@ struct jit_stat_and_data_base_kernel_t : stat_and_data_kernel_t,
     void operator()(const void *src, void *dst, const float *scale,
             const float *shift, float *mean, float *var,
             const float *src_scales, const float *dst_scales,
+            const float *dst_zero_point,
             const size_t block_size) const override {
         ker_args_t args;
         args.src = src;
@@ -68,6 +69,7 @@ struct jit_stat_and_data_base_kernel_t : stat_and_data_kernel_t,
         args.var = var;
         args.src_scales = src_scales;
         args.dst_scales = dst_scales;
+        args.dst_zero_point = dst_zero_point;
         args.block_size
                 = block_size * C_ * types::data_type_size(src_d_.data_type());
         args.eps = eps_;
@@ -92,7 +94,9 @@ struct jit_stat_and_data_base_kernel_t : stat_and_data_kernel_t,
         , eps_(pd_->desc()->layer_norm_epsilon)
         , has_ne_convert_src_xf16_(isa == avx2 && mayiuse(avx2_vnni_2)
                   && utils::one_of(src_d_.data_type(), data_type::f16,
-                          data_type::bf16)) {
+                          data_type::bf16))
+        , with_dst_zero_point_(
+                  !pd_->attr()->zero_points_.has_default_values(DNNL_ARG_DST)) {
 
         io::io_conf_t io_conf;
         io::io_tail_conf_t io_tail_conf(simd_w_, axis_simd_tail_,
@@ -128,6 +132,7 @@ protected:
         const float *var;
         const float *src_scales;
         const float *dst_scales;
+        const float *dst_zero_point;
         size_t block_size;
         float eps;
     };
@@ -144,6 +149,7 @@ protected:
     const bool calculate_stats_;
     const float eps_;
     const bool has_ne_convert_src_xf16_;
+    const bool with_dst_zero_point_;
 
     const Reg64 reg_param = abi_param1;
     const Reg64 reg_src = rdx;
@@ -157,8 +163,11 @@ protected:
     const Reg64 reg_var = r13;
     const Reg64 reg_src_scales = r14;
     const Reg64 reg_dst_scales = r15;
+    const Reg64 reg_dst_zero_point = rsi;
 
     const Vmm vmm_tail_mask = Vmm(0);
+    const Vmm vmm_dst_zero_point
+            = Vmm(2); // In unroll range, safe for dst compute.
     const Vmm vmm_zero = Vmm(4); // In unroll range, safe for dst compute.
     const Vmm vmm_saturation_ubound
             = Vmm(5); // In unroll range, safe for dst compute.
@@ -399,6 +408,8 @@ protected:
                 if (use_shift_) uni_vaddps(vmm_dst, vmm_dst, vmm_shift);
             }
             uni_vmulps(vmm_dst, vmm_dst, vmm_combined_scales);
+            if (with_dst_zero_point_)
+                uni_vaddps(vmm_dst, vmm_dst, vmm_dst_zero_point);
             io_[dst_d_.data_type()]->store(
                     vmm_dst, dst_ptr(offt_elems + j * simd_w_), tail);
         }
@@ -421,6 +432,8 @@ protected:
             if (use_shift_) uni_vaddps(vmm_dst, vmm_dst, vmm_shift);
         }
         uni_vmulps(vmm_dst, vmm_dst, vmm_combined_scales);
+        if (with_dst_zero_point_)
+            uni_vaddps(vmm_dst, vmm_dst, vmm_dst_zero_point);
         io_[dst_d_.data_type()]->store(vmm_dst, dst_ptr(offt_elems), tail);
     }
 
@@ -462,6 +475,9 @@ protected:
         mov(reg_var, ptr[reg_param + PARAM_OFF(var)]);
         mov(reg_src_scales, ptr[reg_param + PARAM_OFF(src_scales)]);
         mov(reg_dst_scales, ptr[reg_param + PARAM_OFF(dst_scales)]);
+        if (with_dst_zero_point_)
+            mov(reg_dst_zero_point,
+                    ptr[reg_param + PARAM_OFF(dst_zero_point)]);
         mov(reg_block_end, ptr[reg_param + PARAM_OFF(block_size)]);
         mov(reg_eps, ptr[reg_param + PARAM_OFF(eps)]);
 #undef PARAM_OFF
@@ -507,6 +523,8 @@ protected:
             uni_vmovss(xmm_tmp, dword[reg_dst_scales]);
             uni_vbroadcastss(vmm_tmp, xmm_tmp);
             uni_vmulps(vmm_combined_scales, vmm_combined_scales, vmm_tmp);
+            if (with_dst_zero_point_)
+                uni_vbroadcastss(vmm_dst_zero_point, dword[reg_dst_zero_point]);
             io_.init_saturate_f32({dst_d_.data_type()});
 
             // calculate dst
@@ -1103,6 +1121,8 @@ status_t jit_uni_layer_normalization_fwd_t::execute_forward(
 
     DEFINE_ARG_SCALES_BUFFER(src_scales, DNNL_ARG_SRC);
     DEFINE_ARG_SCALES_BUFFER(dst_scales, DNNL_ARG_DST);
+    DEFINE_ZERO_POINT_VALUE(dst_zero_point, DNNL_ARG_DST);
+    const float dst_zero_point_f32 = static_cast<float>(dst_zero_point);
 
     const memory_desc_wrapper src_d(pd()->src_md());
     const memory_desc_wrapper dst_d(pd()->dst_md());
@@ -1120,7 +1140,8 @@ status_t jit_uni_layer_normalization_fwd_t::execute_forward(
                 + N_start * C_padded * dst_d.data_type_size();
         const int block_size = N_end - N_start;
         (*stat_and_data_kernel_)(src_ptr, dst_ptr, scale, shift, &mean[N_start],
-                &variance[N_start], src_scales, dst_scales, block_size);
+                &variance[N_start], src_scales, dst_scales,
+                &dst_zero_point_f32, block_size);
     });
     return status::success;
 }
@@ -43,7 +43,7 @@ struct stat_and_data_kernel_t {
     virtual void operator()(const void *src, void *dst, const float *scale,
             const float *shift, float *mean, float *var,
             const float *src_scales, const float *dst_scales,
-            const size_t block_size) const {};
+            const float *dst_zero_point, const size_t block_size) const {};
 
     virtual status_t create_kernel() { return status::success; }
 
@@ -111,8 +111,10 @@ struct jit_uni_layer_normalization_fwd_t : public primitive_t {
                             mayiuse(avx512_core_fp16) || mayiuse(avx2_vnni_2))
                     && stat_md()->data_type == f32
                     && check_scale_shift_data_type()
-                    && attr()->has_default_values(skip_mask_t::scales_runtime)
-                    && attr_scales_ok() && set_default_formats_common()
+                    && attr()->has_default_values(skip_mask_t::scales_runtime
+                            | skip_mask_t::zero_points_runtime)
+                    && attr_scales_ok() && attr_zero_points_ok()
+                    && set_default_formats_common()
                     && src_d.is_blocking_desc()
                     // plain format, last logical dim is last physical
                     && src_d.blocking_desc().strides[ndims() - 1] == 1;
@@ -84,6 +84,8 @@ const size_t ker_prb_size_min = 64;
 struct jit_uni_reorder_kernel_f32_t : public kernel_t, public jit_generator {
     DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_reorder_kernel_f32)
 
+    bool is_relocatable() const override { return true; }
+
     void operator()(const call_param_t *c) const override {
         jit_generator::operator()(c);
     }
@@ -167,12 +169,17 @@ struct jit_uni_reorder_kernel_f32_t : public kernel_t, public jit_generator {
         using namespace data_type;
 
         bool ok = true && p.ndims > 0
-                && utils::one_of(p.itype, f32, bf16, f16, s32, s8, u8)
+                && utils::one_of(p.itype, f32, bf16, f16, s32, s8, u8,
+                        f8_e5m2, f8_e4m3)
                 && utils::one_of(p.otype, f32, bf16, f16, s32, s8, u8)
                 && IMPLICATION(utils::one_of(p.itype, bf16, f16),
                         utils::one_of(p.otype, s8, u8, f32, bf16, f16))
                 && IMPLICATION(utils::one_of(p.otype, bf16, f16),
-                        utils::one_of(p.itype, s8, u8, f32, bf16, f16))
+                        utils::one_of(p.itype, s8, u8, f32, bf16, f16,
+                                f8_e5m2, f8_e4m3))
+                && IMPLICATION(utils::one_of(p.itype, f8_e5m2, f8_e4m3),
+                        utils::one_of(p.otype, f32, bf16, f16)
+                                && mayiuse(avx512_core))
                 && utils::everyone_is(0, p.ioff, p.ooff) /* do we need this? */
                 && utils::one_of(p.beta, 0.f, 1.f) /* anything else? */
                 && simple_impl_desc_init(p, nullptr) && mayiuse(sse41)
@@ -564,6 +571,27 @@ struct jit_uni_reorder_kernel_f32_t : public kernel_t, public jit_generator {
         return true;
     }
 
+    // Converts f8 values to f32 through f16. An f8_e5m2 value is the upper
+    // byte of the f16 one. The exponent of an f8_e4m3 value is moved to the
+    // f16 position with an arithmetic shift and rebiased by the
+    // multiplication by 2^8 after the conversion, the NaN values are restored
+    // with a mask.
+    void cvt_f8_to_ps(const Xmm &dst, const Operand &src, data_type_t idt) {
+        vpmovzxbw(dst, src);
+        vpsllw(dst, dst, 8);
+        if (idt == data_type::f8_e4m3) {
+            vpsraw(dst, dst, 1);
+            vpandd(dst, dst, xmm_f8_e4m3_mask_);
+            vpsllw(xmm_f8_tmp_, dst, 1);
+            vpcmpeqw(k_f8_e4m3_nan_, xmm_f8_tmp_, xmm_f8_e4m3_nan_);
+        }
+        vcvtph2ps(dst, dst);
+        if (idt == data_type::f8_e4m3) {
+            vmulps(dst, dst, xmm_f8_e4m3_scale_);
+            vpternlogd(dst | k_f8_e4m3_nan_, dst, dst, 0xff);
+        }
+    }
+
     void process_unroll_generic_step(int reg_unroll, const int *i_off,
             const int *o_off, const int *s_off, const int *c_off,
             const int *zero_padding, const bool tail_processing) {
@@ -594,6 +622,8 @@ struct jit_uni_reorder_kernel_f32_t : public kernel_t, public jit_generator {
                               uni_vpmovzxbd(dst, src);
                               uni_vcvtdq2ps(dst_pure, dst);
                               break;
+                          case f8_e5m2:
+                          case f8_e4m3: cvt_f8_to_ps(dst, src, idt); break;
                           default: assert(!"unreachable");
                       }
                   };
@@ -1107,6 +1137,7 @@ struct jit_uni_reorder_kernel_f32_t : public kernel_t, public jit_generator {
         using namespace data_type;
 
         return utils::one_of(f32, prb_.itype, prb_.otype)
+                || utils::one_of(prb_.itype, f8_e5m2, f8_e4m3)
                 || prb_.src_scale_type != scale_type_t::NONE
                 || prb_.dst_scale_type != scale_type_t::NONE || prb_.beta != 0.f
                 || ((prb_.req_src_zp || prb_.req_dst_zp)
@@ -1513,6 +1544,15 @@ struct jit_uni_reorder_kernel_f32_t : public kernel_t, public jit_generator {
             }
         }
 
+        if (prb_.itype == data_type::f8_e4m3) {
+            mov(reg_tmp_.cvt32(), 0xbfffbfff);
+            vpbroadcastd(xmm_f8_e4m3_mask_, reg_tmp_.cvt32());
+            mov(reg_tmp_.cvt32(), 0x7f007f00);
+            vpbroadcastd(xmm_f8_e4m3_nan_, reg_tmp_.cvt32());
+            mov(reg_tmp_.cvt32(), float2int(256.f));
+            vpbroadcastd(xmm_f8_e4m3_scale_, reg_tmp_.cvt32());
+        }
+
         impl();
 
         L(end_of_kernel);
@@ -1569,11 +1609,21 @@ private:
     const Reg64 bf16_emu_scratch_ = reg_tmp_;
     const Zmm bf16_emu_reserv_3_ = Zmm(18);
     const Zmm bf16_emu_reserv_4_ = Zmm(19);
+
+    /* f8 conversion on avx512_core */
+    const Xmm xmm_f8_tmp_ = Xmm(20);
+    const Xmm xmm_f8_e4m3_mask_ = Xmm(21);
+    const Xmm xmm_f8_e4m3_nan_ = Xmm(22);
+    const Xmm xmm_f8_e4m3_scale_ = Xmm(23);
+    const Opmask k_f8_e4m3_nan_ = k1;
 };
 
 // Seperate class for no unroll/threading burden
 struct jit_single_blk_kernel_t : public jit_generator {
     DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_single_blk_kernel)
+
+    bool is_relocatable() const override { return true; }
+
     static bool applicable(const prb_t &p) {
         using namespace data_type;
 
@@ -55,6 +55,7 @@ struct jit_softmax_t : public jit_generator {
         const void *interim; // scratch memory for intermediate storage
         const void *src_scales; // src_scales defined for all data type cases
         const void *dst_scales; // dst_scales defined for all data type cases
+        const void *dst_zero_point; // dst_zero_point is a single f32 value
         size_t process_n_elems;
     };
     DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_softmax_t)
@@ -105,6 +106,8 @@ struct jit_softmax_t : public jit_generator {
     Vmm vsbr = vsum; // must be not equal to vmax
     Vmm vzero = Vmm(isa == avx512_core ? 21 : 11);
     Vmm vcvt_vmm = Vmm(isa == avx512_core ? 22 : 10);
+    // Only int8 destinations take a zero point, and those are avx512_core only.
+    Vmm vdst_zero_point = Vmm(isa == avx512_core ? 20 : 9);
     Vmm vsaturation_ubound = vneg_flt_max;
 
     bool is_bf16_ = false;
@@ -112,6 +115,8 @@ struct jit_softmax_t : public jit_generator {
     bool is_avx2_ne_xf16_ = false;
     bool is_softmax_ = pd_->is_softmax();
     bool is_logsoftmax_ = pd_->is_logsoftmax();
+    bool with_dst_zero_point_
+            = !pd_->attr()->zero_points_.has_default_values(DNNL_ARG_DST);
     bool axis_is_blocked_;
     bool need_scratchpad_;
 
@@ -203,6 +208,10 @@ struct jit_softmax_t : public jit_generator {
         }
         mov(reg_src_scales, ptr[reg_param + PARAM_OFF(src_scales)]);
         mov(reg_dst_scales, ptr[reg_param + PARAM_OFF(dst_scales)]);
+        if (with_dst_zero_point_) {
+            mov(reg_tmp, ptr[reg_param + PARAM_OFF(dst_zero_point)]);
+            uni_vbroadcastss(vdst_zero_point, dword[reg_tmp]);
+        }
 #undef PARAM_OFF
     }
 
@@ -572,6 +581,9 @@ struct jit_softmax_t : public jit_generator {
                     // Reserved spot for post-ops injector
                     uni_vmovups(vscale, ptr[reg_dst_scales]);
                     uni_vmulps(vreg_tmp_src, vreg_tmp_src, vscale);
+                    if (with_dst_zero_point_)
+                        uni_vaddps(
+                                vreg_tmp_src, vreg_tmp_src, vdst_zero_point);
                 }
                 store(dst_ptr(dst_axis_stride_ * i), vreg_tmp_src,
                         dst_d_.data_type(), tail);
@@ -726,6 +738,8 @@ status_t jit_uni_softmax_fwd_t<isa>::execute(const exec_ctx_t &ctx) const {
 
     DEFINE_ARG_SCALES_BUFFER(src_scales, DNNL_ARG_SRC);
     DEFINE_ARG_SCALES_BUFFER(dst_scales, DNNL_ARG_DST);
+    DEFINE_ZERO_POINT_VALUE(dst_zero_point, DNNL_ARG_DST);
+    const float dst_zero_point_f32 = static_cast<float>(dst_zero_point);
 
     const memory_desc_wrapper src_d(pd()->src_md());
     const memory_desc_wrapper dst_d(pd()->dst_md());
@@ -753,7 +767,7 @@ status_t jit_uni_softmax_fwd_t<isa>::execute(const exec_ctx_t &ctx) const {
                                 + ithr * axis_size_padded * sizeof(float)
                                                    : nullptr;
                 softmax_driver_->exec(src_ptr, dst_ptr, interim_ptr, src_scales,
-                        dst_scales, process_n_elems);
+                        dst_scales, &dst_zero_point_f32, process_n_elems);
             });
 
     return status::success;
@@ -816,7 +830,8 @@ struct driver_t : public c_compatible {
     driver_t(const softmax_pd_t *pd) : pd_(pd), ker_(pd_) {}
 
     void exec(const void *src, void *dst, void *interim, const void *src_scales,
-            const void *dst_scales, const dim_t process_n_elems) {
+            const void *dst_scales, const void *dst_zero_point,
+            const dim_t process_n_elems) {
         typename jit_softmax_t<isa>::call_params_t p;
         p.process_n_elems = process_n_elems;
         p.src = src;
@@ -824,6 +839,7 @@ struct driver_t : public c_compatible {
         p.interim = interim;
         p.src_scales = src_scales;
         p.dst_scales = dst_scales;
+        p.dst_zero_point = dst_zero_point;
         ker_(&p);
     }
 
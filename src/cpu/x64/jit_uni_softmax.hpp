@@ -91,8 +91,9 @@ struct jit_uni_softmax_fwd_t : public primitive_t {
                             (is_superset(isa, avx512_core)
                                     && mayiuse(avx512_core_fp16))
                                     || (isa == avx2 && mayiuse(avx2_vnni_2)))
-                    && attr()->has_default_values(skip_mask_t::scales_runtime)
-                    && attr_scales_ok()
+                    && attr()->has_default_values(skip_mask_t::scales_runtime
+                            | skip_mask_t::zero_points_runtime)
+                    && attr_scales_ok() && attr_zero_points_ok()
                     && set_default_formats() == status::success;
             if (!ok) return status::unimplemented;
 
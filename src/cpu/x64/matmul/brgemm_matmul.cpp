@@ -14,6 +14,9 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <cmath>
+#include <cstring>
+
 #include "common/c_types_map.hpp"
 #include "common/dnnl_thread.hpp"
 #include "common/memory_tracking.hpp"
@@ -22,8 +25,11 @@
 #include "common/utils.hpp"
 
 #include "cpu/cpu_primitive.hpp"
+#include "cpu/ref_io_helper.hpp"
 #include "cpu/scale_utils.hpp"
 
+#include "cpu/matmul/matmul_utils.hpp"
+
 #include "cpu/x64/amx_tile_configure.hpp"
 #include "cpu/x64/injectors/jit_uni_binary_injector.hpp"
 #include "cpu/x64/matmul/brgemm_matmul.hpp"
@@ -42,18 +48,62 @@ using namespace nstl;
 using namespace data_type;
 
 namespace {
-void maybe_tile_configure(bool is_amx,
-        const char brg_kernel_palettes[][AMX_PALETTE_SIZE], int brg_ker_idx,
-        int &prev_ker_idx) {
-    if (!is_amx) return;
-    if (brg_ker_idx == prev_ker_idx) return;
-    // TODO: more accurately estimate the costs of memcmp and tile configuration
-    if (prev_ker_idx == -1
-            || std::memcmp(&brg_kernel_palettes[brg_ker_idx][0],
-                       &brg_kernel_palettes[prev_ker_idx][0], AMX_PALETTE_SIZE)
-                    != 0)
-        amx_tile_configure(&brg_kernel_palettes[brg_ker_idx][0]);
-    prev_ker_idx = brg_ker_idx;
+// Returns true if the buffer contains zero bytes only. The check stops at the
+// first non-zero word, so it is cheap for the dense data.
+bool is_zero_buffer(const char *buf, size_t size) {
+    size_t i = 0;
+    for (; i + sizeof(uint64_t) <= size; i += sizeof(uint64_t)) {
+        uint64_t word;
+        std::memcpy(&word, buf + i, sizeof(word));
+        if (word != 0) return false;
+    }
+    for (; i < size; i++)
+        if (buf[i] != 0) return false;
+    return true;
+}
+
+// Expands the weights scales or zero points applied on decompression to f32
+// values for every group of `group_k` rows and every column of the weights.
+status_t expand_wei_decomp_params(float *dst, const exec_ctx_t &ctx, int arg,
+        data_type_t dt, dim_t src_group_k, bool per_n, dim_t group_k, dim_t K,
+        dim_t N) {
+    const void *src = CTX_IN_MEM(const void *, arg);
+    if (src == nullptr) return status::invalid_arguments;
+    if (ctx.memory_mdw(arg).data_type() != dt)
+        return status::invalid_arguments;
+
+    parallel_nd(K / group_k, N, [&](dim_t g, dim_t n) {
+        const dim_t src_g = g * group_k / src_group_k;
+        const dim_t idx = per_n ? src_g * N + n : src_g;
+        dst[g * N + n] = io::load_float_value(dt, src, idx);
+    });
+    return status::success;
+}
+
+// Expands the weights zero points that vary along N to a value per column of
+// the weights. The u8 weights are copied as s8 ones, so their zero points are
+// shifted by 128.
+status_t expand_wei_zero_points(int32_t *dst, const exec_ctx_t &ctx,
+        const primitive_attr_t *attr, const brgemm_matmul_conf_t &bgmmc) {
+    const int32_t shift = bgmmc.orig_wei_dt == data_type::u8 ? 128 : 0;
+    if (attr->zero_points_.has_default_values(DNNL_ARG_WEIGHTS)) {
+        for (dim_t n = 0; n < bgmmc.N; n++)
+            dst[n] = -shift;
+        return status::success;
+    }
+
+    const int arg = DNNL_ARG_ATTR_ZERO_POINTS | DNNL_ARG_WEIGHTS;
+    const bool per_n = !attr->zero_points_.common(DNNL_ARG_WEIGHTS);
+    const auto zero_points_d = ctx.memory_mdw(arg);
+    if (zero_points_d.data_type() != data_type::s32
+            || zero_points_d.nelems() != (per_n ? bgmmc.N : 1))
+        return status::invalid_arguments;
+    const int32_t *src = CTX_IN_MEM(const int32_t *, arg);
+    if (src == nullptr) return status::invalid_arguments;
+
+    for (dim_t n = 0; n < bgmmc.N; n++)
+        dst[n] = src[per_n ? n : 0] - shift;
+    return status::success;
 }
 } // namespace
 
@@ -64,12 +114,24 @@ status_t brgemm_matmul_t<isa>::pd_t::init(engine_t *engine) {
     const auto dst_dt = dst_md_.data_type;
 
     const bool is_f32 = everyone_is(f32, src_dt, wei_dt, dst_dt);
-    const bool is_int8 = one_of(src_dt, u8, s8) && wei_dt == s8
+    const bool is_int8 = one_of(src_dt, u8, s8) && one_of(wei_dt, s8, u8)
             && one_of(dst_dt, u8, s8, s32, f32, bf16);
     const bool is_bf16
             = everyone_is(bf16, src_dt, wei_dt) && one_of(dst_dt, bf16, f32);
     const bool is_f16
             = everyone_is(f16, src_dt, wei_dt) && one_of(dst_dt, f16, f32);
+    const bool with_src_dyn_quant
+            = attr()->src_dyn_quant_params_.data_type_ == s8;
+    // The 4-bit and 8-bit weights are decompressed to the floating-point
+    // source data type.
+    const bool is_wei_decomp = (one_of(wei_dt, s4, u4, f8_e5m2, f8_e4m3)
+                                       || (one_of(wei_dt, s8, u8)
+                                               && !with_src_dyn_quant))
+            && one_of(src_dt, f32, bf16, f16) && one_of(dst_dt, f32, src_dt);
+    // The floating-point source is quantized to s8 at execution.
+    const bool is_src_dyn_quant = with_src_dyn_quant
+            && one_of(src_dt, f32, bf16) && wei_dt == s8
+            && one_of(dst_dt, f32, bf16);
 
     auto check_bias = [&]() -> bool {
         const auto bia_dt = weights_md(1)->data_type;
@@ -85,6 +147,18 @@ status_t brgemm_matmul_t<isa>::pd_t::init(engine_t *engine) {
     auto check_attr_scales = [&]() -> bool {
         const std::vector<int> supported_args
                 = {DNNL_ARG_SRC, DNNL_ARG_WEIGHTS, DNNL_ARG_DST};
+        // The weights scales of the decompressed weights are checked when the
+        // configuration is initialized.
+        if (is_wei_decomp) {
+            const auto &scales = attr()->scales_;
+            bool ok = scales.has_default_values(supported_args);
+            for (int arg : {DNNL_ARG_SRC, DNNL_ARG_DST}) {
+                const auto &s = scales.get(arg);
+                ok = ok && s.mask_ == 0 && s.has_default_groups()
+                        && s.has_default_data_type();
+            }
+            return ok;
+        }
         bool ok = attr_scales_ok(supported_args);
         if (!attr()->scales_.get(DNNL_ARG_SRC).has_default_values()
                 && !attr()->scales_.get(DNNL_ARG_WEIGHTS).has_default_values()
@@ -95,77 +169,76 @@ status_t brgemm_matmul_t<isa>::pd_t::init(engine_t *engine) {
         return ok;
     };
 
-    auto check_attr_zero_points
-            = [&]() -> bool { return attr()->zero_points_.common(); };
+    auto check_attr_zero_points = [&]() -> bool {
+        const auto &zp = attr()->zero_points_;
+        // The weights zero points of the decompressed weights are checked when
+        // the configuration is initialized.
+        if (is_wei_decomp)
+            return zp.common(DNNL_ARG_SRC) && zp.common(DNNL_ARG_DST);
+        // The weights zero points can vary along N.
+        int wei_zp_mask = 0;
+        zp.get(DNNL_ARG_WEIGHTS, &wei_zp_mask);
+        return zp.common(DNNL_ARG_SRC) && zp.common(DNNL_ARG_DST)
+                && utils::one_of(wei_zp_mask, 0, 1 << (ndims() - 1));
+    };
 
-    const bool problem_dt_correct = is_int8 || is_bf16 || is_f32 || is_f16;
+    auto check_runtime_dims = [&]() -> bool {
+        if (!has_runtime_dims_or_strides()) return true;
+        // Only M can be defined at execution. The layouts are checked when
+        // the configuration is initialized.
+        const memory_desc_wrapper src_d(src_md_);
+        const memory_desc_wrapper dst_d(dst_md_);
+        const memory_desc_wrapper weights_d(weights_md_);
+        if (weights_d.has_runtime_dims_or_strides()) return false;
+        for (int d = 0; d < ndims(); d++) {
+            if (d == ndims() - 2) continue;
+            if (is_runtime_value(src_d.dims()[d])
+                    || is_runtime_value(dst_d.dims()[d]))
+                return false;
+        }
+        // Binary post-ops depend on the dst dimensions at kernel generation.
+        return is_runtime_value(M())
+                && attr()->post_ops_.find(primitive_kind::binary) == -1;
+    };
+
+    using smask_t = primitive_attr_t::skip_mask_t;
+    auto skip_mask = smask_t::scales_runtime | smask_t::zero_points_runtime
+            | smask_t::post_ops | smask_t::sum_dt;
+    if (is_wei_decomp)
+        skip_mask |= smask_t::scales_runtime_groups
+                | smask_t::scales_runtime_data_type
+                | smask_t::zero_points_runtime_groups
+                | smask_t::zero_points_runtime_data_type;
+    if (is_src_dyn_quant) skip_mask |= smask_t::src_dyn_quant_params;
+    // The paged weights and the destination amax are checked when the
+    // configuration is initialized.
+    skip_mask |= smask_t::weights_paging_params | smask_t::dst_amax_params;
+
+    const bool problem_dt_correct = is_int8 || is_bf16 || is_f32 || is_f16
+            || is_wei_decomp || is_src_dyn_quant;
     bool ok = mayiuse(isa) && problem_dt_correct
             && IMPLICATION(is_f16, isa == avx512_core_fp16)
-            && !has_zero_dim_memory() && !has_runtime_dims_or_strides()
-            && attr()->has_default_values(
-                    primitive_attr_t::skip_mask_t::scales_runtime
-                            | primitive_attr_t::skip_mask_t::zero_points_runtime
-                            | primitive_attr_t::skip_mask_t::post_ops
-                            | primitive_attr_t::skip_mask_t::sum_dt,
-                    dst_dt)
+            && !has_zero_dim_memory() && is_dense_data()
+            && check_runtime_dims()
+            && attr()->has_default_values(skip_mask, dst_dt)
             && attr()->post_ops_.check_sum_consistent_dt(dst_dt)
             && check_attr_scales() && check_attr_zero_points() && check_bias();
     if (!ok) return status::unimplemented;
 
     CHECK(init_brgemm_matmul_conf(isa, bgmmc_, *desc(), src_md_, weights_md_,
             dst_md_, bias_md_, attr_));
-
-    const float alpha = 1.0;
-    const float beta = 1.0;
-    const float beta_init = 0.0;
+    if (!paged_weights_ok()) return status::unimplemented;
 
     for_(int i_bs = 0; i_bs < 2; i_bs++)
     for_(int i_init = 0; i_init < 2; i_init++)
     for_(int i_M = 0; i_M < 2; i_M++)
     for_(int i_N = 0; i_N < 2; i_N++)
     for (int i_K = 0; i_K < 2; i_K++) {
-        auto vbeta = (i_init) ? beta_init : beta;
-        auto vM = (i_M) ? bgmmc_.M_tail : bgmmc_.M_blk;
-        auto vN = (i_N) ? bgmmc_.N_tail : bgmmc_.N_blk;
-        auto vK = (i_K) ? bgmmc_.K_tail : bgmmc_.K_blk;
-
-        int bs = get_brg_batchsize(bgmmc_, i_bs, i_K);
         int idx = get_brg_kernel_idx(i_bs, i_init, i_M, i_N, i_K);
         if (idx < 0) continue;
         brgemm_t &brg = brg_descs_[idx];
-        auto LDA = i_K && bgmmc_.use_buffer_a_tail_only
-                ? (dim_t)bgmmc_.wei_k_blk
-                : bgmmc_.LDA;
-        CHECK(brgemm_desc_init(&brg, isa, bgmmc_.brg_type, bgmmc_.src_dt,
-                bgmmc_.wei_dt, false, false, brgemm_row_major, alpha, vbeta,
-                LDA, bgmmc_.LDB, bgmmc_.LDC, vM, vN, vK));
-
-        auto LDD = bgmmc_.LDD;
-        CHECK(brgemm_desc_set_postops(
-                &brg, attr(), &dst_md_, LDD, bgmmc_.bia_dt));
-
-        brgemm_attr_t brgattr;
-        brgattr.generate_skip_accumulation
-                = bgmmc_.post_ops_applicable && bgmmc_.nthr_k > 1;
-        const bool is_amx = is_superset(isa, avx512_core_amx);
-        if (is_amx) {
-            if (!brgattr.generate_skip_accumulation) {
-                // TODO: uker doesn't yet support generate_skip_accumulation
-                brgattr.use_uker = true;
-                brgattr.use_interleave_stores = true;
-            }
-            brgattr.max_bs = bs;
-            brgattr.wary_tail_read = false;
-
-            // TODO: change expected sizes to local chunks wrt L2 blocking
-            brgattr.hint_expected_A_size = vM * vK * bs;
-            brgattr.hint_expected_B_size = vN * vK * bs;
-            brgattr.hint_expected_C_size = vM * vN * bs;
-            brgattr.hint_innermost_loop = brgemm_innermost_undef;
-            brgattr.hint_prefetching = brgemm_kernel_prefetching_t::brgemm_prf1;
-        }
-
-        CHECK(brgemm_desc_set_attr(&brg, brgattr));
+        const dim_t vM = (i_M) ? bgmmc_.M_tail : bgmmc_.M_blk;
+        CHECK(init_brg_desc(brg, i_bs, i_init, vM, i_N, i_K));
         bgmmc_.wsp_tile_per_thr_bytes = nstl::max(
                 brg.get_wsp_buffer_size(), bgmmc_.wsp_tile_per_thr_bytes);
     }
@@ -177,8 +250,67 @@ status_t brgemm_matmul_t<isa>::pd_t::init(engine_t *engine) {
     return status::success;
 }
 
+template <cpu_isa_t isa>
+status_t brgemm_matmul_t<isa>::pd_t::init_brg_desc(brgemm_t &brg,
+        bool is_bs_tail, bool do_initialization, dim_t vM, bool is_N_tail,
+        bool is_K_tail) const {
+    const float alpha = 1.0;
+    const float beta = 1.0;
+    const float beta_init = 0.0;
+
+    auto vbeta = (do_initialization) ? beta_init : beta;
+    auto vN = (is_N_tail) ? bgmmc_.N_tail : bgmmc_.N_blk;
+    auto vK = (is_K_tail) ? bgmmc_.K_tail : bgmmc_.K_blk;
+
+    int bs = get_brg_batchsize(bgmmc_, is_bs_tail, is_K_tail);
+    auto LDA = is_K_tail && bgmmc_.use_buffer_a_tail_only
+            ? (dim_t)bgmmc_.wei_k_blk
+            : bgmmc_.LDA;
+    CHECK(brgemm_desc_init(&brg, isa, bgmmc_.brg_type, bgmmc_.src_dt,
+            bgmmc_.wei_dt, false, false, brgemm_row_major, alpha, vbeta, LDA,
+            bgmmc_.LDB, bgmmc_.LDC, vM, vN, vK));
+
+    auto LDD = bgmmc_.LDD;
+    CHECK(brgemm_desc_set_postops(&brg, attr(), &dst_md_, LDD, bgmmc_.bia_dt));
+    // The weights scales and zero points applied on decompression are not
+    // seen by the kernel.
+    if (bgmmc_.with_wei_decomp_scales) {
+        brg.with_scales = bgmmc_.with_scales;
+        brg.is_oc_scale = false;
+    }
+    brg.zp_type_b = bgmmc_.wei_zp_type;
+    brg.with_src_row_scales = bgmmc_.with_src_dyn_quant;
+    brg.with_dst_amax = bgmmc_.with_dst_amax;
+
+    brgemm_attr_t brgattr;
+    brgattr.generate_skip_accumulation
+            = bgmmc_.post_ops_applicable && bgmmc_.nthr_k > 1;
+    brgattr.allow_empty_batch = bgmmc_.skip_zero_b_blocks;
+    const bool is_amx = is_superset(isa, avx512_core_amx);
+    if (is_amx) {
+        if (!brgattr.generate_skip_accumulation && !bgmmc_.with_dst_amax) {
+            // TODO: uker doesn't yet support generate_skip_accumulation and
+            // the destination amax
+            brgattr.use_uker = true;
+            brgattr.use_interleave_stores = true;
+        }
+        brgattr.max_bs = bs;
+        brgattr.wary_tail_read = false;
+
+        // TODO: change expected sizes to local chunks wrt L2 blocking
+        brgattr.hint_expected_A_size = vM * vK * bs;
+        brgattr.hint_expected_B_size = vN * vK * bs;
+        brgattr.hint_expected_C_size = vM * vN * bs;
+        brgattr.hint_innermost_loop = brgemm_innermost_undef;
+        brgattr.hint_prefetching = brgemm_kernel_prefetching_t::brgemm_prf1;
+    }
+
+    return brgemm_desc_set_attr(&brg, brgattr);
+}
+
 template <cpu_isa_t isa>
 status_t brgemm_matmul_t<isa>::init(engine_t *engine) {
+    brg_kernels_.resize(max_num_brg_kernels_matmul, pd()->name());
     for_(int i_bs = 0; i_bs < 2; i_bs++)
     for_(int i_M = 0; i_M < 2; i_M++)
     for_(int i_N = 0; i_N < 2; i_N++)
@@ -187,15 +319,22 @@ status_t brgemm_matmul_t<isa>::init(engine_t *engine) {
         int idx = pd()->get_brg_kernel_idx(i_bs, i_init, i_M, i_N, i_K);
         if (idx < 0) continue;
 
-        brgemm_kernel_t *ker = nullptr;
-        CHECK(brgemm_kernel_create(&ker, pd()->get_brg_desc(idx)));
-        CHECK(safe_ptr_assign(brg_kernels_[idx], ker));
+        // Kernels for the tails are generated on the first use only.
+        const bool is_tail = i_bs || i_M || i_N || i_K;
+        CHECK(brg_kernels_.insert(idx, pd()->get_brg_desc(idx), is_tail));
         if (is_superset(isa, avx512_core_amx))
             CHECK(brgemm_init_tiles(
                     pd()->get_brg_desc(idx), &brg_kernel_palettes_[idx][0]));
     }
 
     const auto &bgmmc = pd()->get_brgemm_matmul_conf();
+    if (bgmmc.is_runtime_M) {
+        M_tail_kernels_.reset(
+                new std::atomic<M_tail_kernels_t *>[bgmmc.M_blk]);
+        for (dim_t i = 0; i < bgmmc.M_blk; i++)
+            M_tail_kernels_[i] = nullptr;
+    }
+
     if (bgmmc.use_buffer_b)
         CHECK(create_brgemm_matmul_copy_b(copy_B_kernel_, &bgmmc));
 
@@ -215,23 +354,186 @@ status_t brgemm_matmul_t<isa>::init(engine_t *engine) {
     return status::success;
 }
 
+template <cpu_isa_t isa>
+brgemm_matmul_t<isa>::~brgemm_matmul_t() {
+    if (!M_tail_kernels_) return;
+    for (dim_t i = 0; i < pd()->get_brgemm_matmul_conf().M_blk; i++)
+        delete M_tail_kernels_[i].load();
+}
+
+template <cpu_isa_t isa>
+int brgemm_matmul_t<isa>::get_brg_kernel_idx(const brgemm_matmul_conf_t &bgmmc,
+        bool is_bs_tail, bool do_initialization, bool is_M_tail,
+        bool is_N_tail, bool is_K_tail) const {
+    int bs = get_brg_batchsize(bgmmc, is_bs_tail, is_K_tail);
+    int idx = get_brg_kernel_index(bgmmc, is_bs_tail, do_initialization,
+            is_M_tail, is_N_tail, is_K_tail, bs);
+    if (idx < 0 || !(bgmmc.is_runtime_M && is_M_tail)) return idx;
+    return static_cast<int>(bgmmc.M_tail) * max_num_brg_kernels_matmul + idx;
+}
+
+template <cpu_isa_t isa>
+const brgemm_kernel_t *brgemm_matmul_t<isa>::get_brg_kernel(int idx) const {
+    if (idx < max_num_brg_kernels_matmul) return brg_kernels_.get(idx);
+    const auto *M_tail_kernels
+            = get_M_tail_kernels(idx / max_num_brg_kernels_matmul);
+    if (M_tail_kernels == nullptr) return nullptr;
+    return M_tail_kernels->kernels.get(idx % max_num_brg_kernels_matmul);
+}
+
+template <cpu_isa_t isa>
+const char *brgemm_matmul_t<isa>::get_brg_kernel_palette(int idx) const {
+    if (idx < max_num_brg_kernels_matmul) return brg_kernel_palettes_[idx];
+    // The kernel is always requested before its palette, so the tail kernels
+    // exist at this point.
+    const auto *M_tail_kernels
+            = get_M_tail_kernels(idx / max_num_brg_kernels_matmul);
+    assert(M_tail_kernels != nullptr);
+    return M_tail_kernels->palettes[idx % max_num_brg_kernels_matmul];
+}
+
+template <cpu_isa_t isa>
+const typename brgemm_matmul_t<isa>::M_tail_kernels_t *
+brgemm_matmul_t<isa>::get_M_tail_kernels(dim_t M_tail) const {
+    assert(M_tail_kernels_ && M_tail > 0
+            && M_tail < pd()->get_brgemm_matmul_conf().M_blk);
+    auto &M_tail_kernels_ptr = M_tail_kernels_[M_tail];
+    const M_tail_kernels_t *M_tail_kernels
+            = M_tail_kernels_ptr.load(std::memory_order_acquire);
+    if (M_tail_kernels) return M_tail_kernels;
+
+    std::lock_guard<std::mutex> lock(M_tail_kernels_mutex_);
+    M_tail_kernels = M_tail_kernels_ptr.load(std::memory_order_acquire);
+    if (M_tail_kernels) return M_tail_kernels;
+    if (M_tail_kernels_status_.load() != status::success) return nullptr;
+
+    std::unique_ptr<M_tail_kernels_t> new_kernels(new M_tail_kernels_t());
+    auto status = [&]() -> status_t {
+        auto bgmmc = pd()->get_brgemm_matmul_conf();
+        bgmmc.M_tail = M_tail;
+
+        new_kernels->kernels.resize(max_num_brg_kernels_matmul, pd()->name());
+        for_(int i_bs = 0; i_bs < 2; i_bs++)
+        for_(int i_N = 0; i_N < 2; i_N++)
+        for_(int i_K = 0; i_K < 2; i_K++)
+        for (int i_init = 0; i_init < 2; i_init++) {
+            int bs = get_brg_batchsize(bgmmc, i_bs, i_K);
+            int idx = get_brg_kernel_index(
+                    bgmmc, i_bs, i_init, true, i_N, i_K, bs);
+            if (idx < 0) continue;
+
+            brgemm_t &brg = new_kernels->brg_descs[idx];
+            CHECK(pd()->init_brg_desc(brg, i_bs, i_init, M_tail, i_N, i_K));
+            // The tile workspace is booked for the full M block.
+            if (brg.get_wsp_buffer_size() > bgmmc.wsp_tile_per_thr_bytes)
+                return status::unimplemented;
+            CHECK(new_kernels->kernels.insert(idx, brg, true));
+            if (is_superset(isa, avx512_core_amx))
+                CHECK(brgemm_init_tiles(brg, new_kernels->palettes[idx]));
+        }
+        return status::success;
+    }();
+    if (status != status::success) {
+        M_tail_kernels_status_ = status;
+        return nullptr;
+    }
+    M_tail_kernels = new_kernels.get();
+    M_tail_kernels_ptr.store(new_kernels.release(), std::memory_order_release);
+    return M_tail_kernels;
+}
+
+template <cpu_isa_t isa>
+void brgemm_matmul_t<isa>::maybe_tile_configure(
+        bool is_amx, int brg_ker_idx, int &prev_ker_idx) const {
+    if (!is_amx) return;
+    if (brg_ker_idx == prev_ker_idx) return;
+    const char *palette = get_brg_kernel_palette(brg_ker_idx);
+    // TODO: more accurately estimate the costs of memcmp and tile configuration
+    if (prev_ker_idx == -1
+            || std::memcmp(palette, get_brg_kernel_palette(prev_ker_idx),
+                       AMX_PALETTE_SIZE)
+                    != 0)
+        amx_tile_configure(palette);
+    prev_ker_idx = brg_ker_idx;
+}
+
+template <cpu_isa_t isa>
+status_t brgemm_matmul_t<isa>::get_kernels_status() const {
+    CHECK(brg_kernels_.status());
+    if (!M_tail_kernels_) return status::success;
+    CHECK(M_tail_kernels_status_.load());
+    for (dim_t i = 0; i < pd()->get_brgemm_matmul_conf().M_blk; i++) {
+        const auto *M_tail_kernels = M_tail_kernels_[i].load();
+        if (M_tail_kernels) CHECK(M_tail_kernels->kernels.status());
+    }
+    return status::success;
+}
+
 template <cpu_isa_t isa>
 status_t brgemm_matmul_t<isa>::execute_body(const exec_ctx_t &ctx) const {
+    const auto &conf = pd()->get_brgemm_matmul_conf();
+    // The weights scales and zero points applied on decompression do not
+    // contribute to the output scales and the zero point compensation, they
+    // are expanded in the scratchpad instead.
+    const primitive_attr_t *wei_scales_attr
+            = conf.with_wei_decomp_scales ? &default_attr() : pd()->attr();
+    const primitive_attr_t *wei_zp_attr = conf.with_wei_decomp_zero_points
+                    || conf.wei_zp_type == brgemm_broadcast_t::per_n
+            ? &default_attr()
+            : pd()->attr();
+
     DEFINE_ZERO_POINT_VALUE(src_zero_point, DNNL_ARG_SRC);
-    DEFINE_ZERO_POINT_VALUE(wei_zero_point, DNNL_ARG_WEIGHTS);
+    DEFINE_ZERO_POINT_VALUE_ATTR(
+            wei_zp_attr, wei_zero_point, DNNL_ARG_WEIGHTS);
     DEFINE_ZERO_POINT_VALUE(dst_zero_point, DNNL_ARG_DST);
     DEFINE_ARG_SCALES_BUFFER(src_scales, DNNL_ARG_SRC);
-    DEFINE_ARG_SCALES_BUFFER(wei_scales, DNNL_ARG_WEIGHTS);
+    DEFINE_ARG_SCALES_BUFFER_ATTR(
+            wei_scales_attr, wei_scales, DNNL_ARG_WEIGHTS);
     DEFINE_ARG_SCALES_BUFFER(dst_scales, DNNL_ARG_DST);
+    DEFINE_DST_AMAX_BUFFER(dst_amax);
+    if (dst_amax) *dst_amax = 0.f;
 
     auto &scratchpad = ctx.get_scratchpad_grantor();
-    const float *oscales = precompute_scales(
-            scratchpad, src_scales, wei_scales, pd()->N(), pd()->attr());
+    const float *oscales = conf.with_wei_decomp_scales
+            ? src_scales
+            : precompute_scales(scratchpad, src_scales, wei_scales, pd()->N(),
+                    pd()->attr());
+
+    if (conf.with_wei_decomp_scales)
+        CHECK(expand_wei_decomp_params(
+                scratchpad.template get<float>(
+                        key_brgemm_primitive_wei_decomp_scales),
+                ctx, DNNL_ARG_ATTR_SCALES | DNNL_ARG_WEIGHTS,
+                conf.wei_decomp_scales_dt, conf.wei_decomp_scales_group_k,
+                conf.wei_decomp_scales_per_n, conf.wei_decomp_group_k, conf.K,
+                conf.N));
+    if (conf.with_wei_decomp_zero_points)
+        CHECK(expand_wei_decomp_params(
+                scratchpad.template get<float>(
+                        key_brgemm_primitive_wei_decomp_zero_points),
+                ctx, DNNL_ARG_ATTR_ZERO_POINTS | DNNL_ARG_WEIGHTS,
+                conf.wei_decomp_zero_points_dt,
+                conf.wei_decomp_zero_points_group_k,
+                conf.wei_decomp_zero_points_per_n, conf.wei_decomp_group_k,
+                conf.K, conf.N));
+    if (conf.wei_zp_type == brgemm_broadcast_t::per_n)
+        CHECK(expand_wei_zero_points(
+                scratchpad.template get<int32_t>(
+                        key_brgemm_primitive_wei_zp_values),
+                ctx, pd()->attr(), conf));
+
+    const int32_t *wei_page_table = nullptr;
+    if (conf.wei_page_size > 0)
+        CHECK(cpu::matmul::get_wei_page_table(ctx,
+                memory_desc_wrapper(pd()->weights_md(0)), conf.wei_page_size,
+                wei_page_table));
 
     brg_matmul_exec_ctx_t brgmm_ctx(ctx, pd(), oscales, src_zero_point,
-            wei_zero_point, dst_zero_point, dst_scales);
+            wei_zero_point, dst_zero_point, dst_scales, wei_page_table);
+
+    const auto &bgmmc = brgmm_ctx.get_brgemm_matmul_conf();
+    if (bgmmc.M == 0) return status::success;
 
-    const auto &bgmmc = pd()->get_brgemm_matmul_conf();
     const bool use_buffer_a
             = bgmmc.use_buffer_a || bgmmc.use_buffer_a_tail_only;
     const bool is_amx = is_superset(isa, avx512_core_amx);
@@ -250,8 +552,8 @@ status_t brgemm_matmul_t<isa>::execute_body(const exec_ctx_t &ctx) const {
                     ithr_k, kc_start, kc_end);
 
         int prev_ker_idx = -1;
-        maybe_tile_configure(is_amx, brg_kernel_palettes_,
-                brgmm_ctx.get_base_brgemm_kernel_idx(), prev_ker_idx);
+        maybe_tile_configure(
+                is_amx, brgmm_ctx.get_base_brgemm_kernel_idx(), prev_ker_idx);
 
         int b {0}, mc {0}, nc {0};
         nd_iterator_init(
@@ -283,7 +585,10 @@ status_t brgemm_matmul_t<isa>::execute_body(const exec_ctx_t &ctx) const {
 
     maybe_reduce_partial_results_and_apply_postops(brgmm_ctx);
 
-    return status::success;
+    if (dst_amax) *dst_amax = brgmm_ctx.reduce_dst_amax();
+
+    // Reports a failure of a lazy kernel generation during the execution.
+    return get_kernels_status();
 }
 
 template <cpu_isa_t isa>
@@ -292,7 +597,7 @@ void brgemm_matmul_t<isa>::compute_kernel(
         int m_blk_idx, int n_blk_idx, int k_chunk_idx, bool do_init,
         int &prev_ker_idx) const {
     const bool is_amx = is_superset(isa, avx512_core_amx);
-    const auto &bgmmc = pd()->get_brgemm_matmul_conf();
+    const auto &bgmmc = brgmm_ctx.get_brgemm_matmul_conf();
     const auto addr_batch = brgmm_ctx.get_batch_elem_ptr(ithr);
 
     const auto wsp_tile = brgmm_ctx.get_tile_workspace(ithr);
@@ -312,8 +617,8 @@ void brgemm_matmul_t<isa>::compute_kernel(
     const bool is_K_tail
             = is_last_K_chunk && (gemm_batch * bgmmc.K_blk) != remaining_k_blks;
     auto is_bs_tail = (gemm_batch != bgmmc.brgemm_batch_size);
-    const int brg_ker_idx = pd()->get_brg_kernel_idx(
-            is_bs_tail, do_init, is_M_tail, is_N_tail, false);
+    const int brg_ker_idx = get_brg_kernel_idx(
+            bgmmc, is_bs_tail, do_init, is_M_tail, is_N_tail, false);
     const auto ptr_bias = brgmm_ctx.get_bias_ptr(n);
     auto ptr_D = brgmm_ctx.get_data_C_ptr(b_idx, m, n);
     auto ptr_C = (bgmmc.use_buffer_c)
@@ -331,13 +636,17 @@ void brgemm_matmul_t<isa>::compute_kernel(
             && (brgmm_ctx.get_num_threads_for_k() <= 1 || bgmmc.K_chunks == 1);
 
     if (gemm_batch > 0 && brg_ker_idx >= 0) {
-        const auto brg_kernel = brg_kernels_[brg_ker_idx].get();
-        assert(brg_kernel != nullptr);
-        maybe_tile_configure(
-                is_amx, brg_kernel_palettes_, brg_ker_idx, prev_ker_idx);
+        const auto brg_kernel = get_brg_kernel(brg_ker_idx);
+        if (brg_kernel == nullptr) return;
+        maybe_tile_configure(is_amx, brg_ker_idx, prev_ker_idx);
 
         brgmm_ctx.init_brgemm_batch_elements_values(
                 ithr, 0, gemm_batch, b_idx, m_blk_idx, k_blk_idx, n_blk_idx);
+        // The kernel is called even if all the blocks are skipped to
+        // initialize C and apply the post-ops.
+        const int brg_bs = bgmmc.skip_zero_b_blocks
+                ? brgmm_ctx.skip_zero_b_blocks(ithr, gemm_batch)
+                : gemm_batch;
 
         if (post_ops_applicable && is_last_K_chunk && !is_K_tail) {
             void *scratch = is_amx
@@ -361,12 +670,15 @@ void brgemm_matmul_t<isa>::compute_kernel(
                     static_cast<const void *>(zp_comp_a),
                     static_cast<const void *>(zp_comp_b),
                     static_cast<const void *>(zp_c_val_ptr), false, 1, false,
-                    false, brgmm_ctx.get_dst_scales_ptr()};
+                    false, brgmm_ctx.get_dst_scales_ptr(),
+                    brgmm_ctx.get_src_dyn_quant_scales_ptr(ithr, m_blk_idx),
+                    brgmm_ctx.get_wei_zp_values_ptr(n),
+                    brgmm_ctx.get_dst_amax_ptr(ithr)};
 
-            brgemm_kernel_execute_postops(brg_kernel, gemm_batch, addr_batch,
+            brgemm_kernel_execute_postops(brg_kernel, brg_bs, addr_batch,
                     (void *)ptr_C, (void *)ptr_D, post_ops_data, scratch);
         } else {
-            brgemm_kernel_execute(brg_kernel, gemm_batch, addr_batch,
+            brgemm_kernel_execute(brg_kernel, brg_bs, addr_batch,
                     (void *)ptr_C, is_amx ? (void *)wsp_tile : nullptr);
         }
     }
@@ -375,11 +687,11 @@ void brgemm_matmul_t<isa>::compute_kernel(
                 ithr, gemm_batch, 1, b_idx, m_blk_idx, k_blk_idx, n_blk_idx);
 
         const bool use_init_ker = (do_init && gemm_batch == 0);
-        const int brg_ker_idx = pd()->get_brg_kernel_idx(
-                false, use_init_ker, is_M_tail, is_N_tail, true);
-        maybe_tile_configure(
-                is_amx, brg_kernel_palettes_, brg_ker_idx, prev_ker_idx);
-        const auto brg_kernel_k_tail = brg_kernels_[brg_ker_idx].get();
+        const int brg_ker_idx = get_brg_kernel_idx(
+                bgmmc, false, use_init_ker, is_M_tail, is_N_tail, true);
+        maybe_tile_configure(is_amx, brg_ker_idx, prev_ker_idx);
+        const auto brg_kernel_k_tail = get_brg_kernel(brg_ker_idx);
+        if (brg_kernel_k_tail == nullptr) return;
 
         if (post_ops_applicable) {
             void *scratch = is_amx
@@ -403,7 +715,10 @@ void brgemm_matmul_t<isa>::compute_kernel(
                     static_cast<const void *>(zp_comp_a),
                     static_cast<const void *>(zp_comp_b),
                     static_cast<const void *>(zp_c_val_ptr), false, 1, false,
-                    false, brgmm_ctx.get_dst_scales_ptr()};
+                    false, brgmm_ctx.get_dst_scales_ptr(),
+                    brgmm_ctx.get_src_dyn_quant_scales_ptr(ithr, m_blk_idx),
+                    brgmm_ctx.get_wei_zp_values_ptr(n),
+                    brgmm_ctx.get_dst_amax_ptr(ithr)};
 
             brgemm_kernel_execute_postops(brg_kernel_k_tail, 1, addr_batch,
                     (void *)ptr_C, (void *)ptr_D, post_ops_data, scratch);
@@ -421,7 +736,7 @@ void brgemm_matmul_t<isa>::maybe_reduce_partial_results_and_apply_postops(
 
     const bool is_amx = is_superset(isa, avx512_core_amx);
 
-    const auto &bgmmc = pd()->get_brgemm_matmul_conf();
+    const auto &bgmmc = brgmm_ctx.get_brgemm_matmul_conf();
     const int num_threads = brgmm_ctx.get_num_threads_for_parallelization();
 
     parallel(num_threads, [&](const int ithr, const int nthr) {
@@ -477,11 +792,12 @@ void brgemm_matmul_t<isa>::maybe_reduce_partial_results_and_apply_postops(
                     for (int nb = nb_start; nb < nb_end; nb++) {
                         const bool is_N_tail
                                 = (bgmmc.N - nb * bgmmc.N_blk < bgmmc.N_blk);
-                        const int brg_ker_idx = pd()->get_brg_kernel_idx(
+                        const int brg_ker_idx = get_brg_kernel_idx(bgmmc,
                                 false, false, is_M_tail, is_N_tail, false);
-                        maybe_tile_configure(is_amx, brg_kernel_palettes_,
-                                brg_ker_idx, prev_ker_idx);
-                        const auto brg_kernel = brg_kernels_[brg_ker_idx].get();
+                        maybe_tile_configure(
+                                is_amx, brg_ker_idx, prev_ker_idx);
+                        const auto brg_kernel = get_brg_kernel(brg_ker_idx);
+                        if (brg_kernel == nullptr) continue;
                         const int m = mb * bgmmc.M_blk;
                         const int n = nb * bgmmc.N_blk;
                         const auto ptr_bias = brgmm_ctx.get_bias_ptr(n);
@@ -521,7 +837,11 @@ void brgemm_matmul_t<isa>::maybe_reduce_partial_results_and_apply_postops(
                                 static_cast<const void *>(zp_comp_b),
                                 static_cast<const void *>(zp_c_val_ptr),
                                 skip_accumulation, 1, false, false,
-                                brgmm_ctx.get_dst_scales_ptr()};
+                                brgmm_ctx.get_dst_scales_ptr(),
+                                brgmm_ctx.get_src_dyn_quant_scales_ptr(
+                                        ithr, mb),
+                                brgmm_ctx.get_wei_zp_values_ptr(n),
+                                brgmm_ctx.get_dst_amax_ptr(ithr)};
 
                         brgemm_kernel_execute_postops(brg_kernel, 0, nullptr,
                                 (void *)ptr_C, (void *)ptr_D, post_ops_data,
@@ -540,7 +860,7 @@ template <cpu_isa_t isa>
 void brgemm_matmul_t<isa>::copy_a_chunk_in_buffer(
         const brg_matmul_exec_ctx_t &brgmm_ctx, int ithr, int b_idx,
         int m_blk_idx, int k_chunk_idx) const {
-    const auto &bgmmc = pd()->get_brgemm_matmul_conf();
+    const auto &bgmmc = brgmm_ctx.get_brgemm_matmul_conf();
 
     auto ctx = jit_brgemm_matmul_copy_a_t::ctx_t();
     const int k_start = k_chunk_idx * bgmmc.K_chunk_elems;
@@ -560,6 +880,8 @@ void brgemm_matmul_t<isa>::copy_a_chunk_in_buffer(
                     ithr, m_blk_idx);
     ctx.zp_b_neg_value_ptr = (void *)brgmm_ctx.get_zp_b_neg_val_ptr();
     ctx.zp_ab_comp_ptr = (void *)brgmm_ctx.get_zp_ab_mixed_comp_ptr();
+    ctx.src_dyn_quant_scales_ptr
+            = (void *)brgmm_ctx.get_src_dyn_quant_scales_ptr(ithr, m_blk_idx);
 
     for (int gb = 0; gb < gemm_batch_iters; gb++) {
         const int k = k_start + gb * bgmmc.K_blk;
@@ -587,7 +909,7 @@ template <cpu_isa_t isa>
 void brgemm_matmul_t<isa>::copy_b_chunk_in_buffer(
         const brg_matmul_exec_ctx_t &brgmm_ctx, int ithr, int b_idx,
         int n_blk_idx, int k_chunk_idx) const {
-    const auto &bgmmc = pd()->get_brgemm_matmul_conf();
+    const auto &bgmmc = brgmm_ctx.get_brgemm_matmul_conf();
 
     const int k_start = k_chunk_idx * bgmmc.K_chunk_elems;
     const bool is_K_tail
@@ -602,6 +924,41 @@ void brgemm_matmul_t<isa>::copy_b_chunk_in_buffer(
             ithr, b_idx, n_blk_idx);
     ctx.zp_a_neg_value_ptr = (void *)brgmm_ctx.get_zp_a_neg_val_ptr();
 
+    // With the decompression parameters the copy routine is called for every
+    // group of rows separately, so that a call uses a single row of them.
+    // The weights paged along K are copied page by page in the same way.
+    const bool is_wei_paged_k
+            = bgmmc.wei_page_size > 0 && bgmmc.is_wei_paged_along_k;
+    auto copy_B = [&]() {
+        if (!(bgmmc.with_wei_decomp_scales || bgmmc.with_wei_decomp_zero_points
+                    || is_wei_paged_k)) {
+            (*copy_B_kernel_)(&ctx);
+            return;
+        }
+        const dim_t group_k = is_wei_paged_k
+                ? math::gcd((int)bgmmc.wei_decomp_group_k,
+                        (int)bgmmc.wei_page_size)
+                : bgmmc.wei_decomp_group_k;
+        const dim_t k_beg = ctx.current_K_start;
+        const dim_t k_end = k_beg + ctx.current_K_iters;
+        auto group_ctx = ctx;
+        for (dim_t k = k_beg; k < k_end;) {
+            const dim_t k_next
+                    = nstl::min(k_end, utils::rnd_dn(k, group_k) + group_k);
+            group_ctx.src = (void *)brgmm_ctx.get_data_B_ptr(b_idx, k, n);
+            group_ctx.tr_src = (const char *)ctx.tr_src
+                    + (k - k_beg) * bgmmc.LDB * bgmmc.tr_b_dt_sz;
+            group_ctx.current_K_start = k;
+            group_ctx.current_K_iters = k_next - k;
+            group_ctx.wei_decomp_scales_ptr
+                    = brgmm_ctx.get_wei_decomp_scales_ptr(k, n);
+            group_ctx.wei_decomp_zero_points_ptr
+                    = brgmm_ctx.get_wei_decomp_zero_points_ptr(k, n);
+            (*copy_B_kernel_)(&group_ctx);
+            k = k_next;
+        }
+    };
+
     int gb = 0;
     for (; gb < gemm_batch; gb++) {
         const int k = k_start + gb * bgmmc.K_blk;
@@ -615,8 +972,11 @@ void brgemm_matmul_t<isa>::copy_b_chunk_in_buffer(
             cvt_float16_to_float((float *)ctx.tr_src, (float16_t *)ctx.src,
                     bgmmc.wei_n_blk * ctx.current_K_iters);
         } else {
-            (*copy_B_kernel_)(&ctx);
+            copy_B();
         }
+        if (bgmmc.skip_zero_b_blocks)
+            brgmm_ctx.get_buf_B_mask_ptr(ithr)[gb] = !is_zero_buffer(
+                    (const char *)ctx.tr_src, bgmmc.buffer_b_chunk_sz);
     }
 
     if (is_K_tail) {
@@ -631,7 +991,7 @@ void brgemm_matmul_t<isa>::copy_b_chunk_in_buffer(
             cvt_float16_to_float((float *)ctx.tr_src, (float16_t *)ctx.src,
                     bgmmc.wei_n_blk * ctx.current_K_iters);
         } else {
-            (*copy_B_kernel_)(&ctx);
+            copy_B();
         }
     }
 }
@@ -653,18 +1013,20 @@ template <cpu_isa_t isa>
 struct brgemm_matmul_t<isa>::brg_matmul_exec_ctx_t {
     brg_matmul_exec_ctx_t(const exec_ctx_t &ctx, const pd_t *pd,
             const float *oscales, int32_t src_zp, int32_t wei_zp,
-            int32_t dst_zp, const float *dst_scales)
-        : bgmmc_(pd->get_brgemm_matmul_conf()) {
+            int32_t dst_zp, const float *dst_scales,
+            const int32_t *wei_page_table)
+        : bgmmc_(init_conf(ctx, pd)) {
 
         data_A_ptr_ = CTX_IN_MEM(const char *, DNNL_ARG_SRC);
         data_B_ptr_ = CTX_IN_MEM(const char *, DNNL_ARG_WEIGHTS);
         data_C_ptr_ = CTX_OUT_MEM(char *, DNNL_ARG_DST);
 
         bias_ptr_ = CTX_IN_MEM(const char *, DNNL_ARG_BIAS);
+        wei_page_table_ = wei_page_table;
         oscales_ptr_ = oscales;
         dst_scales_ptr_ = dst_scales;
         memory_tracking::grantor_t scratchpad = ctx.get_scratchpad_grantor();
-        const auto &bgmmc = pd->get_brgemm_matmul_conf();
+        const auto &bgmmc = bgmmc_;
 
         batch_element_ptr_ = scratchpad.template get<brgemm_batch_element_t>(
                 key_brgemm_primitive_batch);
@@ -679,10 +1041,28 @@ struct brgemm_matmul_t<isa>::brg_matmul_exec_ctx_t {
                 ? scratchpad.template get<char>(key_brgemm_primitive_buffer_b)
                 : nullptr;
 
+        buf_B_mask_ptr_ = (bgmmc.skip_zero_b_blocks)
+                ? scratchpad.template get<char>(
+                        key_brgemm_primitive_buffer_b_mask)
+                : nullptr;
+
         buf_C_ptr_ = (bgmmc.use_buffer_c)
                 ? scratchpad.template get<char>(key_brgemm_primitive_buffer)
                 : nullptr;
 
+        wei_decomp_scales_ptr_ = bgmmc.with_wei_decomp_scales
+                ? scratchpad.template get<float>(
+                        key_brgemm_primitive_wei_decomp_scales)
+                : nullptr;
+        wei_decomp_zero_points_ptr_ = bgmmc.with_wei_decomp_zero_points
+                ? scratchpad.template get<float>(
+                        key_brgemm_primitive_wei_decomp_zero_points)
+                : nullptr;
+        wei_zp_values_ptr_ = bgmmc.wei_zp_type == brgemm_broadcast_t::per_n
+                ? scratchpad.template get<int32_t>(
+                        key_brgemm_primitive_wei_zp_values)
+                : nullptr;
+
         is_amx_ = is_superset(isa, avx512_core_amx);
         wsp_tile_ptr_ = is_amx_
                 ? ctx.get_scratchpad_grantor().template get<char>(
@@ -703,6 +1083,18 @@ struct brgemm_matmul_t<isa>::brg_matmul_exec_ctx_t {
         assert(IMPLICATION(bgmmc.s8s8_compensation_required,
                 bgmmc_.b_dt_sz == bgmmc_.tr_b_dt_sz));
 
+        src_dyn_quant_scales_ptr_ = bgmmc.with_src_dyn_quant
+                ? scratchpad.template get<float>(
+                        key_brgemm_primitive_src_dyn_quant_scales)
+                : nullptr;
+
+        dst_amax_ptr_ = bgmmc.with_dst_amax
+                ? scratchpad.template get<float>(key_brgemm_primitive_dst_amax)
+                : nullptr;
+        if (dst_amax_ptr_)
+            utils::array_set(
+                    dst_amax_ptr_, 0, bgmmc.nthr * dst_amax_elems_per_thr);
+
         zero_point_a_compensations_ptr_ = bgmmc.has_zero_point_a
                 ? scratchpad.template get<int32_t>(
                         key_brgemm_primitive_zp_comp_a)
@@ -713,7 +1105,10 @@ struct brgemm_matmul_t<isa>::brg_matmul_exec_ctx_t {
                 : nullptr;
 
         zero_point_a_negative_val_ = -src_zp;
-        zero_point_b_negative_val_ = -wei_zp;
+        // The weights zero points that vary along N are applied by the kernel,
+        // so the compensation only holds the sums of the source rows.
+        zero_point_b_negative_val_
+                = bgmmc.wei_zp_type == brgemm_broadcast_t::per_n ? -1 : -wei_zp;
         zero_point_mixed_ab_compensation_component_
                 = bgmmc.K * zero_point_a_negative_val_;
 
@@ -793,6 +1188,10 @@ struct brgemm_matmul_t<isa>::brg_matmul_exec_ctx_t {
         MAYBE_UNUSED(calculate_compensations_in_copy_routines);
     }
 
+    const brgemm_matmul_conf_t &get_brgemm_matmul_conf() const {
+        return bgmmc_;
+    }
+
     // NOTE: gb --> generalized batch, bb --> broadcast batch
     int get_bb_idx(int gb_idx, const brgemm_matmul_bcast_desc_t &bd) const {
         if (!bd.bcast_mask) // no broadcast
@@ -822,8 +1221,15 @@ struct brgemm_matmul_t<isa>::brg_matmul_exec_ctx_t {
         return data_A_ptr_ + get_data_A_off(cur_b, m, k);
     }
 
+    // The logical index along the paged dimension is mapped to the physical
+    // one, the callers don't cross the page boundaries.
     const char *get_data_B_ptr(int b, int k, int n) const {
         int cur_b = get_bb_idx(b, bgmmc_.bcast_B_desc);
+        if (bgmmc_.wei_page_size > 0) {
+            int &paged_idx = bgmmc_.is_wei_paged_along_k ? k : n;
+            paged_idx = (int)cpu::matmul::get_wei_paged_idx(
+                    wei_page_table_, bgmmc_.wei_page_size, paged_idx);
+        }
         return data_B_ptr_ + get_data_B_off(cur_b, k, n);
     }
 
@@ -856,6 +1262,17 @@ struct brgemm_matmul_t<isa>::brg_matmul_exec_ctx_t {
         }
     }
 
+    // Drops the batch elements pointing to the blocks of B that consist of
+    // zeros only. Returns the number of remaining elements.
+    int skip_zero_b_blocks(int ithr, int brg_batch_iters) const {
+        auto addr_batch = get_batch_elem_ptr(ithr);
+        const char *nz_mask = get_buf_B_mask_ptr(ithr);
+        int bs = 0;
+        for (int b_iter = 0; b_iter < brg_batch_iters; b_iter++)
+            if (nz_mask[b_iter]) addr_batch[bs++] = addr_batch[b_iter];
+        return bs;
+    }
+
     char *get_buf_A_ptr(int ithr, int m_blk_idx, int k_blk_idx) const {
         if (!bgmmc_.use_buffer_a && !bgmmc_.use_buffer_a_tail_only)
             return nullptr;
@@ -875,6 +1292,26 @@ struct brgemm_matmul_t<isa>::brg_matmul_exec_ctx_t {
                 + k_blk_idx * bgmmc_.buffer_b_chunk_sz;
     }
 
+    // The expanded decompression parameters of the row `k` starting from the
+    // column `n`.
+    const float *get_wei_decomp_scales_ptr(dim_t k, dim_t n) const {
+        if (!bgmmc_.with_wei_decomp_scales) return nullptr;
+        return wei_decomp_scales_ptr_
+                + k / bgmmc_.wei_decomp_group_k * bgmmc_.N + n;
+    }
+
+    const float *get_wei_decomp_zero_points_ptr(dim_t k, dim_t n) const {
+        if (!bgmmc_.with_wei_decomp_zero_points) return nullptr;
+        return wei_decomp_zero_points_ptr_
+                + k / bgmmc_.wei_decomp_group_k * bgmmc_.N + n;
+    }
+
+    // Non-zero flags of the blocks of B in the buffer of a thread.
+    char *get_buf_B_mask_ptr(int ithr) const {
+        if (!bgmmc_.skip_zero_b_blocks) return nullptr;
+        return buf_B_mask_ptr_ + ithr * bgmmc_.brgemm_batch_size;
+    }
+
     char *get_buf_C_ptr(int ithr, int m_blk_idx, int n_blk_idx) const {
         if (!bgmmc_.use_buffer_c) return nullptr;
 
@@ -947,9 +1384,12 @@ struct brgemm_matmul_t<isa>::brg_matmul_exec_ctx_t {
                     : bgmmc_.wei_k_blk;
             int k_idx = bgmmc_.blocked_B ? k / dt_b_k_blk : k;
             int n_idx = bgmmc_.blocked_B ? n / bgmmc_.wei_n_blk : n;
-            return bgmmc_.B_strides[2] * b + bgmmc_.B_strides[1] * k_idx
-                    + bgmmc_.B_strides[0] * n_idx
-                    + get_data_B_off_within_block(k, n);
+            // The strides of the sub-byte weights are kept in elements.
+            return (bgmmc_.B_strides[2] * b + bgmmc_.B_strides[1] * k_idx
+                           + bgmmc_.B_strides[0] * n_idx
+                           + get_data_B_off_within_block(k, n))
+                    / types::sub_byte_data_type_multiplier(
+                            bgmmc_.orig_wei_dt);
         }
     }
 
@@ -1014,6 +1454,10 @@ struct brgemm_matmul_t<isa>::brg_matmul_exec_ctx_t {
         return &zero_point_mixed_ab_compensation_component_;
     }
 
+    const int32_t *get_wei_zp_values_ptr(int n) const {
+        return wei_zp_values_ptr_ ? wei_zp_values_ptr_ + n : nullptr;
+    }
+
     const int32_t *get_zp_c_val_ptr() const { return &zero_point_c_val_; }
 
     int32_t *get_zp_a_compensation_ptr(
@@ -1059,6 +1503,32 @@ struct brgemm_matmul_t<isa>::brg_matmul_exec_ctx_t {
                 + m_blk_local * bgmmc_.zp_b_comp_buffer_shift_m;
     }
 
+    // The scales of the quantized rows of the M block are computed by the
+    // thread on copying the block of A.
+    float *get_src_dyn_quant_scales_ptr(int ithr, int m_blk_idx) const {
+        if (!bgmmc_.with_src_dyn_quant) return nullptr;
+
+        const int m_blk_local = m_blk_idx % bgmmc_.M_chunk_size;
+        return src_dyn_quant_scales_ptr_
+                + ithr * bgmmc_.src_dyn_quant_scales_elems_per_thr
+                + m_blk_local * bgmmc_.M_blk;
+    }
+
+    float *get_dst_amax_ptr(int ithr) const {
+        if (!bgmmc_.with_dst_amax) return nullptr;
+        return dst_amax_ptr_ + ithr * dst_amax_elems_per_thr;
+    }
+
+    // The buffers of the threads hold non-negative running maximums and
+    // non-positive running minimums, so the maximum absolute value over all
+    // of them is the maximum absolute value of the destination.
+    float reduce_dst_amax() const {
+        float amax = 0.f;
+        for (dim_t i = 0; i < bgmmc_.nthr * dst_amax_elems_per_thr; i++)
+            amax = nstl::max(amax, std::fabs(dst_amax_ptr_[i]));
+        return amax;
+    }
+
     char *get_tile_workspace(int ithr) const {
         return is_amx_ ? wsp_tile_ptr_ + ithr * bgmmc_.wsp_tile_per_thr_bytes
                        : nullptr;
@@ -1099,7 +1569,22 @@ struct brgemm_matmul_t<isa>::brg_matmul_exec_ctx_t {
     int get_num_threads_for_parallelization() const { return nthr_; }
 
 private:
+    // Returns the configuration of the current execution: the configuration
+    // of the primitive descriptor updated with the actual runtime M, if any.
+    const brgemm_matmul_conf_t &init_conf(
+            const exec_ctx_t &ctx, const pd_t *pd) {
+        const auto &bgmmc = pd->get_brgemm_matmul_conf();
+        if (!bgmmc.is_runtime_M) return bgmmc;
+
+        const memory_desc_wrapper dst_d
+                = ctx.memory_mdw(DNNL_ARG_DST, pd->dst_md());
+        runtime_bgmmc_ = bgmmc;
+        init_runtime_dims(runtime_bgmmc_, dst_d.dims()[bgmmc.ndims - 2]);
+        return runtime_bgmmc_;
+    }
+
     bool is_amx_;
+    brgemm_matmul_conf_t runtime_bgmmc_;
     const brgemm_matmul_conf_t &bgmmc_;
     const char *data_A_ptr_;
     const char *data_B_ptr_;
@@ -1108,10 +1593,15 @@ private:
 
     char *buf_A_ptr_;
     char *buf_B_ptr_;
+    char *buf_B_mask_ptr_;
+    float *wei_decomp_scales_ptr_;
+    float *wei_decomp_zero_points_ptr_;
+    int32_t *wei_zp_values_ptr_;
     char *buf_C_ptr_;
 
     char *wsp_tile_ptr_;
     const char *bias_ptr_;
+    const int32_t *wei_page_table_;
     const float *oscales_ptr_;
     const float *dst_scales_ptr_;
     int32_t *s8s8_compensation_ptr_;
@@ -1119,6 +1609,8 @@ private:
     int32_t *zero_point_a_compensations_ptr_;
     int32_t *zero_point_b_compensations_ptr_;
     int32_t *reorder_zp_a_comp_ptr_;
+    float *src_dyn_quant_scales_ptr_;
+    float *dst_amax_ptr_;
 
     int32_t zero_point_a_negative_val_;
     int32_t zero_point_b_negative_val_;
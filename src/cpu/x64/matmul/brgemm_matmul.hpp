@@ -17,13 +17,19 @@
 #ifndef CPU_X64_MATMUL_BRGEMM_MATMUL_HPP
 #define CPU_X64_MATMUL_BRGEMM_MATMUL_HPP
 
+#include <atomic>
+#include <memory>
+#include <mutex>
+
 #include "common/c_types_map.hpp"
 #include "common/primitive.hpp"
 #include "common/type_helpers.hpp"
 
 #include "cpu/matmul/cpu_matmul_pd.hpp"
 
+#include "cpu/x64/amx_tile_configure.hpp"
 #include "cpu/x64/brgemm/brgemm.hpp"
+#include "cpu/x64/brgemm/brgemm_containers.hpp"
 #include "cpu/x64/cpu_reducer.hpp"
 #include "cpu/x64/matmul/brgemm_matmul_copy_utils.hpp"
 #include "cpu/x64/matmul/brgemm_matmul_utils.hpp"
@@ -82,6 +88,10 @@ struct brgemm_matmul_t : public primitive_t {
         const brgemm_matmul_conf_t &get_brgemm_matmul_conf() const {
             return bgmmc_;
         }
+        // Initializes the descriptor of the kernel that processes `vM` rows.
+        status_t init_brg_desc(brgemm_t &brg, bool is_bs_tail,
+                bool do_initialization, dim_t vM, bool is_N_tail,
+                bool is_K_tail) const;
 
     private:
         brgemm_t brg_descs_[max_num_brg_kernels_matmul];
@@ -89,6 +99,7 @@ struct brgemm_matmul_t : public primitive_t {
     };
 
     brgemm_matmul_t(const pd_t *apd) : primitive_t(apd) {}
+    ~brgemm_matmul_t() override;
 
     status_t init(engine_t *engine) override;
     static constexpr data_type_t acc_type = data_type::s32;
@@ -114,8 +125,32 @@ private:
     void accumulate(
             char *result_ptr, const char *reduce_ptr, size_t size) const;
 
-    std::unique_ptr<brgemm_kernel_t> brg_kernels_[max_num_brg_kernels_matmul];
-    char brg_kernel_palettes_[max_num_brg_kernels_matmul][64];
+    // Kernels for a runtime M tail. They are created on the first execution
+    // with the tail, so that a single primitive serves any M.
+    struct M_tail_kernels_t {
+        brgemm_t brg_descs[max_num_brg_kernels_matmul];
+        char palettes[max_num_brg_kernels_matmul][AMX_PALETTE_SIZE];
+        brgemm_containers::brgemm_kernel_container_t kernels;
+    };
+
+    // Returns the index of the kernel for the execution configuration
+    // `bgmmc`. The kernels for runtime M tails follow the regular ones.
+    int get_brg_kernel_idx(const brgemm_matmul_conf_t &bgmmc, bool is_bs_tail,
+            bool do_initialization, bool is_M_tail, bool is_N_tail,
+            bool is_K_tail) const;
+    const brgemm_kernel_t *get_brg_kernel(int idx) const;
+    const char *get_brg_kernel_palette(int idx) const;
+    const M_tail_kernels_t *get_M_tail_kernels(dim_t M_tail) const;
+    void maybe_tile_configure(
+            bool is_amx, int brg_ker_idx, int &prev_ker_idx) const;
+    status_t get_kernels_status() const;
+
+    brgemm_containers::brgemm_kernel_container_t brg_kernels_;
+    char brg_kernel_palettes_[max_num_brg_kernels_matmul][AMX_PALETTE_SIZE];
+    // Indexed by the M tail, used with runtime M only.
+    std::unique_ptr<std::atomic<M_tail_kernels_t *>[]> M_tail_kernels_;
+    mutable std::mutex M_tail_kernels_mutex_;
+    mutable std::atomic<status_t> M_tail_kernels_status_ {status::success};
     std::unique_ptr<jit_brgemm_matmul_copy_b_t> copy_B_kernel_;
     std::unique_ptr<jit_brgemm_matmul_copy_a_t> copy_A_kernel_;
     std::unique_ptr<cpu_accumulator_1d_t<data_type::f32>> acc_ker_f32_;
@@ -14,6 +14,8 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <cfloat>
+
 #include "common/c_types_map.hpp"
 #include "common/nstl.hpp"
 #include "common/type_helpers.hpp"
@@ -459,7 +461,8 @@ void jit_brgemm_matmul_copy_a_impl_t<Vmm>::generate() {
 
     Label done;
     if (do_compute_compensation_) {
-        assert(conf_->wei_zp_type == brgemm_broadcast_t::per_tensor);
+        assert(one_of(conf_->wei_zp_type, brgemm_broadcast_t::per_tensor,
+                brgemm_broadcast_t::per_n));
 
         mov(reg_K_start, ptr[param1 + GET_OFF(current_K_start)]);
         const auto last_K_threshold
@@ -497,6 +500,241 @@ void jit_brgemm_matmul_copy_a_impl_t<Vmm>::generate() {
 template struct jit_brgemm_matmul_copy_a_impl_t<Zmm>;
 template struct jit_brgemm_matmul_copy_a_impl_t<Ymm>;
 
+// Quantizes the rows of a plain f32 or bf16 A to s8 on copying to the buffer.
+// A row is quantized symmetrically with the scale max(amax, FLT_MIN) / 127,
+// where amax is the maximum absolute value of the whole row. The scales are
+// computed on copying the first block of K and are reused for the rest of the
+// blocks.
+struct jit_brgemm_matmul_copy_a_dyn_quant_t : public jit_brgemm_matmul_copy_a_t,
+                                              public jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_brgemm_matmul_copy_a_dyn_quant_t)
+
+    jit_brgemm_matmul_copy_a_dyn_quant_t(const brgemm_matmul_conf_t *conf)
+        : jit_brgemm_matmul_copy_a_t(conf)
+        , jit_generator(jit_name())
+        , typesize_(conf_->a_dt_sz)
+        , is_bf16_(conf_->orig_src_dt == data_type::bf16)
+        , src_stride_(conf_->K * typesize_)
+        , tr_src_stride_(conf_->LDA * conf_->tr_a_dt_sz) {}
+
+    void operator()(ctx_t *ctx) override { jit_generator::operator()(ctx); }
+    status_t create_kernel() override { return jit_generator::create_kernel(); }
+
+private:
+    using reg64_t = const Xbyak::Reg64;
+    using opmask_t = const Xbyak::Opmask;
+
+    static constexpr int k_step_ = 16;
+    static constexpr int amax_unroll_ = 4;
+
+    const int typesize_;
+    const bool is_bf16_;
+    const dim_t src_stride_;
+    const dim_t tr_src_stride_;
+
+    opmask_t kTail_load = k7;
+    opmask_t kTail_store = k6;
+
+    reg64_t reg_src = rax;
+    reg64_t reg_tr_src = rbx;
+    reg64_t reg_scales = rdx;
+    reg64_t reg_M_blk = r9;
+    reg64_t reg_K_blk = r10;
+    reg64_t reg_K_start = r11;
+    reg64_t reg_aux_src = r12;
+    reg64_t reg_loop = r13;
+    reg64_t regq_tmp = r14;
+
+    const Zmm zmm_abs_mask = Zmm(31);
+    const Zmm zmm_flt_min = Zmm(30);
+    const Zmm zmm_s8_max = Zmm(29);
+    const Zmm zmm_one = Zmm(28);
+    const Zmm zmm_inv_scale = Zmm(27);
+
+    Zmm get_zmm_amax(int i) { return Zmm(i); }
+    Zmm get_zmm_copy(int i) { return Zmm(amax_unroll_ + i); }
+
+    void set_tail_mask(opmask_t k, int nelems);
+    void load(Zmm zmm, const Address &addr, bool is_tail);
+    void compute_row_scale();
+    void quantize_K_loop(bool is_K_tail);
+    void quantize_M_loop(bool is_K_tail, bool is_first_K_blk);
+    void generate() override;
+};
+
+void jit_brgemm_matmul_copy_a_dyn_quant_t::set_tail_mask(
+        opmask_t k, int nelems) {
+    mov(regq_tmp.cvt32(), (1 << nelems) - 1);
+    kmovw(k, regq_tmp.cvt32());
+}
+
+void jit_brgemm_matmul_copy_a_dyn_quant_t::load(
+        Zmm zmm, const Address &addr, bool is_tail) {
+    const auto zmm_load = is_tail ? zmm | kTail_load | T_z : zmm;
+    if (is_bf16_) {
+        vpmovzxwd(zmm_load, addr);
+        vpslld(zmm, zmm, 16);
+    } else
+        vmovups(zmm_load, addr);
+}
+
+void jit_brgemm_matmul_copy_a_dyn_quant_t::compute_row_scale() {
+    const int num_k_steps = conf_->K / k_step_;
+    const int k_tail = conf_->K % k_step_;
+    const int num_loop_iters = num_k_steps / amax_unroll_;
+    const int num_k_steps_tail = num_k_steps % amax_unroll_;
+    const int step_sz = k_step_ * typesize_;
+
+    for (int i = 0; i < amax_unroll_; i++)
+        vpxord(get_zmm_amax(i), get_zmm_amax(i), get_zmm_amax(i));
+
+    auto update_amax = [=](int i, int offset, bool is_tail) {
+        const auto zmm = get_zmm_copy(i);
+        load(zmm, ptr[reg_aux_src + offset], is_tail);
+        vandps(zmm, zmm, zmm_abs_mask);
+        vmaxps(get_zmm_amax(i), get_zmm_amax(i), zmm);
+    };
+
+    mov(reg_aux_src, reg_src);
+    if (num_loop_iters > 0) {
+        Label loop_K;
+        mov(reg_loop, num_loop_iters);
+        L(loop_K);
+        for (int i = 0; i < amax_unroll_; i++)
+            update_amax(i, i * step_sz, false);
+        add(reg_aux_src, amax_unroll_ * step_sz);
+        dec(reg_loop);
+        jnz(loop_K, T_NEAR);
+    }
+    for (int i = 0; i < num_k_steps_tail; i++)
+        update_amax(i, i * step_sz, false);
+    if (k_tail > 0) {
+        set_tail_mask(kTail_load, k_tail);
+        update_amax(0, num_k_steps_tail * step_sz, true);
+    }
+
+    const auto zmm_amax = get_zmm_amax(0);
+    for (int i = 1; i < amax_unroll_; i++)
+        vmaxps(zmm_amax, zmm_amax, get_zmm_amax(i));
+
+    const auto ymm_amax = Ymm(zmm_amax.getIdx());
+    const auto xmm_amax = Xmm(zmm_amax.getIdx());
+    const auto ymm_tmp = Ymm(get_zmm_amax(1).getIdx());
+    const auto xmm_tmp = Xmm(get_zmm_amax(1).getIdx());
+    vextractf64x4(ymm_tmp, zmm_amax, 1);
+    vmaxps(ymm_amax, ymm_amax, ymm_tmp);
+    vextractf128(xmm_tmp, ymm_amax, 1);
+    vmaxps(xmm_amax, xmm_amax, xmm_tmp);
+    vshufps(xmm_tmp, xmm_amax, xmm_amax, 0x4e);
+    vmaxps(xmm_amax, xmm_amax, xmm_tmp);
+    vshufps(xmm_tmp, xmm_amax, xmm_amax, 0xb1);
+    vmaxps(xmm_amax, xmm_amax, xmm_tmp);
+
+    vmaxss(xmm_amax, xmm_amax, Xmm(zmm_flt_min.getIdx()));
+    vdivss(xmm_amax, xmm_amax, Xmm(zmm_s8_max.getIdx()));
+    vmovss(ptr[reg_scales], xmm_amax);
+}
+
+void jit_brgemm_matmul_copy_a_dyn_quant_t::quantize_K_loop(bool is_K_tail) {
+    const int K_blk = is_K_tail ? conf_->K % conf_->K_blk
+                                : nstl::min(conf_->K, conf_->K_blk);
+    const int num_k_steps = K_blk / k_step_;
+    const int k_tail = K_blk % k_step_;
+    const int num_zmm_copy = 16;
+
+    auto quantize = [=](Zmm zmm, int k_idx, bool is_tail) {
+        const size_t offset = static_cast<size_t>(k_idx) * k_step_;
+        load(zmm, ptr[reg_src + offset * typesize_], is_tail);
+        vmulps(zmm, zmm, zmm_inv_scale);
+        vcvtps2dq(zmm, zmm);
+        const auto addr = ptr[reg_tr_src + offset];
+        if (is_tail)
+            vpmovsdb(addr, zmm | kTail_store);
+        else
+            vpmovsdb(addr, zmm);
+    };
+
+    for (int k = 0; k < num_k_steps; k++)
+        quantize(get_zmm_copy(k % num_zmm_copy), k, false);
+    if (k_tail > 0) {
+        // The masked out elements are zeros, so the store zero-pads the row
+        // up to the granularity of the s8 kernels.
+        set_tail_mask(kTail_load, k_tail);
+        set_tail_mask(kTail_store,
+                rnd_up(k_tail, data_type_vnni_granularity(data_type::s8)));
+        quantize(get_zmm_copy(0), num_k_steps, true);
+    }
+}
+
+void jit_brgemm_matmul_copy_a_dyn_quant_t::quantize_M_loop(
+        bool is_K_tail, bool is_first_K_blk) {
+    Label loop_M;
+    L(loop_M);
+
+    if (is_first_K_blk) compute_row_scale();
+    vbroadcastss(zmm_inv_scale, ptr[reg_scales]);
+    vdivps(zmm_inv_scale, zmm_one, zmm_inv_scale);
+    quantize_K_loop(is_K_tail);
+
+    add(reg_src, src_stride_);
+    add(reg_tr_src, tr_src_stride_);
+    add(reg_scales, sizeof(float));
+
+    dec(reg_M_blk);
+    jnz(loop_M, T_NEAR);
+}
+
+void jit_brgemm_matmul_copy_a_dyn_quant_t::generate() {
+    preamble();
+
+    mov(reg_src, ptr[param1 + GET_OFF(src)]);
+    mov(reg_tr_src, ptr[param1 + GET_OFF(tr_src)]);
+    mov(reg_scales, ptr[param1 + GET_OFF(src_dyn_quant_scales_ptr)]);
+    mov(reg_K_blk, ptr[param1 + GET_OFF(current_K_blk)]);
+    mov(reg_M_blk, ptr[param1 + GET_OFF(current_M_blk)]);
+    mov(reg_K_start, ptr[param1 + GET_OFF(current_K_start)]);
+
+    auto set_f32_constant = [=](Zmm zmm, float value) {
+        mov(regq_tmp.cvt32(), float2int(value));
+        vpbroadcastd(zmm, regq_tmp.cvt32());
+    };
+    mov(regq_tmp.cvt32(), 0x7fffffff);
+    vpbroadcastd(zmm_abs_mask, regq_tmp.cvt32());
+    set_f32_constant(zmm_flt_min, FLT_MIN);
+    set_f32_constant(zmm_s8_max, 127.f);
+    set_f32_constant(zmm_one, 1.f);
+
+    auto copy_body = [=](bool is_first_K_blk) {
+        Label copy_body_done;
+        const dim_t K_blk_tail
+                = conf_->K_tail > 0 ? conf_->K % conf_->K_blk : 0;
+        if (K_blk_tail > 0) {
+            Label not_K_tail;
+            cmp(reg_K_blk, K_blk_tail);
+            jne(not_K_tail, T_NEAR);
+            quantize_M_loop(true, is_first_K_blk);
+            jmp(copy_body_done, T_NEAR);
+
+            L(not_K_tail);
+        }
+
+        quantize_M_loop(false, is_first_K_blk);
+        L(copy_body_done);
+    };
+
+    Label not_first_K_blk, done;
+    cmp(reg_K_start, 0);
+    jne(not_first_K_blk, T_NEAR);
+    copy_body(true);
+    jmp(done, T_NEAR);
+
+    L(not_first_K_blk);
+    copy_body(false);
+    L(done);
+
+    postamble();
+}
+
 struct jit_brgemm_matmul_copy_a_transposed_impl_t
     : public jit_brgemm_matmul_copy_a_t,
       public jit_generator {
@@ -1046,7 +1284,8 @@ struct jit_brgemm_matmul_copy_b_int8_t : public jit_brgemm_matmul_copy_b_t,
         , tr_src_stride_(conf->LDB * k_blk_step_ * sizeof(int8_t))
         , is_amx_(mayiuse(avx512_core_amx))
         , do_compute_compensation_(
-                  conf->s8s8_compensation_required || conf->has_zero_point_a) {}
+                  conf->s8s8_compensation_required || conf->has_zero_point_a)
+        , is_wei_u8_(conf->orig_wei_dt == data_type::u8) {}
 
     void operator()(ctx_t *ctx) override { jit_generator::operator()(ctx); }
     status_t create_kernel() override { return jit_generator::create_kernel(); }
@@ -1066,6 +1305,7 @@ protected:
     const dim_t tr_src_stride_;
     const bool is_amx_;
     const bool do_compute_compensation_;
+    const bool is_wei_u8_;
 
     const Xbyak::Opmask kTail = k7;
 
@@ -1090,6 +1330,9 @@ protected:
     // Shared
     Vmm vmm_comp_mul = Vmm(is_ymm_ ? 14 : 30);
     Vmm vmm_zero = Vmm(is_ymm_ ? 15 : 31);
+    // The register is not used by the copy routines of the Intel AVX-512
+    // kernels for the chosen unrolling.
+    Vmm vmm_wei_u8_shift = Vmm(do_compute_compensation_ ? 21 : 24);
 
     Vmm get_comp_acc(int i) { return Vmm(comp_acc_idx_ - i); }
     Vmm get_vmm_zp_comp_res(int i) { return get_comp_acc(i); }
@@ -1120,6 +1363,9 @@ inline void jit_brgemm_matmul_copy_b_int8_t<Zmm>::load(
     auto vmm_src = get_vmm(blk, i % k_blk_step_);
     auto src_load = is_tail ? vmm_src | kTail | T_z : vmm_src;
     vmovdqu8(src_load, EVEX_compress_addr(reg_src, i * src_stride_));
+    // Flipping the sign bit turns u8 values into s8 values shifted by 128,
+    // the shift is folded into the weights zero points.
+    if (is_wei_u8_) vpxord(src_load, vmm_src, vmm_wei_u8_shift);
 }
 
 template <>
@@ -1489,6 +1735,12 @@ void jit_brgemm_matmul_copy_b_int8_t<Vmm>::generate() {
         uni_vpbroadcastb(vmm_comp_mul, imm_addr64.cvt8());
     }
 
+    if (is_wei_u8_) {
+        assert(!is_ymm_);
+        mov(imm_addr64, 0x80);
+        uni_vpbroadcastb(vmm_wei_u8_shift, imm_addr64.cvt8());
+    }
+
     auto compute_K_loop = [=](bool is_N_tail) {
         const int k_unroll = 4;
         int ncolumns = is_N_tail ? conf_->N_tail : conf_->N_blk;
@@ -1666,6 +1918,20 @@ void jit_brgemm_matmul_copy_b_int8_t<Vmm>::generate() {
     postamble();
 }
 
+// The tables to expand 16 values of a 4-bit type packed in 8 bytes to dwords:
+// each byte is duplicated and its halves are moved to the top of the dwords.
+alignas(64) static constexpr int32_t int4_permute[16]
+        = {0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6, 7, 7};
+alignas(64) static constexpr int32_t int4_shift[16]
+        = {28, 24, 28, 24, 28, 24, 28, 24, 28, 24, 28, 24, 28, 24, 28, 24};
+
+// The constants to expand f8_e4m3 values through f16, see
+// jit_brgemm_matmul_copy_b_f32_t::load_f8(). The word constants are repeated
+// in both halves of a dword to be broadcast from a general purpose register.
+static constexpr uint32_t f8_e4m3_mask = 0xbfffbfff;
+static constexpr uint32_t f8_e4m3_nan = 0x7f007f00;
+static constexpr float f8_e4m3_scale = 256.f;
+
 struct jit_brgemm_matmul_copy_b_bf16_t : public jit_brgemm_matmul_copy_b_t,
                                          public jit_generator {
     DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_brgemm_matmul_copy_b_bf16_t)
@@ -1675,11 +1941,23 @@ struct jit_brgemm_matmul_copy_b_bf16_t : public jit_brgemm_matmul_copy_b_t,
         , jit_generator(jit_name())
         , typesize(conf->b_dt_sz)
         , tr_typesize(conf->tr_b_dt_sz)
+        , elems_per_byte(
+                  types::sub_byte_data_type_multiplier(conf->orig_wei_dt))
+        , is_int4_in(conf->with_wei_decompression
+                  && utils::one_of(conf->orig_wei_dt, data_type::s4,
+                          data_type::u4))
+        , is_f8_in(conf->with_wei_decompression
+                  && utils::one_of(conf->orig_wei_dt, data_type::f8_e5m2,
+                          data_type::f8_e4m3))
+        , is_int8_in(conf->with_wei_decompression
+                  && utils::one_of(
+                          conf->orig_wei_dt, data_type::s8, data_type::u8))
+        , is_f32_in(conf->is_bf32 || is_int4_in || is_f8_in || is_int8_in)
         , src_stride(conf_->wei_tag == format_tag::acbd
                           ? conf->copy_B_wei_stride
                           : conf->req_wei_vnni_downconvert
                           ? conf_->LDB * typesize
-                          : conf_->N * typesize)
+                          : conf_->N * typesize / elems_per_byte)
         , tr_src_stride(conf_->LDB * k_blk_step * tr_typesize) {}
 
     void operator()(ctx_t *ctx) override { jit_generator::operator()(ctx); }
@@ -1694,10 +1972,19 @@ private:
 
     enum { k_blk_step = 2, n_blk_step = 16 };
     const int typesize, tr_typesize;
+    const int elems_per_byte;
+    const bool is_int4_in;
+    const bool is_f8_in;
+    const bool is_int8_in;
+    // The rows are loaded as f32 values and down-converted to bf16.
+    const bool is_f32_in;
     const dim_t src_stride, tr_src_stride;
 
     opmask_t kTail = k7;
     opmask_t kFFFF = k6;
+    opmask_t kTailInt4 = k5;
+    opmask_t kFFInt4 = k4;
+    opmask_t kF8NaN = k3;
 
     reg64_t reg_src = rax;
     reg64_t reg_tr_src = rbx;
@@ -1705,21 +1992,87 @@ private:
     reg64_t reg_K_iters = r8;
     reg64_t reg_N_blk = r9;
     reg64_t reg_K_start = r10;
+    reg64_t reg_wei_decomp_scales = r11;
+    reg64_t reg_wei_decomp_zp = r12;
     reg32_t regw_tmp = r14d;
     reg64_t imm_addr64 = r15;
 
+    zmm zmm_f8_tmp = zmm26;
+    zmm zmm_f8_nan = zmm27;
+    zmm zmm_f8_mask = zmm28;
+    zmm zmm_f8_scale = zmm29;
+    zmm zmm_int4_permd = zmm28;
+    zmm zmm_int4_shift = zmm29;
     zmm zmm_permw = zmm30;
     zmm zmm_zero = zmm31;
 
+    void load_int4(const zmm &z, const Xbyak::Address &addr, bool is_tail);
+    void load_f8(const zmm &z, const Xbyak::Address &addr, opmask_t mask);
+    void load_int8(const zmm &z, const Xbyak::Address &addr, opmask_t mask);
+    void apply_wei_decomp_params(const zmm &z, int n, opmask_t mask);
     void copy_2x32_vnni(int nrows, int ncolumns);
     void generate() override;
 };
 
+void jit_brgemm_matmul_copy_b_bf16_t::load_int4(
+        const zmm &z, const Xbyak::Address &addr, bool is_tail) {
+    // See jit_brgemm_matmul_copy_b_f32_t::load_int4().
+    vpmovzxbd(z | (is_tail ? kTailInt4 : kFFInt4) | T_z, addr);
+    vpermd(z, zmm_int4_permd, z);
+    vpsllvd(z, z, zmm_int4_shift);
+    if (conf_->orig_wei_dt == data_type::s4)
+        vpsrad(z, z, 28);
+    else
+        vpsrld(z, z, 28);
+    vcvtdq2ps(z, z);
+}
+
+void jit_brgemm_matmul_copy_b_bf16_t::load_f8(
+        const zmm &z, const Xbyak::Address &addr, opmask_t mask) {
+    // See jit_brgemm_matmul_copy_b_f32_t::load_f8().
+    const Xbyak::Ymm y(z.getIdx());
+    vpmovzxbw(y | mask | T_z, addr);
+    vpsllw(y, y, 8);
+    if (conf_->orig_wei_dt == data_type::f8_e4m3) {
+        const Xbyak::Ymm y_tmp(zmm_f8_tmp.getIdx());
+        vpsraw(y, y, 1);
+        vpandd(y, y, Xbyak::Ymm(zmm_f8_mask.getIdx()));
+        vpsllw(y_tmp, y, 1);
+        vpcmpeqw(kF8NaN, y_tmp, Xbyak::Ymm(zmm_f8_nan.getIdx()));
+    }
+    vcvtph2ps(z, y);
+    if (conf_->orig_wei_dt == data_type::f8_e4m3) {
+        vmulps(z, z, zmm_f8_scale);
+        vpternlogd(z | kF8NaN, z, z, 0xff);
+    }
+}
+
+void jit_brgemm_matmul_copy_b_bf16_t::load_int8(
+        const zmm &z, const Xbyak::Address &addr, opmask_t mask) {
+    // See jit_brgemm_matmul_copy_b_f32_t::load_int8().
+    if (conf_->orig_wei_dt == data_type::s8)
+        vpmovsxbd(z | mask | T_z, addr);
+    else
+        vpmovzxbd(z | mask | T_z, addr);
+    vcvtdq2ps(z, z);
+}
+
+void jit_brgemm_matmul_copy_b_bf16_t::apply_wei_decomp_params(
+        const zmm &z, int n, opmask_t mask) {
+    // See jit_brgemm_matmul_copy_b_f32_t::apply_wei_decomp_params().
+    if (conf_->with_wei_decomp_zero_points)
+        vsubps(z | mask, z,
+                EVEX_compress_addr(reg_wei_decomp_zp, n * sizeof(float)));
+    if (conf_->with_wei_decomp_scales)
+        vmulps(z | mask, z,
+                EVEX_compress_addr(reg_wei_decomp_scales, n * sizeof(float)));
+}
+
 void jit_brgemm_matmul_copy_b_bf16_t::copy_2x32_vnni(int nrows, int ncolumns) {
 
     auto kmovx = [=](Opmask k, unsigned w) {
         mov(regw_tmp, w);
-        if (conf_->is_bf32)
+        if (is_f32_in)
             jit_generator::kmovw(k, regw_tmp);
         else
             jit_generator::kmovd(k, regw_tmp);
@@ -1728,9 +2081,18 @@ void jit_brgemm_matmul_copy_b_bf16_t::copy_2x32_vnni(int nrows, int ncolumns) {
     const int columns_tail = ncolumns % n_blk_step;
     const auto tail_mask = (1 << columns_tail) - 1;
     if (columns_tail < n_blk_step) kmovx(kTail, tail_mask);
+    if (is_int4_in) {
+        // The number of the columns is even, see init_brgemm_matmul_conf().
+        assert(columns_tail % elems_per_byte == 0);
+        kmovx(kTailInt4, (1 << (columns_tail / elems_per_byte)) - 1);
+    }
 
     const int blk_sz = k_blk_step;
-    const int max_regs_available = 30;
+    // The 4-bit and f8_e4m3 weights use more registers for the
+    // decompression.
+    const int max_regs_available = is_int4_in
+            ? 28
+            : conf_->orig_wei_dt == data_type::f8_e4m3 ? 26 : 30;
     const int max_unroll = max_regs_available / blk_sz;
     auto get_zmm = [=](int blk, int idx) {
         assert(idx >= 0 && idx < blk_sz && blk >= 0);
@@ -1742,9 +2104,18 @@ void jit_brgemm_matmul_copy_b_bf16_t::copy_2x32_vnni(int nrows, int ncolumns) {
     auto load = [=](int blk, int k, int n, opmask_t current_mask) {
         auto src_reg = get_zmm(blk, k % k_blk_step);
         auto src_load = src_reg | current_mask | T_z;
-        auto load_addr
-                = EVEX_compress_addr(reg_src, k * src_stride + n * typesize);
-        if (conf_->is_bf32) {
+        auto load_addr = EVEX_compress_addr(
+                reg_src, k * src_stride + n * typesize / elems_per_byte);
+        if (is_int4_in) {
+            load_int4(src_reg, load_addr, current_mask == kTail);
+            apply_wei_decomp_params(src_reg, n, current_mask);
+        } else if (is_f8_in) {
+            load_f8(src_reg, load_addr, current_mask);
+            apply_wei_decomp_params(src_reg, n, current_mask);
+        } else if (is_int8_in) {
+            load_int8(src_reg, load_addr, current_mask);
+            apply_wei_decomp_params(src_reg, n, current_mask);
+        } else if (conf_->is_bf32) {
             vmovups(src_load, load_addr);
         } else {
             vmovdqu16(src_load, load_addr);
@@ -1771,13 +2142,13 @@ void jit_brgemm_matmul_copy_b_bf16_t::copy_2x32_vnni(int nrows, int ncolumns) {
         if (nrows - k >= k_blk_step) {
             load(blk_idx, k + 1, n, curr_msk);
             const auto src_zmm1 = get_zmm(blk_idx, 1);
-            if (conf_->is_bf32) {
+            if (is_f32_in) {
                 vcvtne2ps2bf16(src_zmm0, src_zmm1, src_zmm0);
             } else {
                 const auto src_ymm1 = ymm(src_zmm1.getIdx());
                 vinsertf64x4(src_zmm0, src_zmm0, src_ymm1, 1);
             }
-        } else if (conf_->is_bf32) {
+        } else if (is_f32_in) {
             vcvtneps2bf16(ymm(src_zmm0.getIdx()), src_zmm0);
         }
 
@@ -1809,6 +2180,26 @@ void jit_brgemm_matmul_copy_b_bf16_t::generate() {
     };
 
     vmovdqa64(zmm_permw, (const int64_t *)bf16_vnni_permute);
+    if (is_int4_in) {
+        mov(regw_tmp, 0xff);
+        kmovw(kFFInt4, regw_tmp);
+        vmovdqa64(zmm_int4_permd, (const int64_t *)int4_permute);
+        vmovdqa64(zmm_int4_shift, (const int64_t *)int4_shift);
+    }
+    if (conf_->orig_wei_dt == data_type::f8_e4m3) {
+        mov(regw_tmp, f8_e4m3_mask);
+        vpbroadcastd(zmm_f8_mask, regw_tmp);
+        mov(regw_tmp, f8_e4m3_nan);
+        vpbroadcastd(zmm_f8_nan, regw_tmp);
+        mov(regw_tmp, float2int(f8_e4m3_scale));
+        vpbroadcastd(zmm_f8_scale, regw_tmp);
+    }
+    if (conf_->with_wei_decomp_scales)
+        mov(reg_wei_decomp_scales,
+                ptr[param1 + GET_OFF(wei_decomp_scales_ptr)]);
+    if (conf_->with_wei_decomp_zero_points)
+        mov(reg_wei_decomp_zp,
+                ptr[param1 + GET_OFF(wei_decomp_zero_points_ptr)]);
 
     auto compute_K_loop = [=](bool is_N_tail) {
         const int k_unroll = 8;
@@ -1876,11 +2267,22 @@ struct jit_brgemm_matmul_copy_b_f32_t : public jit_brgemm_matmul_copy_b_t,
     jit_brgemm_matmul_copy_b_f32_t(const brgemm_matmul_conf_t *conf)
         : jit_brgemm_matmul_copy_b_t(conf)
         , jit_generator(jit_name())
-        , dt_in_(conf->isa == avx512_core_fp16 ? data_type::f16
-                                               : data_type::f32)
+        , dt_in_(conf->with_wei_decompression
+                          ? conf->orig_wei_dt
+                          : conf->isa == avx512_core_fp16 ? data_type::f16
+                                                          : data_type::f32)
         , typesize_in_(types::data_type_size(dt_in_))
-        , src_stride_(conf_->wei_tag == acbd ? conf_->copy_B_wei_stride
-                                             : conf_->N * typesize_in_)
+        , elems_per_byte_in_(types::sub_byte_data_type_multiplier(dt_in_))
+        , is_int4_in_(utils::one_of(dt_in_, data_type::s4, data_type::u4))
+        , is_f8_in_(utils::one_of(
+                  dt_in_, data_type::f8_e5m2, data_type::f8_e4m3))
+        , is_int8_in_(utils::one_of(dt_in_, data_type::s8, data_type::u8))
+        , max_regs_available_(is_int4_in_
+                          ? 28
+                          : dt_in_ == data_type::f8_e4m3 ? 26 : 30)
+        , src_stride_(conf_->wei_tag == acbd
+                          ? conf_->copy_B_wei_stride
+                          : conf_->N * typesize_in_ / elems_per_byte_in_)
         , tr_src_stride_(conf_->LDB * typesize_out_) {}
 
     void operator()(ctx_t *ctx) override { jit_generator::operator()(ctx); }
@@ -1892,14 +2294,24 @@ private:
     using opmask_t = const Xbyak::Opmask;
     using zmm = const Xbyak::Zmm;
 
-    enum { n_blk_step = 16, max_regs_available = 30 };
+    enum { n_blk_step = 16 };
     const data_type_t dt_in_;
     const size_t typesize_in_;
+    const int elems_per_byte_in_;
+    const bool is_int4_in_;
+    const bool is_f8_in_;
+    const bool is_int8_in_;
+    // The 4-bit and f8_e4m3 weights use more registers for the
+    // decompression.
+    const int max_regs_available_;
     const size_t typesize_out_ = sizeof(float);
     dim_t src_stride_, tr_src_stride_;
 
     opmask_t kTail = k7;
     opmask_t kFFFF = k6;
+    opmask_t kTailInt4 = k5;
+    opmask_t kFFInt4 = k4;
+    opmask_t kF8NaN = k3;
 
     reg64_t reg_src = rax;
     reg64_t reg_tr_src = rbx;
@@ -1907,9 +2319,17 @@ private:
     reg64_t reg_K_iters = r8;
     reg64_t reg_N_blk = r9;
     reg64_t reg_K_start = r10;
+    reg64_t reg_wei_decomp_scales = r11;
+    reg64_t reg_wei_decomp_zp = r12;
     reg32_t regw_tmp = r14d;
     reg64_t imm_addr64 = r15;
 
+    zmm zmm_f8_tmp = zmm26;
+    zmm zmm_f8_nan = zmm27;
+    zmm zmm_f8_mask = zmm28;
+    zmm zmm_f8_scale = zmm29;
+    zmm zmm_int4_permd = zmm28;
+    zmm zmm_int4_shift = zmm29;
     zmm zmm_permw = zmm30;
     zmm zmm_zero = zmm31;
 
@@ -1917,33 +2337,117 @@ private:
         mov(regw_tmp, w);
         jit_generator::kmovd(k, regw_tmp);
     }
+    void load_int4(const zmm &z, const Xbyak::Address &addr, bool is_tail);
+    void load_f8(const zmm &z, const Xbyak::Address &addr, opmask_t mask);
+    void load_int8(const zmm &z, const Xbyak::Address &addr, opmask_t mask);
+    void apply_wei_decomp_params(const zmm &z, int n, opmask_t mask);
     void copy_16_x_n_block(int nrows, int ncolumns);
     void compute_k_loop(int ncolumns);
     void generate() override;
 };
 
+void jit_brgemm_matmul_copy_b_f32_t::load_int4(
+        const zmm &z, const Xbyak::Address &addr, bool is_tail) {
+    // The byte j holds the values 2j (lower half) and 2j + 1 (upper half).
+    // The bytes are spread over the dwords, duplicated, and then the
+    // corresponding half is shifted to the top of a dword and back with the
+    // sign or zero extension.
+    vpmovzxbd(z | (is_tail ? kTailInt4 : kFFInt4) | T_z, addr);
+    vpermd(z, zmm_int4_permd, z);
+    vpsllvd(z, z, zmm_int4_shift);
+    if (dt_in_ == data_type::s4)
+        vpsrad(z, z, 28);
+    else
+        vpsrld(z, z, 28);
+    vcvtdq2ps(z, z);
+}
+
+void jit_brgemm_matmul_copy_b_f32_t::load_f8(
+        const zmm &z, const Xbyak::Address &addr, opmask_t mask) {
+    // The bytes are zero extended to words and moved to their top, which for
+    // f8_e5m2 gives f16 values directly. For f8_e4m3 the exponent and the
+    // mantissa are moved one bit lower with an arithmetic shift, and the
+    // copy of the sign in the top bit of the f16 exponent is cleared. The
+    // f16 value is 2^-8 of the f8_e4m3 one, subnormals included, and is
+    // scaled back after the conversion. The NaN encodings of f8_e4m3 turn
+    // into +-1.875 this way, they are detected in advance and restored.
+    const Xbyak::Ymm y(z.getIdx());
+    vpmovzxbw(y | mask | T_z, addr);
+    vpsllw(y, y, 8);
+    if (dt_in_ == data_type::f8_e4m3) {
+        const Xbyak::Ymm y_tmp(zmm_f8_tmp.getIdx());
+        vpsraw(y, y, 1);
+        vpandd(y, y, Xbyak::Ymm(zmm_f8_mask.getIdx()));
+        vpsllw(y_tmp, y, 1);
+        vpcmpeqw(kF8NaN, y_tmp, Xbyak::Ymm(zmm_f8_nan.getIdx()));
+    }
+    vcvtph2ps(z, y);
+    if (dt_in_ == data_type::f8_e4m3) {
+        vmulps(z, z, zmm_f8_scale);
+        vpternlogd(z | kF8NaN, z, z, 0xff);
+    }
+}
+
+void jit_brgemm_matmul_copy_b_f32_t::load_int8(
+        const zmm &z, const Xbyak::Address &addr, opmask_t mask) {
+    // The bytes are sign or zero extended to dwords, the int8 values are
+    // exact in f32.
+    if (dt_in_ == data_type::s8)
+        vpmovsxbd(z | mask | T_z, addr);
+    else
+        vpmovzxbd(z | mask | T_z, addr);
+    vcvtdq2ps(z, z);
+}
+
+void jit_brgemm_matmul_copy_b_f32_t::apply_wei_decomp_params(
+        const zmm &z, int n, opmask_t mask) {
+    // The parameters are expanded to f32 values per column, the masked lanes
+    // of the tail are not loaded and stay zero.
+    if (conf_->with_wei_decomp_zero_points)
+        vsubps(z | mask, z,
+                EVEX_compress_addr(reg_wei_decomp_zp, n * sizeof(float)));
+    if (conf_->with_wei_decomp_scales)
+        vmulps(z | mask, z,
+                EVEX_compress_addr(reg_wei_decomp_scales, n * sizeof(float)));
+}
+
 void jit_brgemm_matmul_copy_b_f32_t::copy_16_x_n_block(
         int nrows, int ncolumns) {
 
     auto get_zmm = [=](int reg_idx) {
-        assert(reg_idx >= 0 && reg_idx < max_regs_available);
+        assert(reg_idx >= 0 && reg_idx < max_regs_available_);
         return zmm(reg_idx);
     };
 
     auto load = [=](int blk, int k, int n, opmask_t current_mask) {
         auto src_zmm = get_zmm(blk);
         auto src_zmm_m = src_zmm | current_mask | T_z;
-        auto addr = EVEX_compress_addr(
-                reg_src, k * src_stride_ + n * typesize_in_);
-        if (dt_in_ == data_type::f16)
+        auto addr = EVEX_compress_addr(reg_src,
+                k * src_stride_ + n * typesize_in_ / elems_per_byte_in_);
+        if (is_int4_in_) {
+            load_int4(src_zmm, addr, current_mask == kTail);
+            apply_wei_decomp_params(src_zmm, n, current_mask);
+        } else if (is_f8_in_) {
+            load_f8(src_zmm, addr, current_mask);
+            apply_wei_decomp_params(src_zmm, n, current_mask);
+        } else if (is_int8_in_) {
+            load_int8(src_zmm, addr, current_mask);
+            apply_wei_decomp_params(src_zmm, n, current_mask);
+        } else if (dt_in_ == data_type::f16) {
             vcvtph2psx(src_zmm_m, addr);
-        else
+        } else {
             vmovups(src_zmm_m, addr);
+        }
     };
 
     const int columns_tail = ncolumns % n_blk_step;
     const auto tail_mask = (1 << columns_tail) - 1;
     if (columns_tail < n_blk_step) kmovw(kTail, tail_mask);
+    if (is_int4_in_) {
+        // The number of the columns is even, see init_brgemm_matmul_conf().
+        assert(columns_tail % elems_per_byte_in_ == 0);
+        kmovw(kTailInt4, (1 << (columns_tail / elems_per_byte_in_)) - 1);
+    }
 
     int iter = 0;
     for_(int k = 0; k < nrows; k++)
@@ -1958,7 +2462,7 @@ void jit_brgemm_matmul_copy_b_f32_t::copy_16_x_n_block(
         }
 
         const opmask_t curr_msk = zero_padding < n_blk_step ? kTail : kFFFF;
-        const int blk_idx = iter % max_regs_available;
+        const int blk_idx = iter % max_regs_available_;
         load(blk_idx, k, n, curr_msk);
 
         const auto src_zmm0 = get_zmm(blk_idx);
@@ -2001,6 +2505,28 @@ void jit_brgemm_matmul_copy_b_f32_t::generate() {
     mov(reg_N_blk, ptr[param1 + GET_OFF(current_N_blk)]);
     kmovw(kFFFF, 0xffff); // 1111111111111111
 
+    if (is_int4_in_) {
+        kmovw(kFFInt4, 0xff);
+        mov(imm_addr64, reinterpret_cast<size_t>(int4_permute));
+        vmovups(zmm_int4_permd, ptr[imm_addr64]);
+        mov(imm_addr64, reinterpret_cast<size_t>(int4_shift));
+        vmovups(zmm_int4_shift, ptr[imm_addr64]);
+    }
+    if (dt_in_ == data_type::f8_e4m3) {
+        mov(regw_tmp, f8_e4m3_mask);
+        vpbroadcastd(zmm_f8_mask, regw_tmp);
+        mov(regw_tmp, f8_e4m3_nan);
+        vpbroadcastd(zmm_f8_nan, regw_tmp);
+        mov(regw_tmp, float2int(f8_e4m3_scale));
+        vpbroadcastd(zmm_f8_scale, regw_tmp);
+    }
+    if (conf_->with_wei_decomp_scales)
+        mov(reg_wei_decomp_scales,
+                ptr[param1 + GET_OFF(wei_decomp_scales_ptr)]);
+    if (conf_->with_wei_decomp_zero_points)
+        mov(reg_wei_decomp_zp,
+                ptr[param1 + GET_OFF(wei_decomp_zero_points_ptr)]);
+
     Label done;
     if (conf_->N_tail > 0) {
         Label not_N_tail;
@@ -2677,6 +3203,9 @@ status_t create_brgemm_matmul_copy_a(
     if (conf->transposed_A) {
         CHECK(safe_ptr_assign(copy_ker,
                 new jit_brgemm_matmul_copy_a_transposed_impl_t(conf)));
+    } else if (conf->with_src_dyn_quant) {
+        CHECK(safe_ptr_assign(
+                copy_ker, new jit_brgemm_matmul_copy_a_dyn_quant_t(conf)));
     } else {
         if (is_superset(conf->isa, avx512_core))
             CHECK(safe_ptr_assign(
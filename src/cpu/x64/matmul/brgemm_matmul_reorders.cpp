@@ -79,7 +79,10 @@ status_t brgemm_matmul_matrix_B_reorder_t::pd_t::init(
 
     if (utils::one_of(format_tag::undef, itag, otag)) return invalid_arguments;
 
-    // initialize all required fields to generate copy_b kernel
+    // initialize all required fields to generate copy_b kernel, the rest of
+    // them (e.g. zero blocks skipping) stay disabled
+    matmul_conf_for_reorder_
+            = utils::zero<decltype(matmul_conf_for_reorder_)>();
     matmul_conf_for_reorder_.wei_tag = itag;
     matmul_conf_for_reorder_.batch = ndims > 2 ? dims[ndims - 3] : 1;
     matmul_conf_for_reorder_.K = dims[ndims - 2];
@@ -173,7 +173,11 @@ status_t brgemm_matmul_conf_utils_t::set_or_check_B_tag(
         const int default_n_block = init_n_tag
                 ? get_default_n_block(format_tag::undef)
                 : bgmmc.N_blk;
+        // The decompressed and the u8 weights are supported in the plain
+        // layout only.
         bgmmc.wei_tag = blocked_B_layouts_allowed
+                        && !bgmmc.with_wei_decompression
+                        && bgmmc.orig_wei_dt != u8
                 ? this->pick_blocked_B_layout(default_n_block)
                 : plain_tensor_layout_tag;
         if (format_tag::undef == bgmmc.wei_tag) return status::unimplemented;
@@ -320,6 +324,53 @@ brgemm_broadcast_t get_zp_type(const primitive_attr_t &attr, int arg) {
             : brgemm_broadcast_t::per_tensor;
 }
 
+// Checks the weights scales and zero points applied on the decompression of
+// the weights and fills their parameters. Groups go along K, the N dimension
+// is either broadcast or has a dedicated value per column.
+status_t init_wei_decomp_params(
+        brgemm_matmul_conf_t &bgmmc, const primitive_attr_t &attr) {
+    const int k_mask = 1 << (bgmmc.ndims - 2);
+    const int n_mask = 1 << (bgmmc.ndims - 1);
+
+    auto init_params = [&](int mask, int ndims, const dim_t *groups,
+                               dim_t &group_k, bool &per_n) -> bool {
+        if ((mask & ~(k_mask | n_mask)) != 0 || !one_of(ndims, 0, 2))
+            return false;
+        per_n = mask & n_mask;
+        if (ndims == 2 && per_n && groups[1] != 1) return false;
+        group_k = (mask & k_mask) ? (ndims == 2 ? groups[0] : 1) : bgmmc.K;
+        // The rows of a VNNI pair of bf16 weights must share the parameters.
+        const bool group_k_ok = bgmmc.wei_dt != bf16 || group_k % 2 == 0;
+        return bgmmc.K % group_k == 0 && group_k_ok;
+    };
+
+    bgmmc.wei_decomp_group_k = bgmmc.K;
+    if (bgmmc.with_wei_decomp_scales) {
+        const auto &wei_scales = attr.scales_.get(DNNL_ARG_WEIGHTS);
+        bgmmc.wei_decomp_scales_dt = wei_scales.data_type_;
+        if (!init_params(wei_scales.mask_, wei_scales.ndims_,
+                    wei_scales.group_dims_, bgmmc.wei_decomp_scales_group_k,
+                    bgmmc.wei_decomp_scales_per_n))
+            return status::unimplemented;
+        bgmmc.wei_decomp_group_k = math::gcd((int)bgmmc.wei_decomp_group_k,
+                (int)bgmmc.wei_decomp_scales_group_k);
+    }
+    if (bgmmc.with_wei_decomp_zero_points) {
+        const auto &zp = attr.zero_points_;
+        int mask = 0;
+        CHECK(zp.get(DNNL_ARG_WEIGHTS, &mask));
+        bgmmc.wei_decomp_zero_points_dt = zp.get_data_type(DNNL_ARG_WEIGHTS);
+        if (!init_params(mask, zp.get_groups_ndims(DNNL_ARG_WEIGHTS),
+                    zp.get_groups(DNNL_ARG_WEIGHTS),
+                    bgmmc.wei_decomp_zero_points_group_k,
+                    bgmmc.wei_decomp_zero_points_per_n))
+            return status::unimplemented;
+        bgmmc.wei_decomp_group_k = math::gcd((int)bgmmc.wei_decomp_group_k,
+                (int)bgmmc.wei_decomp_zero_points_group_k);
+    }
+    return status::success;
+}
+
 struct matmul_amx_blocking_params_t : public brgemm_matmul_conf_t {
     matmul_amx_blocking_params_t()
         : nthr_k_(0)
@@ -886,6 +937,54 @@ status_t init_brgemm_matmul_conf(cpu_isa_t isa, brgemm_matmul_conf_t &bgmmc,
     bgmmc.src_dt = src_d.data_type();
     bgmmc.dst_dt = dst_d.data_type();
     bgmmc.wei_dt = weights_d.data_type();
+    bgmmc.orig_wei_dt = weights_d.data_type();
+    bgmmc.orig_src_dt = src_d.data_type();
+
+    // The 4-bit and 8-bit floating-point weights are expanded to the source
+    // data type on copying to the buffer, so the rest of the configuration
+    // treats them as such. The same holds for the int8 weights with a
+    // floating-point source unless the source is quantized dynamically. The
+    // copy routines use Intel AVX-512 registers.
+    const bool is_src_fp = one_of(bgmmc.src_dt, f32, bf16, f16);
+    bgmmc.with_wei_decompression
+            = one_of(bgmmc.orig_wei_dt, s4, u4, f8_e5m2, f8_e4m3)
+            || (one_of(bgmmc.orig_wei_dt, s8, u8) && is_src_fp
+                    && attr.src_dyn_quant_params_.data_type_ != s8);
+    if (bgmmc.with_wei_decompression) {
+        if (!is_src_fp || !is_superset(isa, avx512_core)
+                || is_superset(isa, avx512_core_amx))
+            return status::unimplemented;
+        // The f16 source is supported through the up-conversion to f32.
+        if (bgmmc.src_dt == f16 && isa != avx512_core_fp16)
+            return status::unimplemented;
+        bgmmc.wei_dt = bgmmc.src_dt;
+    }
+
+    // The u8 weights are turned into s8 ones on copying to the buffer, the
+    // difference is accounted for by the per-column weights zero points.
+    if (bgmmc.orig_wei_dt == u8 && !bgmmc.with_wei_decompression) {
+        if (!one_of(bgmmc.src_dt, u8, s8) || !is_superset(isa, avx512_core)
+                || is_superset(isa, avx512_core_amx))
+            return status::unimplemented;
+        bgmmc.wei_dt = s8;
+    }
+
+    // The dynamically quantized source takes the int8 path of the kernels.
+    // The copy routine uses Intel AVX-512 registers, the AMX kernels don't
+    // support the row scales.
+    bgmmc.with_src_dyn_quant
+            = attr.src_dyn_quant_params_.data_type_ == data_type::s8;
+    if (bgmmc.with_src_dyn_quant) {
+        if (!one_of(bgmmc.src_dt, f32, bf16) || bgmmc.wei_dt != s8
+                || !one_of(bgmmc.dst_dt, f32, bf16)
+                || isa != avx512_core_vnni)
+            return status::unimplemented;
+        const auto &src_scales = attr.scales_.get(DNNL_ARG_SRC);
+        if (!src_scales.has_default_values()
+                || !attr.zero_points_.has_default_values())
+            return status::unimplemented;
+        bgmmc.src_dt = s8;
+    }
 
     bgmmc.with_bias = mmd.bias_desc.format_kind != format_kind::undef;
     bgmmc.bia_dt = bgmmc.with_bias ? mmd.bias_desc.data_type : data_type::undef;
@@ -902,8 +1001,10 @@ status_t init_brgemm_matmul_conf(cpu_isa_t isa, brgemm_matmul_conf_t &bgmmc,
     CHECK(check_isa_with_datatype(isa, bm_conf_utils));
 
     bgmmc.is_amx = is_superset(isa, avx512_core_amx);
-    bgmmc.a_dt_sz = bgmmc.tr_a_dt_sz = types::data_type_size(bgmmc.src_dt);
-    bgmmc.b_dt_sz = bgmmc.tr_b_dt_sz = types::data_type_size(bgmmc.wei_dt);
+    bgmmc.a_dt_sz = types::data_type_size(bgmmc.orig_src_dt);
+    bgmmc.tr_a_dt_sz = types::data_type_size(bgmmc.src_dt);
+    bgmmc.b_dt_sz = types::data_type_size(bgmmc.orig_wei_dt);
+    bgmmc.tr_b_dt_sz = types::data_type_size(bgmmc.wei_dt);
 
     bgmmc.is_bf32 = bm_conf_utils.is_bf32();
 
@@ -930,13 +1031,25 @@ status_t init_brgemm_matmul_conf(cpu_isa_t isa, brgemm_matmul_conf_t &bgmmc,
 
     const auto &src_scales = attr.scales_.get(DNNL_ARG_SRC);
     const auto &wei_scales = attr.scales_.get(DNNL_ARG_WEIGHTS);
-    bgmmc.with_scales = !src_scales.has_default_values()
-            || !wei_scales.has_default_values();
+    // The weights scales that vary along K or come in a data type other than
+    // f32 are applied on decompression, the rest is applied to the result.
+    bgmmc.with_wei_decomp_scales = bgmmc.with_wei_decompression
+            && !wei_scales.has_default_values()
+            && (!wei_scales.has_default_groups()
+                    || !wei_scales.has_default_data_type()
+                    || (wei_scales.mask_ & (1 << (bgmmc.ndims - 2))));
+    bgmmc.with_wei_decomp_zero_points = bgmmc.with_wei_decompression
+            && !attr.zero_points_.has_default_values(DNNL_ARG_WEIGHTS);
+    const bool with_wei_oscales = !wei_scales.has_default_values()
+            && !bgmmc.with_wei_decomp_scales;
+    bgmmc.with_scales = !src_scales.has_default_values() || with_wei_oscales;
     if (bgmmc.with_scales) {
-        bgmmc.is_oscale_per_n = wei_scales.mask_ == 1 << (bgmmc.ndims - 1);
+        bgmmc.is_oscale_per_n = with_wei_oscales
+                && wei_scales.mask_ == 1 << (bgmmc.ndims - 1);
 
         // only common and per-oc-channel scales are supported
-        const bool oscales_ok = wei_scales.mask_ == 0 || bgmmc.is_oscale_per_n;
+        const bool oscales_ok = !with_wei_oscales || wei_scales.mask_ == 0
+                || bgmmc.is_oscale_per_n;
         if (!oscales_ok) return status::unimplemented;
     }
 
@@ -946,6 +1059,11 @@ status_t init_brgemm_matmul_conf(cpu_isa_t isa, brgemm_matmul_conf_t &bgmmc,
     if (bgmmc.with_dst_scales && dst_scales.mask_ != 0)
         return status::unimplemented;
 
+    // The running maximum and minimum are updated with masked instructions.
+    bgmmc.with_dst_amax = !attr.dst_amax_params_.has_default_values();
+    if (bgmmc.with_dst_amax && !is_superset(isa, avx512_core))
+        return status::unimplemented;
+
     const auto &p = attr.post_ops_;
     bgmmc.with_sum = p.find(primitive_kind::sum) != -1;
     const int eltwise_ind = p.find(primitive_kind::eltwise);
@@ -956,8 +1074,20 @@ status_t init_brgemm_matmul_conf(cpu_isa_t isa, brgemm_matmul_conf_t &bgmmc,
     if (!post_ops_ok(bgmmc, attr, dst_d)) return status::unimplemented;
 
     bgmmc.src_zp_type = get_zp_type(attr, DNNL_ARG_SRC);
-    bgmmc.wei_zp_type = get_zp_type(attr, DNNL_ARG_WEIGHTS);
+    bgmmc.wei_zp_type = bgmmc.with_wei_decomp_zero_points
+            ? brgemm_broadcast_t::none
+            : get_zp_type(attr, DNNL_ARG_WEIGHTS);
     bgmmc.dst_zp_type = get_zp_type(attr, DNNL_ARG_DST);
+    // The weights zero points that vary along N are applied per column to the
+    // compensation of the source rows, only the Intel AVX-512 kernels without
+    // AMX support them.
+    if ((bgmmc.orig_wei_dt == u8 && !bgmmc.with_wei_decompression)
+            || (bgmmc.wei_zp_type != brgemm_broadcast_t::none
+                    && !attr.zero_points_.common(DNNL_ARG_WEIGHTS))) {
+        if (!is_superset(isa, avx512_core) || bgmmc.is_amx)
+            return status::unimplemented;
+        bgmmc.wei_zp_type = brgemm_broadcast_t::per_n;
+    }
 
     if (!IMPLICATION(!bm_conf_utils.is_int8(),
                 everyone_is(brgemm_broadcast_t::none, bgmmc.src_zp_type,
@@ -967,7 +1097,9 @@ status_t init_brgemm_matmul_conf(cpu_isa_t isa, brgemm_matmul_conf_t &bgmmc,
     matmul_helper_t helper(src_d, weights_d, dst_d);
 
     bgmmc.batch_ndims = bgmmc.ndims - 2;
-    bgmmc.M = helper.M();
+    // The blocking for runtime M is chosen for a nominal value of M.
+    bgmmc.is_runtime_M = is_runtime_value(helper.M());
+    bgmmc.M = bgmmc.is_runtime_M ? runtime_M_nominal : helper.M();
     bgmmc.N = helper.N();
     bgmmc.K = helper.K();
     bgmmc.batch = helper.batch();
@@ -995,6 +1127,25 @@ status_t init_brgemm_matmul_conf(cpu_isa_t isa, brgemm_matmul_conf_t &bgmmc,
     CHECK(bm_conf_utils.set_or_check_tags(src_md, dst_md, bias_md));
     CHECK(bm_conf_utils.set_or_check_B_tag(weights_md));
 
+    CHECK(init_wei_decomp_params(bgmmc, attr));
+
+    if (bgmmc.with_wei_decompression) {
+        // The copy routine expects a row of the packed weights to start at a
+        // byte boundary.
+        const int wei_elems_per_byte
+                = types::sub_byte_data_type_multiplier(bgmmc.orig_wei_dt);
+        if (!bm_conf_utils.check_is_plain(bgmmc.wei_tag)
+                || bgmmc.N % wei_elems_per_byte != 0)
+            return status::unimplemented;
+    }
+
+    // With runtime M only the batch strides of the plain layouts are unknown
+    // at creation, and they are easy to restore at execution.
+    if (bgmmc.is_runtime_M
+            && !(bm_conf_utils.check_is_plain(bgmmc.src_tag)
+                    && bm_conf_utils.check_is_plain(bgmmc.dst_tag)))
+        return status::unimplemented;
+
     bgmmc.req_wei_vnni_downconvert = bm_conf_utils.wei_down_convert_to_vnni();
 
     CHECK(attr.set_default_formats(&dst_md));
@@ -1004,6 +1155,12 @@ status_t init_brgemm_matmul_conf(cpu_isa_t isa, brgemm_matmul_conf_t &bgmmc,
     bgmmc.blocked_B = bm_conf_utils.get_blocked_B();
     bgmmc.use_buffer_b = bm_conf_utils.use_buffer_b();
 
+    // The sign of the u8 weights is flipped by the plain copy routine.
+    if (bgmmc.orig_wei_dt == u8 && !bgmmc.with_wei_decompression
+            && !(bm_conf_utils.check_is_plain(bgmmc.wei_tag)
+                    && bgmmc.use_buffer_b))
+        return status::unimplemented;
+
     bgmmc.transposed_A = (bm_conf_utils.check_is_transposed(bgmmc.src_tag)
             || bgmmc.src_tag == adbc);
     const bool lda_is_big_2pow
@@ -1017,9 +1174,15 @@ status_t init_brgemm_matmul_conf(cpu_isa_t isa, brgemm_matmul_conf_t &bgmmc,
                               || bm_conf_utils.is_bf32()))
             || (bm_conf_utils.is_f16() && isa == avx512_core_fp16)
             || bgmmc.wei_zp_type != brgemm_broadcast_t::none
-            || bgmmc.transposed_A || lda_is_big_2pow;
+            || bgmmc.with_src_dyn_quant || bgmmc.transposed_A
+            || lda_is_big_2pow;
     bgmmc.use_buffer_a = is_copy_a_required;
 
+    // The source is quantized row by row from a plain layout.
+    if (bgmmc.with_src_dyn_quant
+            && !bm_conf_utils.check_is_plain(bgmmc.src_tag))
+        return status::unimplemented;
+
     // Supported computation with copy only part of A related to K_tail if
     // is_copy_a_required == true, but the current performance measurements
     // show worse performance for it in comparison with copy whole A approach
@@ -1062,6 +1225,39 @@ status_t init_brgemm_matmul_conf(cpu_isa_t isa, brgemm_matmul_conf_t &bgmmc,
 
     CHECK(bm_conf_utils.set_B_flags(weights_md));
 
+    // The row scales are computed from the whole row by the thread that
+    // copies the first chunk of K.
+    if (bgmmc.with_src_dyn_quant && bgmmc.nthr_k > 1)
+        return status::unimplemented;
+
+    // The copy routine is called separately for every page along K, which is
+    // incompatible with the compensations it accumulates over a block of K.
+    // Along N a block of columns must lie within a page.
+    bgmmc.wei_page_size = attr.weights_paging_params_.page_size_;
+    bgmmc.is_wei_paged_along_k = false;
+    if (bgmmc.wei_page_size > 0) {
+        if (!bgmmc.use_buffer_b || !weights_d.is_plain()
+                || one_of(bgmmc.orig_wei_dt, s4, u4))
+            return status::unimplemented;
+        bgmmc.is_wei_paged_along_k
+                = cpu::matmul::is_wei_paged_along_k(weights_d);
+        const dim_t vnni_granularity
+                = data_type_vnni_granularity(bgmmc.wei_dt);
+        const bool ok = bgmmc.is_wei_paged_along_k
+                ? bgmmc.wei_page_size % vnni_granularity == 0
+                        && !bgmmc.s8s8_compensation_required
+                        && bgmmc.src_zp_type == brgemm_broadcast_t::none
+                : bgmmc.wei_page_size % bgmmc.N_blk == 0;
+        if (!ok) return status::unimplemented;
+    }
+
+    if (bgmmc.is_runtime_M) {
+        // The reduction buffers for parallel K are sized by M.
+        if (bgmmc.nthr_k > 1) return status::unimplemented;
+        // The tails are not known in advance, their kernels are generated
+        // at execution.
+        bgmmc.M = rnd_up(bgmmc.M, bgmmc.M_blk);
+    }
     bgmmc.M_tail = bgmmc.M % bgmmc.M_blk;
     bgmmc.N_tail = bgmmc.N % bgmmc.N_blk;
     bgmmc.K_tail = bgmmc.K > bgmmc.K_blk
@@ -1074,6 +1270,13 @@ status_t init_brgemm_matmul_conf(cpu_isa_t isa, brgemm_matmul_conf_t &bgmmc,
     bgmmc.LDC
             = bgmmc.use_buffer_c && bgmmc.nthr_k <= 1 ? bgmmc.N_blk : bgmmc.LDD;
 
+    // Pruned weights have whole blocks of zeros, skipping them saves the
+    // compute. The check is done on the copied blocks of B, so it doesn't
+    // require any special weights format. The AMX unrolled kernels don't
+    // support empty batches.
+    bgmmc.skip_zero_b_blocks = bgmmc.use_buffer_b && !bgmmc.is_amx
+            && bgmmc.brg_type == brgemm_addr;
+
     init_aux_values(bgmmc, src_d, weights_d, dst_d);
 
     return status::success;
@@ -1167,7 +1370,8 @@ void init_aux_values(brgemm_matmul_conf_t &bgmmc,
             bgmmc.with_scales, bgmmc.with_eltwise, bgmmc.with_binary,
             bgmmc.acc_dt != bgmmc.dst_dt, bgmmc.s8s8_compensation_required,
             bgmmc.has_zero_point_a, bgmmc.has_zero_point_b,
-            bgmmc.has_zero_point_c, bgmmc.with_dst_scales);
+            bgmmc.has_zero_point_c, bgmmc.with_dst_scales,
+            bgmmc.with_src_dyn_quant, bgmmc.with_dst_amax);
 
     bgmmc.zp_a_comp_shift_n = bgmmc.wei_n_blk;
     bgmmc.zp_a_comp_elems_per_thr
@@ -1181,6 +1385,10 @@ void init_aux_values(brgemm_matmul_conf_t &bgmmc,
     bgmmc.zp_b_comp_elems_per_thr = bgmmc.M_chunk_size
             * (bgmmc.zp_b_comp_result_shift_m + bgmmc.zp_b_comp_buffer_shift_m);
 
+    bgmmc.src_dyn_quant_scales_elems_per_thr = bgmmc.with_src_dyn_quant
+            ? bgmmc.M_chunk_size * bgmmc.M_blk
+            : 0;
+
     bgmmc.brgemm_batch_element_per_thr_sz = 16 * bgmmc.brgemm_batch_size;
 }
 
@@ -1201,12 +1409,36 @@ void init_scratchpad(memory_tracking::registrar_t &scratchpad,
         scratchpad.book(key_brgemm_primitive_buffer_b,
                 bgmmc.nthr * bgmmc.buffer_b_per_thread_sz, default_data_align);
 
+        if (bgmmc.skip_zero_b_blocks)
+            scratchpad.book(key_brgemm_primitive_buffer_b_mask,
+                    static_cast<size_t>(bgmmc.nthr) * bgmmc.brgemm_batch_size,
+                    default_data_align);
+
         if (bgmmc.s8s8_compensation_required && (!bgmmc.blocked_B))
             scratchpad.book(key_brgemm_primitive_buffer_comp,
                     bgmmc.nthr * bgmmc.s8s8_comp_ithr_str,
                     types::data_type_size(f32));
+
+        const size_t wei_decomp_params_sz
+                = bgmmc.K / bgmmc.wei_decomp_group_k * bgmmc.N;
+        if (bgmmc.with_wei_decomp_scales)
+            scratchpad.book(key_brgemm_primitive_wei_decomp_scales,
+                    wei_decomp_params_sz, types::data_type_size(f32));
+        if (bgmmc.with_wei_decomp_zero_points)
+            scratchpad.book(key_brgemm_primitive_wei_decomp_zero_points,
+                    wei_decomp_params_sz, types::data_type_size(f32));
     }
 
+    if (bgmmc.with_src_dyn_quant)
+        scratchpad.book(key_brgemm_primitive_src_dyn_quant_scales,
+                bgmmc.nthr * bgmmc.src_dyn_quant_scales_elems_per_thr,
+                types::data_type_size(f32));
+
+    if (bgmmc.with_dst_amax)
+        scratchpad.book(key_brgemm_primitive_dst_amax,
+                static_cast<size_t>(bgmmc.nthr) * dst_amax_elems_per_thr,
+                types::data_type_size(f32), 64);
+
     if (bgmmc.use_buffer_c)
         scratchpad.book(key_brgemm_primitive_buffer,
                 bgmmc.nthr * bgmmc.buffer_c_per_thread_sz, default_data_align);
@@ -1222,12 +1454,42 @@ void init_scratchpad(memory_tracking::registrar_t &scratchpad,
                 bgmmc.nthr * bgmmc.zp_b_comp_elems_per_thr,
                 types::data_type_size(s32));
 
+    if (bgmmc.wei_zp_type == brgemm_broadcast_t::per_n)
+        scratchpad.book(key_brgemm_primitive_wei_zp_values, bgmmc.N,
+                types::data_type_size(s32));
+
     if (is_superset(bgmmc.isa, avx512_core_amx))
         scratchpad.book(key_conv_amx_tile_buffer,
                 static_cast<size_t>(bgmmc.nthr) * bgmmc.wsp_tile_per_thr_bytes,
                 default_data_align);
 }
 
+void init_runtime_dims(brgemm_matmul_conf_t &bgmmc, dim_t M) {
+    assert(bgmmc.is_runtime_M);
+    bgmmc.M = M;
+    bgmmc.M_tail = M % bgmmc.M_blk;
+    bgmmc.M_chunks = div_up(M, bgmmc.M_chunk_elems);
+    bgmmc.num_M_blocks = div_up(M, bgmmc.M_blk);
+
+    // Only plain layouts are supported, so the batch strides are dense.
+    if (bgmmc.batch_ndims > 0) {
+        bgmmc.A_strides[2] = bgmmc.a_dt_sz * M * bgmmc.K;
+        bgmmc.C_strides[2] = bgmmc.c_dt_sz * M * bgmmc.N;
+    }
+
+    // Split N finer when M is too small to keep all threads busy. All the
+    // buffers are booked for the original N chunk, so it can only shrink.
+    const dim_t work_amount = bgmmc.batch * bgmmc.M_chunks * bgmmc.N_chunks;
+    if (work_amount < bgmmc.nthr && bgmmc.N_chunk_size > 1 && M > 0) {
+        const dim_t req_N_chunks
+                = div_up(bgmmc.nthr, bgmmc.batch * bgmmc.M_chunks);
+        bgmmc.N_chunk_size = static_cast<int>(nstl::max(static_cast<dim_t>(1),
+                div_up(static_cast<dim_t>(bgmmc.num_N_blocks), req_N_chunks)));
+        bgmmc.N_chunk_elems = bgmmc.N_blk * bgmmc.N_chunk_size;
+        bgmmc.N_chunks = div_up(bgmmc.N, bgmmc.N_chunk_elems);
+    }
+}
+
 void matmul_amx_blocking_params_t::update_k_blocking_dependent_params() {
     k_chunk_elems_ = k_blk_ * k_chunk_size_;
     current_lda_ = get_actual_lda();
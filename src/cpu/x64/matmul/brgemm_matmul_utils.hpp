@@ -30,6 +30,14 @@ namespace matmul {
 
 constexpr int max_batch_ndims = DNNL_MAX_NDIMS - 2;
 
+// The value of M the blocking is chosen for when M is defined at execution.
+// It bounds the M block, hence the number of possible runtime M tails.
+constexpr dim_t runtime_M_nominal = 64;
+
+// The per-thread buffer of the destination dynamic range holds a full
+// vector of the running maximum followed by one of the running minimum.
+constexpr dim_t dst_amax_elems_per_thr = 2 * 16;
+
 struct brgemm_matmul_bcast_desc_t {
 
     brgemm_matmul_bcast_desc_t()
@@ -105,6 +113,9 @@ struct brgemm_matmul_conf_t {
     bool use_buffer_a_tail_only;
     bool use_buffer_b;
     bool use_buffer_c;
+    // The blocks of B consisting of zeros only are detected on copying B to
+    // the buffer and dropped from the brgemm batch.
+    bool skip_zero_b_blocks;
 
     brgemm_matmul_bcast_desc_t bcast_A_desc;
     brgemm_matmul_bcast_desc_t bcast_B_desc;
@@ -114,6 +125,31 @@ struct brgemm_matmul_conf_t {
     data_type_t wei_dt;
     data_type_t acc_dt;
     data_type_t bia_dt;
+    // The integer weights are decompressed to wei_dt on copying to the buffer,
+    // orig_wei_dt keeps the data type of the user weights.
+    data_type_t orig_wei_dt;
+    bool with_wei_decompression;
+    // The grouped or non-f32 weights scales and the weights zero points of
+    // the decompressed weights are applied on copying to the buffer. Both are
+    // expanded to f32 values for every group of wei_decomp_group_k rows and
+    // every column before the computations.
+    bool with_wei_decomp_scales, with_wei_decomp_zero_points;
+    data_type_t wei_decomp_scales_dt, wei_decomp_zero_points_dt;
+    dim_t wei_decomp_scales_group_k, wei_decomp_zero_points_group_k;
+    bool wei_decomp_scales_per_n, wei_decomp_zero_points_per_n;
+    dim_t wei_decomp_group_k;
+    // The floating-point source is quantized to s8 on copying to the buffer
+    // with a scale per row, the scales are applied to the accumulators.
+    // orig_src_dt keeps the data type of the user source.
+    bool with_src_dyn_quant;
+    data_type_t orig_src_dt;
+    // The paged weights are copied to the buffer page by page, the pages are
+    // located through the page table. wei_page_size is 0 for regular weights.
+    dim_t wei_page_size;
+    bool is_wei_paged_along_k;
+    // The kernels keep the running maximum and minimum of the destination in
+    // the per-thread buffer, reduced to the maximum absolute value at the end.
+    bool with_dst_amax;
     int nthr;
     int nthr_k;
 
@@ -169,6 +205,8 @@ struct brgemm_matmul_conf_t {
     dim_t zp_b_comp_buffer_shift_m;
     dim_t zp_b_comp_elems_per_thr;
 
+    dim_t src_dyn_quant_scales_elems_per_thr;
+
     int wsp_tile_per_thr_bytes;
     int brgemm_batch_element_per_thr_sz;
     bool is_amx;
@@ -176,6 +214,9 @@ struct brgemm_matmul_conf_t {
     int required_k_granularity;
     bool is_bf32 = false;
     bool req_wei_vnni_downconvert = false;
+    // M is DNNL_RUNTIME_DIM_VAL at creation: the configuration is built for
+    // runtime_M_nominal and updated with init_runtime_dims() at execution.
+    bool is_runtime_M = false;
 };
 
 struct brgemm_matmul_conf_utils_t {
@@ -197,6 +238,7 @@ struct brgemm_matmul_conf_utils_t {
     }
 
     inline bool use_buffer_b(bool use_heuristic = true) const {
+        if (bgmmc.with_wei_decompression) return true;
         if (bgmmc.is_amx)
             // use b_buffer for AMX when:
             // - not bf32 && using non-blocked weights
@@ -304,6 +346,10 @@ status_t init_brgemm_matmul_conf(cpu_isa_t isa, brgemm_matmul_conf_t &bgmmc,
 void init_scratchpad(memory_tracking::registrar_t &scratchpad,
         const brgemm_matmul_conf_t &bgmmc);
 
+// Updates the M-dependent values of a configuration created with runtime M and
+// adjusts the N chunking so that small M problems still use all the threads.
+void init_runtime_dims(brgemm_matmul_conf_t &bgmmc, dim_t M);
+
 int get_default_n_block(format_tag_t matrix_b_tag);
 
 } // namespace matmul
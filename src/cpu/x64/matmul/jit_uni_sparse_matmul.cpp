@@ -0,0 +1,271 @@
+/*******************************************************************************
+* Copyright 2023 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "oneapi/dnnl/dnnl_config.h"
+
+#ifdef DNNL_EXPERIMENTAL_SPARSE
+
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/matmul/matmul_utils.hpp"
+
+#include "cpu/x64/matmul/jit_uni_sparse_matmul.hpp"
+
+#define GET_OFF(field) offsetof(jit_sparse_matmul_call_params_t, field)
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+namespace matmul {
+
+using namespace Xbyak;
+using namespace dnnl::impl::data_type;
+using namespace dnnl::impl::utils;
+
+template <cpu_isa_t isa>
+void jit_uni_sparse_matmul_kernel_t<isa>::prepare_tail_mask(int tail) {
+    if (is_superset(isa, avx512_core)) {
+        mov(reg_tmp.cvt32(), (1 << tail) - 1);
+        kmovw(k_tail, reg_tmp.cvt32());
+    } else {
+        // Build the mask on the stack to keep the kernel free of pointers to
+        // static data.
+        sub(rsp, simd_w_ * sizeof(float));
+        for (int i = 0; i < simd_w_; i++)
+            mov(dword[rsp + i * sizeof(float)], i < tail ? -1 : 0);
+        vmovups(vmm_tail_mask, ptr[rsp]);
+        add(rsp, simd_w_ * sizeof(float));
+    }
+}
+
+template <cpu_isa_t isa>
+void jit_uni_sparse_matmul_kernel_t<isa>::load_value() {
+    if (data_type_ == f32) {
+        uni_vbroadcastss(vmm_value, ptr[reg_value_ptr]);
+    } else {
+        assert(data_type_ == bf16);
+        const Xmm xmm_value(vmm_value.getIdx());
+        movzx(reg_tmp.cvt32(), word[reg_value_ptr]);
+        shl(reg_tmp.cvt32(), 16);
+        vmovd(xmm_value, reg_tmp.cvt32());
+        vbroadcastss(vmm_value, xmm_value);
+    }
+}
+
+template <cpu_isa_t isa>
+void jit_uni_sparse_matmul_kernel_t<isa>::load_wei(
+        const Vmm &vmm, const Address &addr, bool is_tail) {
+    const bool is_avx512 = is_superset(isa, avx512_core);
+    if (data_type_ == f32) {
+        if (!is_tail)
+            uni_vmovups(vmm, addr);
+        else if (is_avx512)
+            vmovups(vmm | k_tail | T_z, addr);
+        else
+            vmaskmovps(vmm, vmm_tail_mask, addr);
+    } else {
+        // bf16 is supported with avx512_core only.
+        assert(data_type_ == bf16 && is_avx512);
+        if (!is_tail)
+            vpmovzxwd(vmm, addr);
+        else
+            vpmovzxwd(vmm | k_tail | T_z, addr);
+        vpslld(vmm, vmm, 16);
+    }
+}
+
+template <cpu_isa_t isa>
+void jit_uni_sparse_matmul_kernel_t<isa>::store_dst(
+        const Address &addr, const Vmm &vmm, bool is_tail) {
+    if (!is_tail)
+        uni_vmovups(addr, vmm);
+    else if (is_superset(isa, avx512_core))
+        vmovups(addr | k_tail, vmm);
+    else
+        vmaskmovps(addr, vmm_tail_mask, vmm);
+}
+
+template <cpu_isa_t isa>
+void jit_uni_sparse_matmul_kernel_t<isa>::compute_block(
+        int nvecs, bool is_tail) {
+    for (int i = 0; i < nvecs; i++)
+        uni_vpxor(vmm_acc(i), vmm_acc(i), vmm_acc(i));
+
+    Label l_nnz_loop, l_nnz_end;
+    mov(reg_value_ptr, reg_values);
+    mov(reg_index_ptr, reg_indices);
+    mov(reg_cnt, reg_nnz);
+    test(reg_cnt, reg_cnt);
+    jz(l_nnz_end, T_NEAR);
+
+    L(l_nnz_loop);
+    {
+        movsxd(reg_wei_row, dword[reg_index_ptr]);
+        imul(reg_wei_row, reg_wei_row, static_cast<int>(N_ * typesize_));
+        add(reg_wei_row, reg_wei);
+        load_value();
+        for (int i = 0; i < nvecs; i++) {
+            const bool is_vec_tail = is_tail && i == nvecs - 1;
+            const auto addr = ptr[reg_wei_row + i * simd_w_ * typesize_];
+            if (data_type_ == f32 && !is_vec_tail) {
+                uni_vfmadd231ps(vmm_acc(i), vmm_value, addr);
+            } else {
+                load_wei(vmm_wei, addr, is_vec_tail);
+                uni_vfmadd231ps(vmm_acc(i), vmm_value, vmm_wei);
+            }
+        }
+        add(reg_value_ptr, typesize_);
+        add(reg_index_ptr, sizeof(int32_t));
+        dec(reg_cnt);
+        jnz(l_nnz_loop, T_NEAR);
+    }
+    L(l_nnz_end);
+
+    for (int i = 0; i < nvecs; i++)
+        store_dst(ptr[reg_dst + i * simd_w_ * sizeof(float)], vmm_acc(i),
+                is_tail && i == nvecs - 1);
+}
+
+template <cpu_isa_t isa>
+void jit_uni_sparse_matmul_kernel_t<isa>::generate() {
+    preamble();
+
+    mov(reg_values, ptr[reg_param + GET_OFF(src_values)]);
+    mov(reg_indices, ptr[reg_param + GET_OFF(src_indices)]);
+    mov(reg_nnz, ptr[reg_param + GET_OFF(nnz)]);
+    mov(reg_wei, ptr[reg_param + GET_OFF(wei)]);
+    mov(reg_dst, ptr[reg_param + GET_OFF(dst)]);
+
+    const dim_t block_size = n_unroll_ * simd_w_;
+    const dim_t n_blocks = N_ / block_size;
+    const int n_rem = N_ % block_size;
+    const int tail = n_rem % simd_w_;
+    if (tail) prepare_tail_mask(tail);
+
+    if (n_blocks > 0) {
+        Label l_n_loop;
+        mov(reg_n_blocks, n_blocks);
+        L(l_n_loop);
+        {
+            compute_block(n_unroll_, false);
+            add(reg_wei, block_size * typesize_);
+            add(reg_dst, block_size * sizeof(float));
+            dec(reg_n_blocks);
+            jnz(l_n_loop, T_NEAR);
+        }
+    }
+    if (n_rem) compute_block(div_up(n_rem, simd_w_), tail != 0);
+
+    postamble();
+}
+
+template <cpu_isa_t isa>
+bool jit_uni_sparse_matmul_t<isa>::pd_t::formats_ok() {
+    const memory_desc_wrapper src_d(src_md(0));
+    if (!src_d.is_sparse_desc() || src_d.encoding() != sparse_encoding::csr
+            || src_d.metadata_type(0) != s32 || src_d.metadata_type(1) != s32)
+        return false;
+
+    for (auto md : {&weights_md_, &dst_md_}) {
+        memory_desc_wrapper mdw(md);
+        if (mdw.format_any()
+                && memory_desc_init_by_tag(*md, format_tag::ab)
+                        != status::success)
+            return false;
+        if (!memory_desc_wrapper(md).matches_tag(format_tag::ab)) return false;
+    }
+    return true;
+}
+
+template <cpu_isa_t isa>
+status_t jit_uni_sparse_matmul_t<isa>::pd_t::init(engine_t *engine) {
+    const auto src_type = src_md(0)->data_type;
+    const auto wei_type = weights_md(0)->data_type;
+    const auto dst_type = dst_md(0)->data_type;
+
+    // The offsets of the weights rows are computed with 32-bit arithmetic.
+    const bool offsets_ok = N() * types::data_type_size(wei_type) <= INT_MAX;
+
+    const bool ok = mayiuse(isa)
+            && (src_type == f32
+                    || (src_type == bf16 && is_superset(isa, avx512_core)))
+            && wei_type == src_type && dst_type == f32 && ndims() == 2
+            && !with_bias() && !has_zero_dim_memory()
+            && !has_runtime_dims_or_strides() && attr()->has_default_values()
+            && formats_ok() && offsets_ok;
+    return ok ? status::success : status::unimplemented;
+}
+
+template <cpu_isa_t isa>
+status_t jit_uni_sparse_matmul_t<isa>::init(engine_t *engine) {
+    CHECK(safe_ptr_assign(kernel_,
+            new jit_uni_sparse_matmul_kernel_t<isa>(
+                    pd()->N(), pd()->src_md(0)->data_type)));
+    return kernel_->create_kernel();
+}
+
+template <cpu_isa_t isa>
+status_t jit_uni_sparse_matmul_t<isa>::execute(const exec_ctx_t &ctx) const {
+    const auto src_values = CTX_IN_SPARSE_MEM(const char *, DNNL_ARG_SRC, 0);
+    const auto src_indices
+            = CTX_IN_SPARSE_MEM(const int32_t *, DNNL_ARG_SRC, 1);
+    const auto src_pointers
+            = CTX_IN_SPARSE_MEM(const int32_t *, DNNL_ARG_SRC, 2);
+    const auto wei = CTX_IN_MEM(const void *, DNNL_ARG_WEIGHTS);
+    auto dst = CTX_OUT_MEM(float *, DNNL_ARG_DST);
+
+    const dim_t M = pd()->M();
+    const dim_t N = pd()->N();
+    const size_t typesize = types::data_type_size(pd()->src_md(0)->data_type);
+
+    // The rows are split by the number of non-zero entries rather than by
+    // their count, so that skewed sparsity patterns don't leave threads idle.
+    parallel(0, [&](const int ithr, const int nthr) {
+        dim_t m_start {0}, m_end {0};
+        cpu::matmul::balance_csr_rows(
+                M, src_pointers, nthr, ithr, m_start, m_end);
+
+        jit_sparse_matmul_call_params_t p;
+        p.wei = wei;
+        for (dim_t m = m_start; m < m_end; m++) {
+            const dim_t row_start = src_pointers[m];
+            p.src_values = src_values + row_start * typesize;
+            p.src_indices = src_indices + row_start;
+            p.nnz = src_pointers[m + 1] - row_start;
+            p.dst = dst + m * N;
+            (*kernel_)(&p);
+        }
+    });
+
+    return status::success;
+}
+
+template struct jit_uni_sparse_matmul_kernel_t<avx2>;
+template struct jit_uni_sparse_matmul_kernel_t<avx512_core>;
+template struct jit_uni_sparse_matmul_t<avx2>;
+template struct jit_uni_sparse_matmul_t<avx512_core>;
+
+} // namespace matmul
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
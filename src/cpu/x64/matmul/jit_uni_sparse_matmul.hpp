@@ -0,0 +1,137 @@
+/*******************************************************************************
+* Copyright 2023 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_X64_MATMUL_JIT_UNI_SPARSE_MATMUL_HPP
+#define CPU_X64_MATMUL_JIT_UNI_SPARSE_MATMUL_HPP
+
+#include "oneapi/dnnl/dnnl_config.h"
+
+#ifdef DNNL_EXPERIMENTAL_SPARSE
+
+#include <memory>
+
+#include "common/c_types_map.hpp"
+#include "common/primitive.hpp"
+#include "common/type_helpers.hpp"
+
+#include "cpu/matmul/cpu_matmul_pd.hpp"
+
+#include "cpu/x64/cpu_isa_traits.hpp"
+#include "cpu/x64/jit_generator.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+namespace matmul {
+
+struct jit_sparse_matmul_call_params_t {
+    // The values and the column indices of the non-zero entries of a row.
+    const void *src_values;
+    const int32_t *src_indices;
+    dim_t nnz;
+    const void *wei;
+    float *dst;
+};
+
+// Computes a row of the destination: the sum of the weights rows selected by
+// the column indices of the non-zero source entries, scaled by their values.
+template <cpu_isa_t isa>
+struct jit_uni_sparse_matmul_kernel_t : public jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_sparse_matmul_kernel_t)
+
+    jit_uni_sparse_matmul_kernel_t(dim_t N, data_type_t data_type)
+        : jit_generator(jit_name(), nullptr, MAX_CODE_SIZE, true, isa)
+        , N_(N)
+        , data_type_(data_type)
+        , typesize_(types::data_type_size(data_type)) {}
+
+    bool is_relocatable() const override { return true; }
+
+private:
+    using Vmm = typename cpu_isa_traits<isa>::Vmm;
+
+    static constexpr int simd_w_ = cpu_isa_traits<isa>::vlen / sizeof(float);
+    // The number of destination vectors accumulated at once.
+    static constexpr int n_unroll_ = isa == avx2 ? 4 : 8;
+
+    const dim_t N_;
+    const data_type_t data_type_;
+    const size_t typesize_;
+
+    const Xbyak::Reg64 reg_param = abi_param1;
+    const Xbyak::Reg64 reg_values = r8;
+    const Xbyak::Reg64 reg_indices = r9;
+    const Xbyak::Reg64 reg_nnz = r10;
+    const Xbyak::Reg64 reg_wei = r11;
+    const Xbyak::Reg64 reg_dst = r12;
+    const Xbyak::Reg64 reg_cnt = r13;
+    const Xbyak::Reg64 reg_wei_row = r14;
+    const Xbyak::Reg64 reg_tmp = r15;
+    const Xbyak::Reg64 reg_value_ptr = rax;
+    const Xbyak::Reg64 reg_index_ptr = rbx;
+    const Xbyak::Reg64 reg_n_blocks = rdx;
+
+    const Xbyak::Opmask k_tail = k1;
+    const Vmm vmm_tail_mask = Vmm(15);
+    const Vmm vmm_value = Vmm(n_unroll_);
+    const Vmm vmm_wei = Vmm(n_unroll_ + 1);
+
+    Vmm vmm_acc(int i) const { return Vmm(i); }
+
+    void prepare_tail_mask(int tail);
+    void load_value();
+    void load_wei(const Vmm &vmm, const Xbyak::Address &addr, bool is_tail);
+    void store_dst(const Xbyak::Address &addr, const Vmm &vmm, bool is_tail);
+    void compute_block(int nvecs, bool is_tail);
+
+    void generate() override;
+};
+
+template <cpu_isa_t isa>
+struct jit_uni_sparse_matmul_t : public primitive_t {
+    struct pd_t : public cpu::matmul::cpu_matmul_pd_t {
+        using cpu::matmul::cpu_matmul_pd_t::cpu_matmul_pd_t;
+
+        DECLARE_COMMON_PD_T(JIT_IMPL_NAME_HELPER("jit:", isa, ""),
+                jit_uni_sparse_matmul_t);
+
+        status_t init(engine_t *engine);
+
+    private:
+        bool formats_ok();
+    };
+
+    jit_uni_sparse_matmul_t(const pd_t *apd) : primitive_t(apd) {}
+
+    status_t init(engine_t *engine) override;
+    status_t execute(const exec_ctx_t &ctx) const override;
+
+private:
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+
+    std::unique_ptr<jit_uni_sparse_matmul_kernel_t<isa>> kernel_;
+};
+
+} // namespace matmul
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
+
+#endif
@@ -1310,7 +1310,8 @@ static status_t init_kernels_diff_wei(rnn_diff_wei_brgemm_t &diff_wei,
     // diff_wei rnn brgemm implementation.
     // TODO: provide unification of jit-based copy routines with implementation
     // independent interface
-    matmul::brgemm_matmul_conf_t tmp_matmul_conf_for_reorder;
+    auto tmp_matmul_conf_for_reorder
+            = utils::zero<matmul::brgemm_matmul_conf_t>();
     tmp_matmul_conf_for_reorder.wei_tag = format_tag::ab;
     tmp_matmul_conf_for_reorder.N = rnn.scratch_gates_ld;
     tmp_matmul_conf_for_reorder.K = rnn.mb;
@@ -0,0 +1,145 @@
+/*******************************************************************************
+ * Copyright 2024 Intel Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *******************************************************************************/
+
+#include <cstring>
+#include <future>
+#include <memory>
+
+#include "oneapi/dnnl/dnnl_version.h"
+
+#include "graph/backend/dnnl/constant_blob.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace graph {
+namespace dnnl_impl {
+
+namespace {
+
+constexpr char constant_blob_magic[8]
+        = {'D', 'N', 'N', 'L', 'C', 'O', 'N', 'S'};
+
+// The size of the constants in a blob. The size of the persistent buffer
+// includes the space reserved to align its base address, which is not saved.
+size_t get_constant_data_size(const memory_planner_t &planner) {
+    const size_t size = planner.total_internal_persistent_size();
+    return size == 0 ? 0 : size - planner.internal_persistent_alignment();
+}
+
+void init_header(
+        constant_blob_header_t &header, const memory_planner_t &planner) {
+    std::memset(&header, 0, sizeof(header));
+    std::memcpy(header.magic, constant_blob_magic, sizeof(header.magic));
+    header.format_version = constant_blob_format_version;
+    header.header_size = static_cast<uint32_t>(sizeof(header));
+
+    const dnnl_version_t *version = dnnl_version();
+    header.lib_version[0] = version->major;
+    header.lib_version[1] = version->minor;
+    header.lib_version[2] = version->patch;
+    std::strncpy(header.lib_hash, version->hash, sizeof(header.lib_hash) - 1);
+
+    header.layout_hash = planner.internal_persistent_layout_hash();
+    header.alignment = planner.internal_persistent_alignment();
+    header.data_offset = constant_blob_page_size;
+    header.data_size = get_constant_data_size(planner);
+}
+
+char *align_base(char *base, size_t alignment) {
+    return reinterpret_cast<char *>(
+            (reinterpret_cast<size_t>(base) + alignment - 1) / alignment
+            * alignment);
+}
+
+} // namespace
+
+status_t get_constant_blob(const constant_cache_t::key_t &key,
+        const memory_planner_t &planner, const dnnl::engine &p_engine,
+        size_t *size, uint8_t *blob) {
+    if (!size) return status::invalid_arguments;
+    // The constants are read and written by the host
+    if (p_engine.get_kind() != dnnl::engine::kind::cpu)
+        return status::unimplemented;
+
+    constant_blob_header_t header;
+    init_header(header, planner);
+    const size_t blob_size = header.data_offset + header.data_size;
+    if (!blob) {
+        *size = blob_size;
+        return status::success;
+    }
+    if (*size < blob_size) return status::invalid_arguments;
+
+    std::memset(blob, 0, header.data_offset);
+    std::memcpy(blob, &header, sizeof(header));
+    if (header.data_size == 0) return status::success;
+
+    // The constants are folded on the first execution
+    constant_cache_t global_constant_cache;
+    constant_cache_t::value_t cached_value
+            = global_constant_cache.get_if_exist(key);
+    if (!cached_value.valid()) return status::invalid_arguments;
+
+    const constant_cache_t::cached_t &c_buffer = cached_value.get();
+    if (!c_buffer) return status::runtime_error;
+    const char *base = align_base(c_buffer->data<char>(), header.alignment);
+    std::memcpy(blob + header.data_offset, base, header.data_size);
+    return status::success;
+}
+
+status_t set_constant_blob(const constant_cache_t::key_t &key,
+        const memory_planner_t &planner, const dnnl::engine &p_engine,
+        const allocator_t *alc, size_t size, const uint8_t *blob) {
+    if (!blob || size < sizeof(constant_blob_header_t))
+        return status::invalid_arguments;
+    if (p_engine.get_kind() != dnnl::engine::kind::cpu)
+        return status::unimplemented;
+
+    constant_blob_header_t given, expected;
+    std::memcpy(&given, blob, sizeof(given));
+    init_header(expected, planner);
+
+    // The blob must be created by the same library for the same layout of the
+    // persistent buffer.
+    const bool ok = std::memcmp(&given, &expected, sizeof(given)) == 0
+            && size >= given.data_offset + given.data_size;
+    if (!ok) return status::invalid_arguments;
+    if (given.data_size == 0) return status::success;
+
+    uint8_t *data = const_cast<uint8_t *>(blob) + given.data_offset;
+    constant_cache_t::cached_t c_buffer;
+    if (reinterpret_cast<size_t>(data) % given.alignment == 0) {
+        c_buffer = std::make_shared<constant_buffer_t>(
+                data, given.data_size, p_engine);
+    } else {
+        c_buffer = std::make_shared<constant_buffer_t>(
+                planner.total_internal_persistent_size(), p_engine, alc);
+        char *base = align_base(c_buffer->data<char>(), given.alignment);
+        std::memcpy(base, data, given.data_size);
+    }
+
+    std::promise<constant_cache_t::cached_t> c_promise;
+    c_promise.set_value(c_buffer);
+    constant_cache_t global_constant_cache;
+    global_constant_cache.remove_if_exist(key);
+    global_constant_cache.get_or_add(key, c_promise.get_future());
+    return status::success;
+}
+
+} // namespace dnnl_impl
+} // namespace graph
+} // namespace impl
+} // namespace dnnl
@@ -0,0 +1,81 @@
+/*******************************************************************************
+ * Copyright 2024 Intel Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *******************************************************************************/
+#ifndef GRAPH_BACKEND_DNNL_CONSTANT_BLOB_HPP
+#define GRAPH_BACKEND_DNNL_CONSTANT_BLOB_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+#include "graph/interface/allocator.hpp"
+
+#include "graph/backend/dnnl/common.hpp"
+#include "graph/backend/dnnl/constant_cache.hpp"
+#include "graph/backend/dnnl/passes/memory_planning.hpp"
+
+#include "oneapi/dnnl/dnnl.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace graph {
+namespace dnnl_impl {
+
+// A constant blob holds the folded constants of a kernel, i.e. the content of
+// its internal persistent buffer in the global constant cache, so that they
+// can be loaded by another process without running the constant ops again.
+//
+// Layout of a blob:
+// - header: constant_blob_header_t, padded to constant_blob_page_size
+// - constants: the persistent buffer starting from its aligned base address.
+//   The section starts at a page aligned offset, so the constants of a memory
+//   mapped blob are used in place and can be shared by processes.
+//
+// A blob can only be imported by a kernel with the same layout of the
+// persistent buffer, built by the same library version.
+constexpr size_t constant_blob_page_size = 4096;
+constexpr uint32_t constant_blob_format_version = 1;
+
+struct constant_blob_header_t {
+    char magic[8];
+    uint32_t format_version;
+    uint32_t header_size;
+    int32_t lib_version[3];
+    char lib_hash[44];
+    uint64_t layout_hash;
+    uint64_t alignment;
+    uint64_t data_offset;
+    uint64_t data_size;
+};
+
+// Returns the size of the blob in @p size when @p blob is nullptr, otherwise
+// writes the cached constants of the kernel to @p blob. The constants are
+// computed on the first execution of the kernel.
+status_t get_constant_blob(const constant_cache_t::key_t &key,
+        const memory_planner_t &planner, const dnnl::engine &p_engine,
+        size_t *size, uint8_t *blob);
+
+// Puts the constants in @p blob into the global constant cache for the
+// kernel. The blob is referenced without a copy when the constants in it are
+// aligned as the kernel requires, so it must outlive the kernel.
+status_t set_constant_blob(const constant_cache_t::key_t &key,
+        const memory_planner_t &planner, const dnnl::engine &p_engine,
+        const allocator_t *alc, size_t size, const uint8_t *blob);
+
+} // namespace dnnl_impl
+} // namespace graph
+} // namespace impl
+} // namespace dnnl
+
+#endif
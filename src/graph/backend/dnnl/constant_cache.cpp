@@ -94,6 +94,11 @@ value_t constant_cache_t::get_or_add(const key_t &key, const value_t &value) {
     return e;
 }
 
+value_t constant_cache_t::get_if_exist(const key_t &key) {
+    impl::utils::lock_read_t lock_r(rw_mutex_);
+    return get(key);
+}
+
 void constant_cache_t::remove_if_exist(const key_t &key) {
     lock_write();
     if (constant_map_.count(key) == 0) {
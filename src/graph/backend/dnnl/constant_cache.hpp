@@ -45,7 +45,17 @@ struct constant_buffer_t {
         const_cast<allocator_t *>(alc)->retain();
     }
 
+    // Wraps a buffer owned by users, e.g. the constants imported from a
+    // memory mapped blob. The buffer is only read by the kernels.
+    constant_buffer_t(void *data, size_t size, const dnnl::engine &p_engine)
+        : data_(data)
+        , size_(size)
+        , p_engine_(p_engine)
+        , alc_(nullptr)
+        , is_owner_(false) {}
+
     ~constant_buffer_t() {
+        if (!is_owner_) return;
 #ifdef DNNL_WITH_SYCL
         dnnl_allocator_t::free(data_, p_engine_, alc_, {});
 #else
@@ -66,6 +76,7 @@ private:
     size_t size_;
     const dnnl::engine p_engine_;
     const allocator_t *alc_;
+    bool is_owner_ = true;
 };
 
 struct constant_cache_t {
@@ -78,6 +89,7 @@ struct constant_cache_t {
     status_t set_capacity(size_t capacity);
     size_t get_capacity() const;
     value_t get_or_add(const key_t &key, const value_t &value);
+    value_t get_if_exist(const key_t &key);
     void remove_if_exist(const key_t &key);
 
 private:
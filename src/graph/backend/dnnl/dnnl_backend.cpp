@@ -70,6 +70,7 @@ bool dnnl_backend::register_passes() {
     DNNL_BACKEND_REGISTER_PATTERN_CALL(reorder_fusion, pass_registry_);
     DNNL_BACKEND_REGISTER_PATTERN_CALL(shuffle_fusion, pass_registry_);
     DNNL_BACKEND_REGISTER_PATTERN_CALL(reduction_fusion, pass_registry_);
+    DNNL_BACKEND_REGISTER_PATTERN_CALL(sdp_fusion, pass_registry_);
     pass_registry_.sort_passes();
 
 #undef DNNL_BACKEND_REGISTER_PATTERN_CALL
@@ -103,6 +104,10 @@ kernel_ptr large_partition_kernel_creator() {
     return std::make_shared<larger_partition_kernel_t>();
 }
 
+kernel_ptr dynamic_shape_kernel_creator(const FCreateKernel &kernel_creator) {
+    return std::make_shared<dynamic_shape_kernel_t>(kernel_creator);
+}
+
 } // namespace dnnl_impl
 
 // This function should be called by backend_registry_t
@@ -33,9 +33,13 @@
 #include "graph/utils/utils.hpp"
 
 #include "graph/backend/dnnl/common.hpp"
+#include "graph/backend/dnnl/constant_blob.hpp"
+#include "graph/backend/dnnl/constant_cache.hpp"
 #include "graph/backend/dnnl/internal_ops.hpp"
 #include "graph/backend/dnnl/utils.hpp"
 
+#include "graph/backend/dnnl/passes/memory_planning.hpp"
+
 #ifdef DNNL_GRAPH_LAYOUT_DEBUG
 #include "oneapi/dnnl/dnnl_debug.h"
 #endif
@@ -197,7 +201,12 @@ struct enum_hash_t {
 };
 
 struct kernel_base_t {
-    virtual ~kernel_base_t() = default;
+    virtual ~kernel_base_t() {
+        if (enable_constant_cache_ && owns_constant_key_) {
+            constant_cache_t constant_cache;
+            constant_cache.remove_if_exist(constant_key_);
+        }
+    }
 
     status_t compile(const dnnl_partition_impl_t *part, const engine_t *aengine,
             const std::vector<logical_tensor_t> &inputs,
@@ -244,7 +253,57 @@ struct kernel_base_t {
 
     virtual status_t prepare_inplace_pairs_impl() { return status::success; };
 
+    // The size of the temporary buffer that is allocated on each execution to
+    // hold the intermediate results of the partition
+    virtual size_t get_scratchpad_size() const {
+        return memory_planner_.total_internal_temporary_size();
+    }
+
+    // Export the constants folded by the kernel to a blob and import them from
+    // a blob, see constant_blob.hpp. Only kernels that cache the folded
+    // constants in the global constant cache support them.
+    virtual status_t get_constant_blob(size_t *size, uint8_t *blob) const {
+        if (!enable_constant_cache_) return status::unimplemented;
+        return dnnl_impl::get_constant_blob(
+                constant_key_, memory_planner_, p_engine_, size, blob);
+    }
+
+    virtual status_t set_constant_blob(size_t size, const uint8_t *blob) {
+        if (!enable_constant_cache_) return status::unimplemented;
+        return dnnl_impl::set_constant_blob(constant_key_, memory_planner_,
+                p_engine_, g_alloc_, size, blob);
+    }
+
+    // Makes the compiled kernel cache its folded constants under a key
+    // derived from @p owner_key and the layout of its persistent buffer, so
+    // that kernels with the same owner and layout share the constants. The
+    // shared constants are removed by the owner instead of the kernel.
+    // Returns the new key.
+    constant_cache_t::key_t share_constant_cache(
+            constant_cache_t::key_t owner_key) {
+        constant_key_ = dnnl::impl::hash_combine(
+                owner_key, memory_planner_.internal_persistent_layout_hash());
+        owns_constant_key_ = false;
+        return constant_key_;
+    }
+
     std::vector<inplace_pair_t> inplace_pairs_;
+
+protected:
+    dnnl::engine p_engine_;
+    allocator_t *g_alloc_ = nullptr;
+
+    memory_planner_t memory_planner_;
+
+    // Kernels that cache their folded constants in the global constant cache
+    // set enable_constant_cache_ on construction. The cached constants are
+    // removed with the kernel.
+    // FIXME(qun) improve the cache key
+    constant_cache_t::key_t constant_key_
+            = reinterpret_cast<constant_cache_t::key_t>(this);
+
+    bool enable_constant_cache_ = false;
+    bool owns_constant_key_ = true;
 };
 
 using kernel_ptr = std::shared_ptr<kernel_base_t>;
@@ -252,6 +311,10 @@ using FCreateKernel = std::function<kernel_ptr(void)>;
 
 kernel_ptr large_partition_kernel_creator();
 
+// Creates a kernel that compiles the partition with the kernels given by
+// kernel_creator once the input shapes are known on execution.
+kernel_ptr dynamic_shape_kernel_creator(const FCreateKernel &kernel_creator);
+
 class dnnl_backend : public backend {
     friend class dnnl_partition_impl_t;
 
@@ -87,6 +87,18 @@ public:
     }
 #endif
 
+    size_t get_scratchpad_size() const override {
+        return kernel_->get_scratchpad_size();
+    }
+
+    status_t get_constant_blob(size_t *size, uint8_t *blob) const override {
+        return kernel_->get_constant_blob(size, blob);
+    }
+
+    status_t set_constant_blob(size_t size, const uint8_t *blob) override {
+        return kernel_->set_constant_blob(size, blob);
+    }
+
 private:
     kernel_ptr kernel_;
 };
@@ -190,6 +202,14 @@ public:
             kernel_creator = large_partition_kernel_creator;
         }
 
+        // Partitions compiled with unknown input dims are compiled for the
+        // actual shapes on execution.
+        if (has_unknown_input_shape(inputs)) {
+            kernel_creator = [kernel_creator]() {
+                return dynamic_shape_kernel_creator(kernel_creator);
+            };
+        }
+
         kernel_ptr kernel = kernel_creator();
         if (!kernel) return status::unimplemented;
 
@@ -225,6 +245,19 @@ public:
     }
 
 private:
+    bool has_unknown_input_shape(
+            const std::vector<logical_tensor_t> &inputs) const {
+        for (const auto &in : inputs_) {
+            for (const auto &given : inputs) {
+                if (given.id != in.id) continue;
+                if (logical_tensor_wrapper_t(given).is_shape_unknown())
+                    return true;
+                break;
+            }
+        }
+        return false;
+    }
+
     FCreateKernel kernel_creator_;
 };
 
@@ -53,11 +53,7 @@ namespace dnnl_impl {
 
 struct batchnorm_fwd_t : public kernel_base_t {
 private:
-    dnnl::engine p_engine_;
-    allocator_t *g_alloc_;
-
     std::shared_ptr<subgraph_t> subgraph_;
-    memory_planner_t memory_planner_;
 
     std::function<std::shared_ptr<execution_args_set_t>()> resource_ctor_;
 
@@ -203,11 +199,7 @@ public:
 
 struct batchnorm_bwd_t : public kernel_base_t {
 private:
-    dnnl::engine p_engine_;
-    allocator_t *g_alloc_;
-
     std::shared_ptr<subgraph_t> subgraph_;
-    memory_planner_t memory_planner_;
 
     std::function<std::shared_ptr<execution_args_set_t>()> resource_ctor_;
 
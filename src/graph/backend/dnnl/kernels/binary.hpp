@@ -61,11 +61,7 @@ struct binary_t : public kernel_base_t {
     using super = dnnl::binary;
 
 private:
-    dnnl::engine p_engine_;
-    allocator_t *g_alloc_;
-
     std::shared_ptr<subgraph_t> subgraph_;
-    memory_planner_t memory_planner_;
 
     std::function<std::shared_ptr<execution_args_set_t>()> resource_ctor_;
 
@@ -29,6 +29,7 @@
 #include "graph/interface/graph.hpp"
 
 #include "graph/backend/dnnl/common.hpp"
+#include "graph/backend/dnnl/constant_blob.hpp"
 #include "graph/backend/dnnl/constant_cache.hpp"
 #include "graph/backend/dnnl/dnnl_partition_impl.hpp"
 #include "graph/backend/dnnl/kernels/conv.hpp"
@@ -50,29 +51,18 @@ namespace dnnl_impl {
 
 struct convtranspose_base_t : public kernel_base_t {
 protected:
-    dnnl::engine p_engine_;
-    allocator_t *g_alloc_;
-
     std::shared_ptr<subgraph_t> subgraph_;
-    memory_planner_t memory_planner_;
 
     std::function<std::shared_ptr<execution_args_set_t>()> resource_ctor_;
 
-    // FIXME(qun) improve the cache key
-    constant_cache_t::key_t constant_key_
-            = reinterpret_cast<constant_cache_t::key_t>(this);
-
-    bool enable_constant_cache_ = is_constant_cache_enabled();
-
 public:
+    convtranspose_base_t() {
+        enable_constant_cache_ = is_constant_cache_enabled();
+    }
+
     ~convtranspose_base_t() override {
         thread_local_cache_t<execution_args_set_t> res_cache;
         res_cache.remove_if_exist(reinterpret_cast<size_t>(this));
-
-        if (enable_constant_cache_) {
-            constant_cache_t constant_cache;
-            constant_cache.remove_if_exist(constant_key_);
-        }
     }
 
     void prepare_args_set(const execution_args_set_t *res,
@@ -0,0 +1,296 @@
+/*******************************************************************************
+* Copyright 2024 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef GRAPH_BACKEND_DNNL_KERNELS_DYNAMIC_SHAPE_HPP
+#define GRAPH_BACKEND_DNNL_KERNELS_DYNAMIC_SHAPE_HPP
+
+#include <algorithm>
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <utility>
+#include <vector>
+
+#include "common/stream.hpp"
+
+#include "graph/interface/backend.hpp"
+#include "graph/interface/logical_tensor.hpp"
+
+#include "graph/utils/utils.hpp"
+
+#include "graph/backend/dnnl/common.hpp"
+#include "graph/backend/dnnl/constant_cache.hpp"
+#include "graph/backend/dnnl/dnnl_partition_impl.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace graph {
+namespace dnnl_impl {
+
+// Kernel for partitions compiled with unknown input dimensions.
+//
+// Compilation only records the partition and the user given logical tensors.
+// The actual shapes are bound on execution: the dims of the input tensors are
+// used as the key of a small LRU cache of kernels compiled for concrete
+// shapes. On a miss, a copy of the partition is compiled by the kernel that
+// the pattern selected, and the output shapes are inferred by the shape
+// inference passes of that kernel. Primitives of different kernels that have
+// the same descriptors are shared through the primitive cache, and the folded
+// constants of kernels with the same persistent buffer layout are shared
+// through the constant cache.
+class dynamic_shape_kernel_t : public kernel_base_t {
+private:
+    using key_t = std::vector<dim_t>;
+
+    struct entry_t {
+        // The kernel may keep references to the ops of the partition it was
+        // compiled from, so the partition lives as long as the kernel.
+        std::shared_ptr<dnnl_partition_impl_t> part;
+        kernel_ptr kernel;
+        std::vector<logical_tensor_t> outputs;
+        constant_cache_t::key_t constant_key;
+    };
+
+    using entry_list_t = std::list<std::pair<key_t, std::shared_ptr<entry_t>>>;
+
+    FCreateKernel kernel_creator_;
+    std::shared_ptr<dnnl_partition_impl_t> part_;
+
+    std::vector<logical_tensor_t> inputs_;
+    std::vector<logical_tensor_t> outputs_;
+
+    size_t capacity_;
+    entry_list_t entries_;
+    std::map<key_t, entry_list_t::iterator> index_;
+    // Keys of the folded constants shared by the kernels. They outlive the
+    // evicted kernels and are removed with this one.
+    std::set<constant_cache_t::key_t> constant_keys_;
+    std::mutex mutex_;
+
+    status_t make_key(const std::vector<tensor_t> &inputs, key_t &key) const {
+        if (inputs.size() != inputs_.size()) return status::invalid_arguments;
+
+        key.clear();
+        for (const auto &in : inputs) {
+            logical_tensor_wrapper_t ltw(in.get_logical_tensor());
+            if (ltw.is_shape_unknown()) return status::invalid_shape;
+            key.push_back(ltw.ndims());
+            key.push_back(static_cast<dim_t>(ltw.layout_type()));
+            const auto dims = ltw.vdims();
+            key.insert(key.end(), dims.begin(), dims.end());
+            if (ltw.is_strided()) {
+                const auto strides = ltw.vstrides();
+                key.insert(key.end(), strides.begin(), strides.end());
+            } else if (ltw.is_opaque()) {
+                key.push_back(static_cast<dim_t>(ltw.layout_id()));
+            }
+        }
+        return status::success;
+    }
+
+    // Compiles a copy of the partition for the shapes of the given input
+    // tensors.
+    status_t compile_for_shapes(const engine_t *g_engine,
+            const std::vector<tensor_t> &inputs,
+            std::shared_ptr<entry_t> &entry) const {
+        std::vector<logical_tensor_t> ins = inputs_;
+        for (size_t i = 0; i < ins.size(); i++) {
+            const logical_tensor_t &lt = inputs[i].get_logical_tensor();
+            ins[i].ndims = lt.ndims;
+            for (int d = 0; d < lt.ndims; d++)
+                ins[i].dims[d] = lt.dims[d];
+            ins[i].layout_type = lt.layout_type;
+            ins[i].layout = lt.layout;
+        }
+        std::vector<logical_tensor_t> outs = outputs_;
+
+        auto part = std::dynamic_pointer_cast<dnnl_partition_impl_t>(
+                part_->clone());
+        if (!part) return status::runtime_error;
+
+        // Shapes of the values produced inside the partition were recorded
+        // for some other input shapes, if at all. Reset them so that they are
+        // inferred from the new inputs.
+        for (auto &op : part->get_ops()) {
+            for (auto &val : op->get_output_values()) {
+                logical_tensor_t lt = val->get_logical_tensor();
+                if (lt.ndims <= 0) continue;
+                for (int d = 0; d < lt.ndims; d++) {
+                    lt.dims[d] = DNNL_GRAPH_UNKNOWN_DIM;
+                    if (lt.layout_type == layout_type::strided)
+                        lt.layout.strides[d] = DNNL_GRAPH_UNKNOWN_DIM;
+                }
+                val->set_logical_tensor(lt);
+            }
+        }
+
+        kernel_ptr kernel = kernel_creator_();
+        if (!kernel) return status::unimplemented;
+        BACKEND_DNNL_CHECK(kernel->compile(part.get(), g_engine, ins, outs));
+
+        for (const auto &out : outs) {
+            if (logical_tensor_wrapper_t(out).is_shape_unknown())
+                return status::invalid_shape;
+        }
+
+        entry = std::make_shared<entry_t>();
+        entry->part = part;
+        entry->kernel = kernel;
+        entry->outputs = outs;
+        entry->constant_key = kernel->share_constant_cache(
+                reinterpret_cast<constant_cache_t::key_t>(this));
+        return status::success;
+    }
+
+    status_t get_or_compile(const engine_t *g_engine,
+            const std::vector<tensor_t> &inputs,
+            std::shared_ptr<entry_t> &entry) {
+        key_t key;
+        BACKEND_DNNL_CHECK(make_key(inputs, key));
+
+        auto find_entry = [&]() {
+            auto it = index_.find(key);
+            if (it == index_.end()) return false;
+            entries_.splice(entries_.begin(), entries_, it->second);
+            entry = it->second->second;
+            return true;
+        };
+
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (find_entry()) return status::success;
+        }
+
+        // Compilation doesn't block the executions of the other shapes. If
+        // another thread compiled the same shapes meanwhile, its kernel is
+        // used.
+        std::shared_ptr<entry_t> compiled;
+        BACKEND_DNNL_CHECK(compile_for_shapes(g_engine, inputs, compiled));
+
+        std::lock_guard<std::mutex> lock(mutex_);
+        constant_keys_.insert(compiled->constant_key);
+        if (find_entry()) return status::success;
+
+        entry = compiled;
+        entries_.emplace_front(key, entry);
+        index_[key] = entries_.begin();
+        if (entries_.size() > capacity_) {
+            index_.erase(entries_.back().first);
+            entries_.pop_back();
+        }
+        return status::success;
+    }
+
+    // The output tensors must have the shapes inferred from the inputs, and
+    // the dense strides if they are strided.
+    static status_t check_outputs(const entry_t &entry,
+            const std::vector<tensor_t> &outputs) {
+        if (outputs.size() != entry.outputs.size())
+            return status::invalid_arguments;
+
+        for (size_t i = 0; i < outputs.size(); i++) {
+            logical_tensor_wrapper_t given(outputs[i].get_logical_tensor());
+            logical_tensor_wrapper_t expected(entry.outputs[i]);
+            if (given.vdims() != expected.vdims())
+                return status::invalid_shape;
+            if (given.is_strided() && expected.is_strided()
+                    && given.vstrides() != expected.vstrides())
+                return status::invalid_arguments;
+        }
+        return status::success;
+    }
+
+public:
+    explicit dynamic_shape_kernel_t(FCreateKernel kernel_creator)
+        : kernel_creator_(std::move(kernel_creator))
+        , capacity_(static_cast<size_t>(std::max(1,
+                  graph::utils::getenv_int_internal(
+                          "DYNAMIC_SHAPE_CACHE_CAPACITY", 64)))) {}
+
+    ~dynamic_shape_kernel_t() override {
+        constant_cache_t constant_cache;
+        for (const auto &key : constant_keys_)
+            constant_cache.remove_if_exist(key);
+    }
+
+    status_t compile_impl(const dnnl_partition_impl_t *part,
+            const engine_t *g_engine,
+            const std::vector<logical_tensor_t> &inputs,
+            const std::vector<logical_tensor_t> &outputs) override {
+        UNUSED(g_engine);
+
+        part_ = std::dynamic_pointer_cast<dnnl_partition_impl_t>(
+                part->clone());
+        if (!part_) return status::runtime_error;
+
+        // The output shapes are only known on execution, so the outputs are
+        // always given in plain layout.
+        for (auto &given : outputs) {
+            auto &out = const_cast<logical_tensor_t &>(given);
+            if (out.layout_type != layout_type::any) continue;
+            out.layout_type = layout_type::strided;
+            for (int d = 0; d < out.ndims; d++)
+                out.layout.strides[d] = DNNL_GRAPH_UNKNOWN_DIM;
+        }
+
+        // Tensors are passed to execute in the order of the partition ports.
+        inputs_.clear();
+        outputs_.clear();
+        BACKEND_DNNL_CHECK(get_ordered_inputs_outputs(
+                part->get_inputs(), inputs, inputs_));
+        return get_ordered_inputs_outputs(
+                part->get_outputs(), outputs, outputs_);
+    }
+
+    status_t execute_impl(const stream_t *g_stream,
+            const std::vector<tensor_t> &inputs,
+            const std::vector<tensor_t> &outputs) override {
+        std::shared_ptr<entry_t> entry;
+        BACKEND_DNNL_CHECK(get_or_compile(g_stream->engine(), inputs, entry));
+        BACKEND_DNNL_CHECK(check_outputs(*entry, outputs));
+        return entry->kernel->execute(g_stream, inputs, outputs);
+    }
+
+#ifdef DNNL_WITH_SYCL
+    status_t sycl_execute_impl(const stream_t *g_stream,
+            const std::vector<tensor_t> &inputs,
+            const std::vector<tensor_t> &outputs,
+            const std::vector<::sycl::event> &sycl_deps,
+            ::sycl::event *sycl_event) override {
+        std::shared_ptr<entry_t> entry;
+        BACKEND_DNNL_CHECK(get_or_compile(g_stream->engine(), inputs, entry));
+        BACKEND_DNNL_CHECK(check_outputs(*entry, outputs));
+        return entry->kernel->execute_sycl(
+                g_stream, inputs, outputs, sycl_deps, sycl_event);
+    }
+#endif
+
+    // The number of kernels compiled for concrete shapes that are currently
+    // cached.
+    size_t get_num_cached_shapes() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return entries_.size();
+    }
+};
+
+} // namespace dnnl_impl
+} // namespace graph
+} // namespace impl
+} // namespace dnnl
+
+#endif
@@ -22,6 +22,7 @@
 #include <vector>
 #include <unordered_set>
 
+#include "graph/backend/dnnl/constant_blob.hpp"
 #include "graph/backend/dnnl/constant_cache.hpp"
 #include "graph/backend/dnnl/dnnl_partition_impl.hpp"
 #include "graph/backend/dnnl/op_executable.hpp"
@@ -44,28 +45,16 @@ namespace dnnl_impl {
 template <bool quantized>
 struct eltwise_fwd_t : public kernel_base_t {
 private:
-    dnnl::engine p_engine_;
-    allocator_t *g_alloc_;
-
     std::shared_ptr<subgraph_t> subgraph_;
-    memory_planner_t memory_planner_;
 
     std::function<std::shared_ptr<execution_args_set_t>()> resource_ctor_;
 
-    constant_cache_t::key_t constant_key_
-            = reinterpret_cast<constant_cache_t::key_t>(this);
-
-    bool enable_constant_cache_ = is_constant_cache_enabled();
-
 public:
+    eltwise_fwd_t() { enable_constant_cache_ = is_constant_cache_enabled(); }
+
     ~eltwise_fwd_t() override {
         thread_local_cache_t<execution_args_set_t> res_cache;
         res_cache.remove_if_exist(reinterpret_cast<size_t>(this));
-
-        if (enable_constant_cache_) {
-            constant_cache_t constant_cache;
-            constant_cache.remove_if_exist(constant_key_);
-        }
     }
 
     status_t prepare_inplace_pairs_impl() override {
@@ -315,11 +304,7 @@ using quantized_eltwise = eltwise_fwd_t</* quantized */ true>;
 
 struct eltwise_bwd_t : public kernel_base_t {
 private:
-    dnnl::engine p_engine_;
-    allocator_t *g_alloc_;
-
     std::shared_ptr<subgraph_t> subgraph_;
-    memory_planner_t memory_planner_;
 
     std::function<std::shared_ptr<execution_args_set_t>()> resource_ctor_;
 
@@ -26,10 +26,13 @@
 #include <utility>
 #include <vector>
 
+#include "common/dnnl_thread.hpp"
+
 #include "graph/interface/backend.hpp"
 #include "graph/interface/graph.hpp"
 
 #include "graph/backend/dnnl/common.hpp"
+#include "graph/backend/dnnl/constant_blob.hpp"
 #include "graph/backend/dnnl/constant_cache.hpp"
 #include "graph/backend/dnnl/dnnl_partition_impl.hpp"
 #include "graph/backend/dnnl/op_executable.hpp"
@@ -53,33 +56,85 @@ namespace dnnl_impl {
 
 class larger_partition_kernel_t : public kernel_base_t {
 protected:
-    dnnl::engine p_engine_;
-    allocator_t *g_alloc_;
-
     std::shared_ptr<subgraph_t> subgraph_;
-    memory_planner_t memory_planner_;
 
     std::function<std::shared_ptr<execution_args_set_t>()> resource_ctor_;
 
-    // FIXME(qun) improve the cache key
-    constant_cache_t::key_t constant_key_
-            = reinterpret_cast<constant_cache_t::key_t>(this);
-
-    bool enable_constant_cache_ = is_constant_cache_enabled();
-
     std::once_flag once_flag_;
     subgraph_visualizer_t vis_;
     pass_pipeline_t pipeline_;
 
+    // Indices of the non-constant executables grouped by op level. Executables
+    // on the same level are independent and can be executed concurrently.
+    // Empty if the concurrent execution is disabled.
+    std::vector<std::vector<size_t>> exec_levels_;
+
+    void prepare_exec_levels() {
+        exec_levels_.clear();
+        if (!is_parallel_ops_enabled(p_engine_)) return;
+
+        const auto levels = get_op_levels(subgraph_);
+        size_t idx = 0;
+        topo_order_visit(subgraph_->get_output_ops(), [&](op_t *op) {
+            if (!subgraph_->is_constant_[idx]) {
+                // non-constant ops start from level 1
+                const size_t level = levels.at(op);
+                if (exec_levels_.size() < level) exec_levels_.resize(level);
+                exec_levels_[level - 1].emplace_back(idx);
+            }
+            idx++;
+            return status::success;
+        });
+    }
+
+    // Executes the independent ops of a level, concurrently if the threading
+    // runtime allows to give each of them a share of the threads.
+    void execute_level(const std::vector<size_t> &level,
+            const dnnl::stream &p_stream, execution_args_set_t *res) {
+        const auto exec = [&](size_t i) {
+            subgraph_->execs_[i]->execute(p_stream, res->get_exec_args()[i]);
+        };
+        const int nops = static_cast<int>(level.size());
+        const int nthr = dnnl_get_current_num_threads();
+
+#if DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_TBB
+        // Each op is executed in its own arena limited to its share of the
+        // threads, so the primitives of the op see only these threads.
+        if (nops > 1 && nthr > 1) {
+            const int share = std::max(1, nthr / nops);
+            parallel(nops, [&](const int iop, const int) {
+                tbb::task_arena arena(share);
+                arena.execute([&]() { exec(level[iop]); });
+            });
+            return;
+        }
+#elif DNNL_CPU_THREADING_RUNTIME != DNNL_RUNTIME_SEQ
+        // With OpenMP and threadpool a primitive executed inside a parallel
+        // region runs on the calling thread only. The ops are executed
+        // concurrently only if there are enough of them to occupy all the
+        // threads, otherwise each op is executed with all the threads.
+        if (nthr > 1 && nops >= nthr) {
+            parallel(nthr, [&](const int ithr, const int nthr_) {
+                int start = 0, end = 0;
+                balance211(nops, nthr_, ithr, start, end);
+                for (int iop = start; iop < end; iop++)
+                    exec(level[iop]);
+            });
+            return;
+        }
+#endif
+        for (size_t i : level)
+            exec(i);
+    }
+
 public:
+    larger_partition_kernel_t() {
+        enable_constant_cache_ = is_constant_cache_enabled();
+    }
+
     ~larger_partition_kernel_t() override {
         thread_local_cache_t<execution_args_set_t> res_cache;
         res_cache.remove_if_exist(reinterpret_cast<size_t>(this));
-
-        if (enable_constant_cache_) {
-            constant_cache_t constant_cache;
-            constant_cache.remove_if_exist(constant_key_);
-        }
     }
 
     static void setup_pipeline_stage1(pass_pipeline_t &pipeline) {
@@ -226,6 +281,8 @@ public:
         // Run the added passes
         BACKEND_DNNL_CHECK(pipeline_.run(subgraph_));
 
+        prepare_exec_levels();
+
         // fill information for inputs logical tensors
         for (size_t i = 0; i < inputs.size(); i++) {
             auto &in = const_cast<logical_tensor_t &>(inputs[i]);
@@ -333,6 +390,12 @@ public:
             }
         }
 
+        if (!exec_levels_.empty()) {
+            for (const auto &level : exec_levels_)
+                execute_level(level, p_stream, res);
+            return status::success;
+        }
+
         for (size_t i = 0; i < subgraph_->execs_.size(); i++) {
             if (subgraph_->is_constant_[i]) continue;
             subgraph_->execs_[i]->execute(p_stream, res->get_exec_args()[i]);
@@ -25,6 +25,7 @@
 #include <vector>
 
 #include "graph/backend/dnnl/common.hpp"
+#include "graph/backend/dnnl/constant_blob.hpp"
 #include "graph/backend/dnnl/constant_cache.hpp"
 #include "graph/backend/dnnl/dnnl_partition_impl.hpp"
 #include "graph/backend/dnnl/op_executable.hpp"
@@ -48,29 +49,16 @@ namespace dnnl_impl {
 
 struct layernorm_fwd_t : public kernel_base_t {
 private:
-    dnnl::engine p_engine_;
-    allocator_t *g_alloc_;
-
     std::shared_ptr<subgraph_t> subgraph_;
-    memory_planner_t memory_planner_;
 
     std::function<std::shared_ptr<execution_args_set_t>()> resource_ctor_;
 
-    // FIXME(qun) improve the cache key
-    constant_cache_t::key_t constant_key_
-            = reinterpret_cast<constant_cache_t::key_t>(this);
-
-    bool enable_constant_cache_ = is_constant_cache_enabled();
-
 public:
+    layernorm_fwd_t() { enable_constant_cache_ = is_constant_cache_enabled(); }
+
     ~layernorm_fwd_t() override {
         thread_local_cache_t<execution_args_set_t> res_cache;
         res_cache.remove_if_exist(reinterpret_cast<size_t>(this));
-
-        if (enable_constant_cache_) {
-            constant_cache_t constant_cache;
-            constant_cache.remove_if_exist(constant_key_);
-        }
     }
 
     status_t compile_impl(const dnnl_partition_impl_t *part,
@@ -306,11 +294,7 @@ public:
 
 struct layernorm_bwd_t : public kernel_base_t {
 private:
-    dnnl::engine p_engine_;
-    allocator_t *g_alloc_;
-
     std::shared_ptr<subgraph_t> subgraph_;
-    memory_planner_t memory_planner_;
 
     std::function<std::shared_ptr<execution_args_set_t>()> resource_ctor_;
 
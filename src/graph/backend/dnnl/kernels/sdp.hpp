@@ -0,0 +1,600 @@
+/*******************************************************************************
+* Copyright 2024 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef GRAPH_BACKEND_DNNL_KERNELS_SDP_HPP
+#define GRAPH_BACKEND_DNNL_KERNELS_SDP_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include "common/dnnl_thread.hpp"
+
+#include "graph/interface/backend.hpp"
+#include "graph/interface/graph.hpp"
+
+#include "graph/backend/dnnl/common.hpp"
+#include "graph/backend/dnnl/dnnl_partition_impl.hpp"
+#include "graph/backend/dnnl/kernels/large_partition.hpp"
+#include "graph/backend/dnnl/scratchpad.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace graph {
+namespace dnnl_impl {
+
+// Scaled dot-product attention:
+//   MatMul(Q, K) -> [Divide|Multiply](scale) -> [Add](mask) -> SoftMax
+//       -> MatMul(., V)
+//
+// The kernel never materializes the [Sq x Sk] score tensor. Work is split over
+// (batch, query block) pairs. For each query block, K and V are streamed in
+// blocks of keys, and a running max and sum are kept per query row (online
+// softmax), so the working set of a thread is one score tile and one output
+// tile. Tile products are executed by matmul primitives, which are backed by
+// brgemm on x64. Partitions whose shapes or layouts are not handled here are
+// compiled by the generic large partition kernel instead.
+class sdp_t : public kernel_base_t {
+private:
+    // Query and key block sizes. A 64x256 f32 score tile is 64 KB, which
+    // together with the K and V blocks stays within L2 for typical head sizes.
+    static constexpr dim_t max_q_block_ = 64;
+    static constexpr dim_t max_k_block_ = 256;
+
+    // Set when the partition is not supported by the fused implementation.
+    std::shared_ptr<larger_partition_kernel_t> fallback_;
+
+    // Indices of the partition inputs.
+    size_t q_idx_ = 0, k_idx_ = 0, v_idx_ = 0;
+    int scale_idx_ = -1, mask_idx_ = -1;
+    bool scale_is_div_ = false;
+    // K is given as [..., Sk, D] and transposed by the first matmul.
+    bool k_is_transposed_ = false;
+
+    dim_t batch_ = 1, sq_ = 0, sk_ = 0, d_ = 0, dv_ = 0;
+    dim_t bq_ = 0, bk_ = 0;
+    std::vector<dim_t> out_dims_;
+
+    // Mask offsets after broadcasting the mask to [batch..., Sq, Sk].
+    std::vector<dim_t> mask_batch_offsets_;
+    dim_t mask_stride_q_ = 0, mask_stride_k_ = 0;
+
+    // Tile primitives indexed by [query tail][key tail].
+    dnnl::matmul qk_prim_[2][2], pv_prim_[2][2];
+    dnnl::memory::desc q_md_[2], k_md_[2], s_md_[2][2], v_md_[2], o_md_[2];
+    size_t prim_scratchpad_size_ = 0;
+
+    static bool is_dense(const logical_tensor_t &lt) {
+        const logical_tensor_wrapper_t ltw(lt);
+        if (!ltw.is_strided() || ltw.is_shape_unknown()
+                || ltw.is_stride_unknown())
+            return false;
+        dim_t stride = 1;
+        for (int i = ltw.ndims() - 1; i >= 0; i--) {
+            if (ltw.dims()[i] != 1 && ltw.strides()[i] != stride) return false;
+            stride *= ltw.dims()[i];
+        }
+        return true;
+    }
+
+    status_t init_conf(const dnnl_partition_impl_t *part,
+            const std::vector<logical_tensor_t> &inputs,
+            const std::vector<logical_tensor_t> &outputs) {
+#ifdef DNNL_WITH_SYCL
+        return status::unimplemented;
+#endif
+        if (p_engine_.get_kind() != dnnl::engine::kind::cpu
+                || outputs.size() != 1)
+            return status::unimplemented;
+
+        std::unordered_map<size_t, op_t *> producers;
+        op_t *softmax = nullptr;
+        for (const auto &op : part->get_ops()) {
+            for (const auto &val : op->get_output_values())
+                producers[val->get_logical_tensor().id] = op.get();
+            if (op->get_kind() == graph::op_kind::SoftMax) softmax = op.get();
+        }
+        if (!softmax) return status::unimplemented;
+
+        auto input_index = [&](const std::shared_ptr<value_t> &val) {
+            const size_t id = val->get_logical_tensor().id;
+            for (size_t i = 0; i < inputs.size(); i++)
+                if (inputs[i].id == id) return static_cast<int>(i);
+            return -1;
+        };
+        auto get_bool = [](const op_t *op, op_attr_t name) {
+            return op->has_attr(name) && op->get_attr<bool>(name);
+        };
+
+        // Walk from the softmax input back to the first matmul. The scale
+        // must be applied before the mask.
+        op_t *mm_qk = nullptr;
+        auto cur = softmax->get_input_value(0);
+        while (!mm_qk) {
+            const auto it = producers.find(cur->get_logical_tensor().id);
+            if (it == producers.end()) return status::unimplemented;
+            op_t *op = it->second;
+            const auto kind = op->get_kind();
+            if (kind == graph::op_kind::MatMul) {
+                mm_qk = op;
+                break;
+            }
+            if (!dnnl::impl::utils::one_of(kind, graph::op_kind::Divide,
+                        graph::op_kind::Multiply, graph::op_kind::Add)
+                    || op->num_inputs() != 2)
+                return status::unimplemented;
+
+            const int in0 = input_index(op->get_input_value(0));
+            const int in1 = input_index(op->get_input_value(1));
+            int ext = -1;
+            if (in0 < 0 && in1 >= 0) {
+                ext = in1;
+                cur = op->get_input_value(0);
+            } else if (in0 >= 0 && in1 < 0
+                    && kind != graph::op_kind::Divide) {
+                ext = in0;
+                cur = op->get_input_value(1);
+            } else {
+                return status::unimplemented;
+            }
+
+            if (kind == graph::op_kind::Add) {
+                if (mask_idx_ >= 0 || scale_idx_ >= 0)
+                    return status::unimplemented;
+                mask_idx_ = ext;
+            } else {
+                if (scale_idx_ >= 0) return status::unimplemented;
+                scale_idx_ = ext;
+                scale_is_div_ = kind == graph::op_kind::Divide;
+            }
+        }
+
+        op_t *mm_v = nullptr;
+        const size_t softmax_out_id
+                = softmax->get_output_value(0)->get_logical_tensor().id;
+        for (const auto &op : part->get_ops()) {
+            if (op->get_kind() == graph::op_kind::MatMul
+                    && op->get_input_value(0)->get_logical_tensor().id
+                            == softmax_out_id)
+                mm_v = op.get();
+        }
+        if (!mm_v) return status::unimplemented;
+
+        const size_t n_ops = 3 + (scale_idx_ >= 0) + (mask_idx_ >= 0);
+        const bool ok_ops = part->get_ops().size() == n_ops
+                && mm_qk->num_inputs() == 2 && mm_v->num_inputs() == 2
+                && !get_bool(mm_qk, op_attr::transpose_a)
+                && !get_bool(mm_v, op_attr::transpose_a)
+                && !get_bool(mm_v, op_attr::transpose_b)
+                && outputs[0].id
+                        == mm_v->get_output_value(0)->get_logical_tensor().id;
+        if (!ok_ops) return status::unimplemented;
+        k_is_transposed_ = get_bool(mm_qk, op_attr::transpose_b);
+
+        const int q_idx = input_index(mm_qk->get_input_value(0));
+        const int k_idx = input_index(mm_qk->get_input_value(1));
+        const int v_idx = input_index(mm_v->get_input_value(1));
+        if (q_idx < 0 || k_idx < 0 || v_idx < 0) return status::unimplemented;
+        q_idx_ = static_cast<size_t>(q_idx);
+        k_idx_ = static_cast<size_t>(k_idx);
+        v_idx_ = static_cast<size_t>(v_idx);
+
+        const auto &q = inputs[q_idx_];
+        const auto &k = inputs[k_idx_];
+        const auto &v = inputs[v_idx_];
+        const int nd = q.ndims;
+        for (const auto *lt : {&q, &k, &v}) {
+            if (lt->data_type != graph::data_type::f32 || lt->ndims != nd
+                    || !is_dense(*lt))
+                return status::unimplemented;
+        }
+        if (nd < 2) return status::unimplemented;
+
+        int64_t axis = softmax->has_attr(op_attr::axis)
+                ? softmax->get_attr<int64_t>(op_attr::axis)
+                : 1;
+        if (axis < 0) axis += nd;
+        if (axis != nd - 1) return status::unimplemented;
+
+        sq_ = q.dims[nd - 2];
+        d_ = q.dims[nd - 1];
+        sk_ = k_is_transposed_ ? k.dims[nd - 2] : k.dims[nd - 1];
+        const dim_t k_d = k_is_transposed_ ? k.dims[nd - 1] : k.dims[nd - 2];
+        dv_ = v.dims[nd - 1];
+        if (k_d != d_ || v.dims[nd - 2] != sk_) return status::unimplemented;
+
+        batch_ = 1;
+        out_dims_.assign(q.dims, q.dims + nd);
+        out_dims_[nd - 1] = dv_;
+        for (int i = 0; i < nd - 2; i++) {
+            if (k.dims[i] != q.dims[i] || v.dims[i] != q.dims[i])
+                return status::unimplemented;
+            batch_ *= q.dims[i];
+        }
+        if (batch_ * sq_ * sk_ * d_ * dv_ == 0) return status::unimplemented;
+
+        const auto &dst = outputs[0];
+        const logical_tensor_wrapper_t dst_ltw(dst);
+        if (!dnnl::impl::utils::one_of(dst.data_type, graph::data_type::f32,
+                    graph::data_type::undef))
+            return status::unimplemented;
+        if (dst_ltw.is_strided() && !dst_ltw.is_shape_unknown()) {
+            if (dst_ltw.vdims() != out_dims_) return status::unimplemented;
+            if (!dst_ltw.is_stride_unknown() && !is_dense(dst))
+                return status::unimplemented;
+        } else if (!dst_ltw.is_any() && !dst_ltw.is_strided()) {
+            return status::unimplemented;
+        }
+
+        if (scale_idx_ >= 0) {
+            const logical_tensor_wrapper_t ltw(inputs[scale_idx_]);
+            if (ltw.data_type() != graph::data_type::f32
+                    || ltw.is_shape_unknown() || ltw.nelems() != 1)
+                return status::unimplemented;
+        }
+
+        if (mask_idx_ >= 0) {
+            const auto &mask = inputs[mask_idx_];
+            const int mnd = mask.ndims;
+            if (mask.data_type != graph::data_type::f32 || mnd > nd
+                    || !is_dense(mask))
+                return status::unimplemented;
+
+            std::vector<dim_t> full_dims = out_dims_;
+            full_dims[nd - 1] = sk_;
+            std::vector<dim_t> strides(nd, 0);
+            for (int i = 0; i < nd; i++) {
+                const int mi = i - (nd - mnd);
+                if (mi < 0 || mask.dims[mi] == 1) continue;
+                if (mask.dims[mi] != full_dims[i])
+                    return status::unimplemented;
+                strides[i] = mask.layout.strides[mi];
+            }
+            mask_stride_q_ = strides[nd - 2];
+            mask_stride_k_ = strides[nd - 1];
+
+            mask_batch_offsets_.assign(batch_, 0);
+            for (dim_t b = 0; b < batch_; b++) {
+                dim_t rem = b, off = 0;
+                for (int i = nd - 3; i >= 0; i--) {
+                    off += (rem % full_dims[i]) * strides[i];
+                    rem /= full_dims[i];
+                }
+                mask_batch_offsets_[b] = off;
+            }
+        }
+
+        bq_ = std::min(sq_, max_q_block_);
+        bk_ = std::min(sk_, max_k_block_);
+
+        return status::success;
+    }
+
+    status_t create_primitives(fpmath_mode_t fpmath_mode) {
+        using dims = dnnl::memory::dims;
+        using dt = dnnl::memory::data_type;
+
+        // A copy of dnnl::primitive_attr shares the underlying attributes, so
+        // the two attributes are created separately.
+        dnnl::primitive_attr qk_attr, pv_attr;
+        for (auto *attr : {&qk_attr, &pv_attr}) {
+            attr->set_scratchpad_mode(dnnl::scratchpad_mode::user);
+            attr->set_fpmath_mode(static_cast<dnnl::fpmath_mode>(fpmath_mode));
+        }
+
+        // The second product accumulates into the rescaled output tile.
+        dnnl::post_ops pv_ops;
+        pv_ops.append_sum(1.f);
+        pv_attr.set_post_ops(pv_ops);
+
+        const dim_t q_tail = sq_ % bq_, k_tail = sk_ % bk_;
+        const dims k_strides = k_is_transposed_ ? dims {1, d_} : dims {sk_, 1};
+        for (int qt = 0; qt < 2; qt++) {
+            const dim_t mq = qt ? q_tail : bq_;
+            if (mq == 0) continue;
+            q_md_[qt] = {{mq, d_}, dt::f32, dims {d_, 1}};
+            o_md_[qt] = {{mq, dv_}, dt::f32, dims {dv_, 1}};
+            for (int kt = 0; kt < 2; kt++) {
+                const dim_t nk = kt ? k_tail : bk_;
+                if (nk == 0) continue;
+                if (qt == 0) {
+                    k_md_[kt] = {{d_, nk}, dt::f32, k_strides};
+                    v_md_[kt] = {{nk, dv_}, dt::f32, dims {dv_, 1}};
+                }
+                s_md_[qt][kt] = {{mq, nk}, dt::f32, dims {bk_, 1}};
+
+                auto qk_pd = dnnl::matmul::primitive_desc(p_engine_,
+                        q_md_[qt], k_md_[kt], s_md_[qt][kt], qk_attr);
+                auto pv_pd = dnnl::matmul::primitive_desc(p_engine_,
+                        s_md_[qt][kt], v_md_[kt], o_md_[qt], pv_attr);
+                prim_scratchpad_size_ = std::max({prim_scratchpad_size_,
+                        qk_pd.scratchpad_desc().get_size(),
+                        pv_pd.scratchpad_desc().get_size()});
+                qk_prim_[qt][kt] = dnnl::matmul(qk_pd);
+                pv_prim_[qt][kt] = dnnl::matmul(pv_pd);
+            }
+        }
+        // Keep the scratchpad argument non-empty even if no primitive needs it.
+        prim_scratchpad_size_ = std::max(prim_scratchpad_size_, size_t(1));
+        return status::success;
+    }
+
+    // Per-thread workspace: the score tile, the running row maxima and sums,
+    // and the scratchpad shared by the tile primitives.
+    size_t tile_size() const {
+        return dnnl::impl::utils::rnd_up(sizeof(float) * bq_ * (bk_ + 2), 64);
+    }
+
+    size_t ws_size_per_thr() const {
+        return tile_size()
+                + dnnl::impl::utils::rnd_up(prim_scratchpad_size_, 64);
+    }
+
+    // Online softmax over one score tile. On return, the tile holds the
+    // unnormalized probabilities relative to the updated row maxima, and the
+    // output rows are rescaled to the same maxima.
+    void update_tile(float *s, float *row_max, float *row_sum, float *o,
+            const float *mask, dim_t mq, dim_t nk, float scale) const {
+        const float neg_inf = -std::numeric_limits<float>::infinity();
+        for (dim_t i = 0; i < mq; i++) {
+            float *srow = s + i * bk_;
+            const float *mrow = mask ? mask + i * mask_stride_q_ : nullptr;
+            float mx = row_max[i];
+            for (dim_t j = 0; j < nk; j++) {
+                float val = srow[j] * scale;
+                if (mrow) val += mrow[j * mask_stride_k_];
+                srow[j] = val;
+                mx = std::max(mx, val);
+            }
+            if (mx == neg_inf) {
+                // All keys seen so far are masked out.
+                std::fill(srow, srow + nk, 0.f);
+                continue;
+            }
+            const float corr = std::exp(row_max[i] - mx);
+            float sum = 0.f;
+            for (dim_t j = 0; j < nk; j++) {
+                srow[j] = std::exp(srow[j] - mx);
+                sum += srow[j];
+            }
+            row_sum[i] = row_sum[i] * corr + sum;
+            row_max[i] = mx;
+            if (corr != 1.f) {
+                float *orow = o + i * dv_;
+                for (dim_t j = 0; j < dv_; j++)
+                    orow[j] *= corr;
+            }
+        }
+    }
+
+public:
+    status_t compile_impl(const dnnl_partition_impl_t *part,
+            const engine_t *g_engine,
+            const std::vector<logical_tensor_t> &inputs,
+            const std::vector<logical_tensor_t> &outputs) override {
+        p_engine_ = make_dnnl_engine(*g_engine);
+        g_alloc_ = reinterpret_cast<graph::allocator_t *>(
+                g_engine->get_allocator());
+
+        status_t ret = init_conf(part, inputs, outputs);
+        if (ret == status::success) {
+            try {
+                ret = create_primitives(part->get_fpmath_mode());
+            } catch (dnnl::error &e) {
+                ret = static_cast<status_t>(e.status);
+            }
+        }
+        if (ret != status::success) {
+            fallback_ = std::make_shared<larger_partition_kernel_t>();
+            ret = fallback_->compile(part, g_engine, inputs, outputs);
+            inplace_pairs_ = fallback_->inplace_pairs_;
+            return ret;
+        }
+
+        // The output is a dense f32 tensor.
+        auto &out = const_cast<logical_tensor_t &>(outputs[0]);
+        const int nd = static_cast<int>(out_dims_.size());
+        out.ndims = nd;
+        out.data_type = graph::data_type::f32;
+        out.layout_type = graph::layout_type::strided;
+        dim_t stride = 1;
+        for (int i = nd - 1; i >= 0; i--) {
+            out.dims[i] = out_dims_[i];
+            out.layout.strides[i] = stride;
+            stride *= out_dims_[i];
+        }
+
+        return status::success;
+    }
+
+    size_t get_scratchpad_size() const override {
+        if (fallback_) return fallback_->get_scratchpad_size();
+        return ws_size_per_thr() * dnnl_get_max_threads();
+    }
+
+    // The fused implementation has no folded constants.
+    status_t get_constant_blob(size_t *size, uint8_t *blob) const override {
+        if (fallback_) return fallback_->get_constant_blob(size, blob);
+        return status::unimplemented;
+    }
+
+    status_t set_constant_blob(size_t size, const uint8_t *blob) override {
+        if (fallback_) return fallback_->set_constant_blob(size, blob);
+        return status::unimplemented;
+    }
+
+    status_t execute_impl(const stream_t *g_stream,
+            const std::vector<tensor_t> &inputs,
+            const std::vector<tensor_t> &outputs) override {
+        if (fallback_) return fallback_->execute(g_stream, inputs, outputs);
+
+        dnnl::stream p_stream = make_dnnl_stream(p_engine_, *g_stream);
+
+        const auto *q = static_cast<const float *>(
+                inputs[q_idx_].get_data_handle());
+        const auto *k = static_cast<const float *>(
+                inputs[k_idx_].get_data_handle());
+        const auto *v = static_cast<const float *>(
+                inputs[v_idx_].get_data_handle());
+        const auto *mask = mask_idx_ >= 0
+                ? static_cast<const float *>(
+                        inputs[mask_idx_].get_data_handle())
+                : nullptr;
+        auto *dst = static_cast<float *>(outputs[0].get_data_handle());
+
+        float scale = 1.f;
+        if (scale_idx_ >= 0) {
+            scale = *static_cast<const float *>(
+                    inputs[scale_idx_].get_data_handle());
+            if (scale_is_div_) scale = 1.f / scale;
+        }
+
+        const int nthr = dnnl_get_max_threads();
+        const size_t ws_size = ws_size_per_thr();
+        temporary_scratchpad_t scratchpad(
+                ws_size * nthr, p_engine_, *g_alloc_);
+        if (scratchpad.size() < ws_size * nthr) return status::out_of_memory;
+        char *ws_base = scratchpad.get_buffer();
+
+        const dim_t nq_blocks = dnnl::impl::utils::div_up(sq_, bq_);
+        const dim_t work_amount = batch_ * nq_blocks;
+        const float neg_inf = -std::numeric_limits<float>::infinity();
+
+        // The matmul primitives are executed inside the parallel region, each
+        // thread working on its own blocks. Nested parallelism is not used
+        // by the library: with OpenMP and threadpool the primitives detect
+        // the parallel region and run on the calling thread only, so the
+        // threads are split across the blocks rather than inside a block.
+        // With TBB the nested parallel_for of a primitive may be shared with
+        // the idle workers of the arena, which is safe since the primitives
+        // use the user scratchpad taken from the workspace of the calling
+        // thread, and a stolen block uses the workspace of its own ithr.
+        parallel(nthr, [&](const int ithr, const int nthr_) {
+            dim_t start = 0, end = 0;
+            balance211(work_amount, nthr_, ithr, start, end);
+            if (start >= end) return;
+
+            char *ws = ws_base + ithr * ws_size;
+            float *s = reinterpret_cast<float *>(ws);
+            float *row_max = s + bq_ * bk_;
+            float *row_sum = row_max + bq_;
+
+            // Memory objects are created once per thread and re-pointed at
+            // the current blocks.
+            dnnl::memory q_m[2], k_m[2], s_m[2][2], v_m[2], o_m[2];
+            for (int t = 0; t < 2; t++) {
+                if (!q_md_[t].is_zero()) {
+                    q_m[t] = dnnl::memory(
+                            q_md_[t], p_engine_, DNNL_MEMORY_NONE);
+                    o_m[t] = dnnl::memory(
+                            o_md_[t], p_engine_, DNNL_MEMORY_NONE);
+                }
+                if (!k_md_[t].is_zero()) {
+                    k_m[t] = dnnl::memory(
+                            k_md_[t], p_engine_, DNNL_MEMORY_NONE);
+                    v_m[t] = dnnl::memory(
+                            v_md_[t], p_engine_, DNNL_MEMORY_NONE);
+                }
+                for (int kt = 0; kt < 2; kt++)
+                    if (!s_md_[t][kt].is_zero())
+                        s_m[t][kt] = dnnl::memory(s_md_[t][kt], p_engine_, s);
+            }
+            dnnl::memory ws_m(
+                    dnnl::memory::desc(
+                            {static_cast<dim_t>(prim_scratchpad_size_)},
+                            dnnl::memory::data_type::u8,
+                            dnnl::memory::format_tag::a),
+                    p_engine_, ws + tile_size());
+
+            for (dim_t w = start; w < end; w++) {
+                const dim_t b = w / nq_blocks;
+                const dim_t q0 = (w % nq_blocks) * bq_;
+                const dim_t mq = std::min(bq_, sq_ - q0);
+                const int qt = mq != bq_;
+
+                float *o = dst + (b * sq_ + q0) * dv_;
+                std::fill(o, o + mq * dv_, 0.f);
+                std::fill(row_max, row_max + mq, neg_inf);
+                std::fill(row_sum, row_sum + mq, 0.f);
+                q_m[qt].set_data_handle(
+                        const_cast<float *>(q + (b * sq_ + q0) * d_));
+                o_m[qt].set_data_handle(o);
+
+                for (dim_t k0 = 0; k0 < sk_; k0 += bk_) {
+                    const dim_t nk = std::min(bk_, sk_ - k0);
+                    const int kt = nk != bk_;
+
+                    const float *k_blk = k_is_transposed_
+                            ? k + (b * sk_ + k0) * d_
+                            : k + b * d_ * sk_ + k0;
+                    k_m[kt].set_data_handle(const_cast<float *>(k_blk));
+                    v_m[kt].set_data_handle(
+                            const_cast<float *>(v + (b * sk_ + k0) * dv_));
+
+                    qk_prim_[qt][kt].execute(p_stream,
+                            {{DNNL_ARG_SRC, q_m[qt]},
+                                    {DNNL_ARG_WEIGHTS, k_m[kt]},
+                                    {DNNL_ARG_DST, s_m[qt][kt]},
+                                    {DNNL_ARG_SCRATCHPAD, ws_m}});
+
+                    const float *mask_blk = mask
+                            ? mask + mask_batch_offsets_[b]
+                                    + q0 * mask_stride_q_ + k0 * mask_stride_k_
+                            : nullptr;
+                    update_tile(
+                            s, row_max, row_sum, o, mask_blk, mq, nk, scale);
+
+                    pv_prim_[qt][kt].execute(p_stream,
+                            {{DNNL_ARG_SRC, s_m[qt][kt]},
+                                    {DNNL_ARG_WEIGHTS, v_m[kt]},
+                                    {DNNL_ARG_DST, o_m[qt]},
+                                    {DNNL_ARG_SCRATCHPAD, ws_m}});
+                }
+
+                for (dim_t i = 0; i < mq; i++) {
+                    const float inv_sum = 1.f / row_sum[i];
+                    float *orow = o + i * dv_;
+                    for (dim_t j = 0; j < dv_; j++)
+                        orow[j] *= inv_sum;
+                }
+            }
+        });
+
+        return status::success;
+    }
+
+#ifdef DNNL_WITH_SYCL
+    status_t sycl_execute_impl(const stream_t *g_stream,
+            const std::vector<tensor_t> &inputs,
+            const std::vector<tensor_t> &outputs,
+            const std::vector<::sycl::event> &sycl_deps,
+            ::sycl::event *sycl_event) override {
+        // The fused path is disabled for SYCL, see init_conf().
+        return fallback_->execute_sycl(
+                g_stream, inputs, outputs, sycl_deps, sycl_event);
+    }
+#endif
+};
+
+} // namespace dnnl_impl
+} // namespace graph
+} // namespace impl
+} // namespace dnnl
+
+#endif
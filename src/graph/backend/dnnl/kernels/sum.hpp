@@ -52,12 +52,7 @@ namespace dnnl_impl {
 
 struct sum_t : public kernel_base_t {
 private:
-    // primitive engine
-    dnnl::engine p_engine_;
-    allocator_t *g_alloc_;
-
     std::shared_ptr<subgraph_t> subgraph_;
-    memory_planner_t memory_planner_;
 
     // function to create execution arguments for primitive
     std::function<std::shared_ptr<execution_args_set_t>()> resource_ctor_;
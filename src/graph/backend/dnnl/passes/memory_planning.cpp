@@ -15,12 +15,17 @@
  *******************************************************************************/
 
 #include <algorithm>
+#include <limits>
 #include <memory>
 #include <set>
+#include <thread>
 #include <vector>
 #include <unordered_map>
 #include <unordered_set>
 
+#include "common/primitive_hashing.hpp"
+#include "common/utils.hpp"
+
 #include "graph/interface/c_types_map.hpp"
 #include "graph/interface/value.hpp"
 
@@ -438,6 +443,59 @@ status_t memory_planner_t::assign_internal_persistent_buffer(
     return status::success;
 }
 
+size_t arena_planner_t::run() {
+    std::vector<block_t *> order;
+    order.reserve(blocks_.size());
+    for (auto &b : blocks_)
+        order.emplace_back(&b);
+    std::stable_sort(order.begin(), order.end(),
+            [](const block_t *a, const block_t *b) {
+                if (a->size_ != b->size_) return a->size_ > b->size_;
+                return a->start_ < b->start_;
+            });
+
+    size_ = 0;
+    std::vector<const block_t *> placed, alive;
+    for (block_t *b : order) {
+        // the placed blocks which are alive at the same time with this one
+        alive.clear();
+        for (const block_t *p : placed) {
+            if (p->start_ <= b->end_ && b->start_ <= p->end_)
+                alive.emplace_back(p);
+        }
+        std::sort(alive.begin(), alive.end(),
+                [](const block_t *x, const block_t *y) {
+                    return x->offset_ < y->offset_;
+                });
+
+        size_t top = 0, best_offset = 0;
+        size_t best_gap = std::numeric_limits<size_t>::max();
+        for (const block_t *p : alive) {
+            if (p->offset_ >= top + b->size_ && p->offset_ - top < best_gap) {
+                best_gap = p->offset_ - top;
+                best_offset = top;
+            }
+            top = std::max(top,
+                    dnnl::impl::utils::rnd_up(
+                            p->offset_ + p->size_, alignment_));
+        }
+        b->offset_ = best_gap == std::numeric_limits<size_t>::max()
+                ? top
+                : best_offset;
+        size_ = std::max(size_, b->offset_ + b->size_);
+        placed.emplace_back(b);
+    }
+    return size_;
+}
+
+size_t arena_planner_t::get_offset(size_t id) const {
+    for (const auto &b : blocks_) {
+        if (b.id_ == id) return b.offset_;
+    }
+    assertm(false, "the buffer is not added");
+    return 0;
+}
+
 // Assign internal non constant edges (such as src reorder output in conv
 // pattern) to temporary buffer. Those temporary buffer will be dynamically
 // allocated/freed during execution. In order to reduce memory footprint, we
@@ -454,8 +512,10 @@ status_t memory_planner_t::assign_internal_temporary_buffer(
         const std::unordered_map<value_t *, size_t> &edge_ref_count,
         fusion_info_mgr_t &mgr, bool enable_standard_sharing) {
     std::unordered_map<size_t, size_t> temporary_buffer_ref_count;
+    // the position of current op in the execution order
+    size_t time_point = 0;
 
-    auto func = [&](op_t *op) {
+    auto assign_outputs = [&](op_t *op) {
         // Handle alias first
         auto inputs = op->get_input_values();
         for (auto &in : inputs) {
@@ -502,8 +562,12 @@ status_t memory_planner_t::assign_internal_temporary_buffer(
             buffer_assignments_.insert(std::make_pair(
                     out.get(), assign_info_t(internal_temporary, idx)));
             temporary_buffer_ref_count[idx] = edge_ref_count.at(out.get());
+            temporary_buffers_live_range_[idx] = time_bound_t {
+                    time_point, std::numeric_limits<size_t>::max()};
         }
+    };
 
+    auto free_values = [&](op_t *op) {
         // Free inputs
         for (auto &in : op->get_input_values()) {
             assign_info_t info = buffer_assignments_.at(in.get());
@@ -511,9 +575,10 @@ status_t memory_planner_t::assign_internal_temporary_buffer(
 
             --temporary_buffer_ref_count[info.index_];
             // if we decrease it to zero, we are ready to release
-            if (enable_standard_sharing
-                    && temporary_buffer_ref_count[info.index_] == 0) {
-                temporary_buffer_assigner_.release(info.index_);
+            if (temporary_buffer_ref_count[info.index_] == 0) {
+                temporary_buffers_live_range_[info.index_].end_ = time_point;
+                if (enable_standard_sharing)
+                    temporary_buffer_assigner_.release(info.index_);
             }
         }
 
@@ -525,20 +590,51 @@ status_t memory_planner_t::assign_internal_temporary_buffer(
             auto consumers = out->get_consumers();
             if (consumers.empty()) {
                 --temporary_buffer_ref_count[info.index_];
+                temporary_buffers_live_range_[info.index_].end_ = time_point;
                 if (enable_standard_sharing) {
                     temporary_buffer_assigner_.release(info.index_);
                 }
             }
         }
+    };
+
+    if (!is_parallel_ops_enabled(*sg->p_engine_)) {
+        return topo_order_visit(sg->get_output_ops(), [&](op_t *op) {
+            assign_outputs(op);
+            free_values(op);
+            time_point++;
+            return status::success;
+        });
+    }
 
+    // Ops on the same level may be executed concurrently, so the buffers used
+    // by them can't be freed (or reused inplace) until all ops on this level
+    // have got their outputs.
+    std::vector<op_t *> ops;
+    status_t ret = topo_order_visit(sg->get_output_ops(), [&](op_t *op) {
+        ops.emplace_back(op);
         return status::success;
-    };
+    });
+    if (ret != status::success) return ret;
 
-    return topo_order_visit(sg->get_output_ops(), func);
+    const auto levels = get_op_levels(sg);
+    std::stable_sort(ops.begin(), ops.end(), [&](op_t *a, op_t *b) {
+        return levels.at(a) < levels.at(b);
+    });
+    for (size_t i = 0; i < ops.size();) {
+        size_t end = i;
+        time_point = levels.at(ops[i]);
+        while (end < ops.size() && levels.at(ops[end]) == levels.at(ops[i]))
+            assign_outputs(ops[end++]);
+        for (; i < end; i++)
+            free_values(ops[i]);
+    }
+    return status::success;
 }
 
 status_t memory_planner_t::prepare_subgraph_inplace_pairs(
         std::shared_ptr<subgraph_t> &sg, bool enable_standard_sharing) {
+    const bool parallel_ops = is_parallel_ops_enabled(*sg->p_engine_);
     size_t time_point = 0;
     status_t ret;
     ret = topo_order_visit(sg->get_output_ops(), [&](op_t *cur_op) {
@@ -559,6 +655,9 @@ status_t memory_planner_t::prepare_subgraph_inplace_pairs(
                 auto in_val = cur_op->get_input_value(pair.in_idx_);
                 auto in_buf = buffer_assignments_.at(in_val.get());
                 if (in_buf.kind_ != external_input) continue;
+                // other consumers may read the input at the same time
+                if (parallel_ops && in_val->get_consumers().size() > 1)
+                    continue;
 
                 in_lt = sg->ins_[in_buf.index_];
                 inplace_shared = true;
@@ -649,6 +748,31 @@ status_t memory_planner_t::book_buffers(std::shared_ptr<subgraph_t> &sg) {
 
     registrar_t temporary_registrar = temporary_registry_.registrar();
     registrar_t persistent_registrar = persistent_registry_.registrar();
+
+    // Temporary buffers are packed into one arena by their live ranges, and
+    // booked at the planned offsets
+    if (enable_arena_planning_) {
+        std::set<size_t> temporary_buffers;
+        for (const value_t *val : to_be_booked) {
+            const assign_info_t &info = buffer_assignments_.at(val);
+            if (info.kind_ == internal_temporary)
+                temporary_buffers.insert(info.index_);
+        }
+
+        const size_t alignment = 64;
+        arena_planner_t arena(alignment);
+        for (size_t idx : temporary_buffers) {
+            const time_bound_t &range = temporary_buffers_live_range_.at(idx);
+            arena.add(idx, temporary_buffer_assigner_.query_size(idx),
+                    range.start_, range.end_);
+        }
+        arena.run();
+        for (size_t idx : temporary_buffers) {
+            temporary_registrar.book_at(idx, arena.get_offset(idx),
+                    temporary_buffer_assigner_.query_size(idx), alignment);
+        }
+    }
+
     for (const value_t *val : to_be_booked) {
         const assign_info_t &info = buffer_assignments_.at(val);
         switch (info.kind_) {
@@ -658,6 +782,7 @@ status_t memory_planner_t::book_buffers(std::shared_ptr<subgraph_t> &sg) {
             case external_output: break;
             // book buffers for internal temporary and persistent
             case internal_temporary:
+                if (enable_arena_planning_) break;
                 temporary_registrar.book(info.index_,
                         temporary_buffer_assigner_.query_size(info.index_));
                 break;
@@ -814,6 +939,14 @@ status_t memory_planner_t::run(std::shared_ptr<subgraph_t> &sg) {
         }
     }
 
+    // By default, temporary buffers are packed into one arena by their live
+    // ranges. The internal env var can switch back to the greedy buffer
+    // sharing to compare the memory footprint. It's for debugging purpose
+    // only and may be removed without any prior notice.
+    enable_arena_planning_ = enable_memory_sharing
+            && graph::utils::getenv_int_internal("ENABLE_ARENA_PLANNING", 1)
+                    > 0;
+
     // Assign external_input buffers to subgraph's inputs and their alias
     ret = assign_external_inputs_buffer(sg, inputs);
     if (ret != status::success) return ret;
@@ -833,6 +966,7 @@ status_t memory_planner_t::run(std::shared_ptr<subgraph_t> &sg) {
 
     // Reset the unreplaced internal temporary buffer
     temporary_buffer_assigner_.clear();
+    temporary_buffers_live_range_.clear();
     for (auto it = buffer_assignments_.begin();
             it != buffer_assignments_.end();) {
         if (it->second.kind_ == internal_temporary) {
@@ -843,8 +977,10 @@ status_t memory_planner_t::run(std::shared_ptr<subgraph_t> &sg) {
     }
 
     // Re-assign internal temporary buffer for reset ones (will re-do memory
-    // sharing between temporary buffers)
-    ret = assign_internal_temporary_buffer(sg, edge_ref_count, mgr, true);
+    // sharing between temporary buffers). With arena planning, each buffer is
+    // kept separate here and the sharing is done by packing them at booking.
+    ret = assign_internal_temporary_buffer(
+            sg, edge_ref_count, mgr, !enable_arena_planning_);
     if (ret != status::success) return ret;
 
     // Check which input/output pair of the subgraph can be inplaced
@@ -861,6 +997,21 @@ status_t memory_planner_t::run(std::shared_ptr<subgraph_t> &sg) {
     return status::success;
 }
 
+size_t memory_planner_t::internal_persistent_layout_hash() const {
+    using dnnl::impl::hash_combine;
+    size_t seed = 0;
+    seed = hash_combine(seed, persistent_registry_.size());
+    seed = hash_combine(seed, persistent_registry_.lcm_alignment());
+    for (const auto &mem_offkey :
+            exec_args_set_.get_mems_use_internal_persistent()) {
+        seed = hash_combine(seed, persistent_registry_.get(mem_offkey.second));
+        seed = hash_combine(seed,
+                primitive_hashing::get_md_hash(
+                        *mem_offkey.first.get_desc().get()));
+    }
+    return seed;
+}
+
 } // namespace dnnl_impl
 } // namespace graph
 } // namespace impl
@@ -262,6 +262,47 @@ private:
     std::vector<std::unique_ptr<buffer_info_t>> data_;
 };
 
+// The arena_planner_t class packs buffers with known live ranges into a single
+// arena by assigning an offset to each of them. Buffers whose live ranges
+// overlap get disjoint pieces of the arena. The buffers are placed from the
+// largest to the smallest one. Each buffer goes to the smallest gap between the
+// placed buffers that are alive at the same time (best-fit), or on top of them
+// if no gap is large enough.
+class arena_planner_t {
+public:
+    explicit arena_planner_t(size_t alignment) : alignment_(alignment) {}
+
+    // add a buffer which is alive in the time range [start, end]
+    void add(size_t id, size_t size, size_t start, size_t end) {
+        blocks_.push_back({id, size, start, end, 0});
+    }
+
+    // assign offsets to all added buffers and return the arena size
+    size_t run();
+
+    size_t get_offset(size_t id) const;
+
+    size_t size() const { return size_; }
+
+    void clear() {
+        blocks_.clear();
+        size_ = 0;
+    }
+
+private:
+    struct block_t {
+        size_t id_;
+        size_t size_;
+        size_t start_;
+        size_t end_;
+        size_t offset_;
+    };
+
+    size_t alignment_;
+    std::vector<block_t> blocks_;
+    size_t size_ {0};
+};
+
 // This memory_planner_t class is used to plan which buffer can be used by each
 // value in the subgraph. All the planning works are completed in compilation
 // stage for static shape cases.
@@ -286,6 +327,14 @@ private:
 // - _ONEDNN_GRAPH_ENABLE_MEM_REUSE
 //     - 0: Disable memory sharing
 //     - 1 (default): Enable memory sharing
+// - _ONEDNN_GRAPH_ENABLE_PARALLEL_OPS
+//     - 0 (default): Ops are executed one by one in topological order
+//     - 1: Ops on the same level may be executed concurrently, so values used
+//       by them never share buffers. See is_parallel_ops_enabled().
+// - _ONEDNN_GRAPH_ENABLE_ARENA_PLANNING
+//     - 0: Share temporary buffers greedily with the buffer_assigner_t
+//     - 1 (default): Pack temporary buffers into one arena by their live
+//       ranges with the arena_planner_t
 class memory_planner_t {
 public:
     memory_planner_t()
@@ -312,6 +361,17 @@ public:
         return temporary_registry_.size();
     }
 
+    // The alignment of the base address of the internal persistent buffer.
+    // The grantor aligns the given base pointer to it.
+    size_t internal_persistent_alignment() const {
+        return persistent_registry_.lcm_alignment();
+    }
+
+    // A hash of the offsets and the memory descriptors of the internal
+    // persistent buffers. Kernels with the same hash lay out their folded
+    // constants in the same way.
+    size_t internal_persistent_layout_hash() const;
+
     execution_args_set_t &get_exec_args_set() { return exec_args_set_; }
 
     status_t run(std::shared_ptr<subgraph_t> &sg);
@@ -384,6 +444,7 @@ private:
         persistent_registry_.clear();
         temporary_registry_.clear();
         external_inputs_live_range_.clear();
+        temporary_buffers_live_range_.clear();
         inplace_pairs_.clear();
     }
 
@@ -421,7 +482,10 @@ private:
     alias_analyzer_t alias_analyzer_;
     std::unordered_map<const assign_info_t *, time_bound_t>
             external_inputs_live_range_;
+    // temporary buffer index -> live range in the execution order
+    std::unordered_map<size_t, time_bound_t> temporary_buffers_live_range_;
     std::vector<inplace_pair_t> inplace_pairs_;
+    bool enable_arena_planning_ = false;
 };
 
 } // namespace dnnl_impl
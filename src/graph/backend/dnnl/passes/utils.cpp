@@ -15,6 +15,7 @@
  *******************************************************************************/
 
 #include <algorithm>
+#include <atomic>
 #include <chrono>
 #include <fstream>
 #include <limits>
@@ -26,6 +27,8 @@
 #include <unordered_map>
 #include <unordered_set>
 
+#include "common/dnnl_thread.hpp"
+
 #include "graph/interface/shape_infer.hpp"
 #include "graph/interface/value.hpp"
 #include "graph/utils/debug.hpp"
@@ -590,6 +593,43 @@ bool is_layout_reorder(const op_t *op) {
     return is_layout_reorder;
 }
 
+namespace {
+std::atomic<bool> &parallel_ops_enabled() {
+    static std::atomic<bool> enabled(
+            graph::utils::getenv_int_internal("ENABLE_PARALLEL_OPS", 0) > 0);
+    return enabled;
+}
+} // namespace
+
+bool is_parallel_ops_enabled(const dnnl::engine &p_engine) {
+    return parallel_ops_enabled().load()
+            && p_engine.get_kind() == dnnl::engine::kind::cpu;
+}
+
+void set_parallel_ops_enabled(bool enabled) {
+    parallel_ops_enabled().store(enabled);
+}
+
+std::unordered_map<op_t *, size_t> get_op_levels(
+        std::shared_ptr<subgraph_t> &sg) {
+    std::unordered_map<op_t *, size_t> levels;
+    topo_order_visit(sg->get_output_ops(), [&](op_t *op) {
+        size_t level = 0;
+        const bool is_constant = op->has_attr(op_attr::is_constant)
+                && op->get_attr<bool>(op_attr::is_constant);
+        if (!is_constant) {
+            level = 1;
+            for (const auto &in : op->get_input_values()) {
+                if (!in->has_producer()) continue;
+                level = std::max(level, levels.at(&in->get_producer()) + 1);
+            }
+        }
+        levels[op] = level;
+        return status::success;
+    });
+    return levels;
+}
+
 } // namespace dnnl_impl
 } // namespace graph
 } // namespace impl
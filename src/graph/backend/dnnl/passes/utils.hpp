@@ -341,6 +341,21 @@ bool with_runtime_zps(const std::shared_ptr<op_t> &op,
 // which is not for TypeCast or Quantization.
 bool is_layout_reorder(const op_t *op);
 
+// Check if independent ops of a subgraph on the given engine can be executed
+// concurrently. It requires a CPU engine. The feature is experimental and is
+// enabled with the internal env var _ONEDNN_GRAPH_ENABLE_PARALLEL_OPS=1.
+bool is_parallel_ops_enabled(const dnnl::engine &p_engine);
+
+// Overrides the value of _ONEDNN_GRAPH_ENABLE_PARALLEL_OPS for the subgraphs
+// compiled afterwards. Used for testing.
+void set_parallel_ops_enabled(bool enabled);
+
+// Get the level of each op in the subgraph. Constant ops are on level 0. Other
+// ops are one level above their highest non-constant producer, so ops on the
+// same level never depend on each other.
+std::unordered_map<op_t *, size_t> get_op_levels(
+        std::shared_ptr<subgraph_t> &sg);
+
 } // namespace dnnl_impl
 } // namespace graph
 } // namespace impl
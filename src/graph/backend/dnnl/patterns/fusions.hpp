@@ -45,6 +45,7 @@ DNNL_BACKEND_REGISTER_PATTERN_DECLARE(softmax_fusion)
 DNNL_BACKEND_REGISTER_PATTERN_DECLARE(layernorm_fusion)
 DNNL_BACKEND_REGISTER_PATTERN_DECLARE(sum_fusion)
 DNNL_BACKEND_REGISTER_PATTERN_DECLARE(concat_fusion)
+DNNL_BACKEND_REGISTER_PATTERN_DECLARE(sdp_fusion)
 
 #undef DNNL_BACKEND_REGISTER_PATTERN_DECLARE
 
@@ -0,0 +1,106 @@
+/*******************************************************************************
+* Copyright 2024 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "graph/backend/dnnl/kernels/sdp.hpp"
+#include "graph/backend/dnnl/patterns/fusions.hpp"
+#include "graph/backend/dnnl/patterns/transformation_pattern.hpp"
+#include "graph/backend/dnnl/patterns/utils.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace graph {
+namespace dnnl_impl {
+namespace pattern {
+
+namespace pm = graph::utils::pm;
+using in_edges_t = pm::in_edges_t;
+using pb_graph_t = pm::pb_graph_t;
+using FCreatePattern = graph::pass::FCreatePattern;
+
+DNNL_BACKEND_REGISTER_PATTERN_DEF_BEGIN(sdp_fusion)
+
+/*
+    [Query]    [Key]
+         \     /
+         MatMul  [Scale]*
+            \   /
+    Divide|Multiply*  [Attention mask]*
+                \    /
+                 Add*
+                  |
+               SoftMax   [Value]
+                    \     /
+                     MatMul
+                       |
+                    [output]
+
+    The scale and the mask are optional. The pattern has a lower priority
+    than the MHA patterns in matmul_fusion.cpp, which also take the output
+    transpose and reshape.
+*/
+DNNL_BACKEND_REGISTER_TRANSFORMATION_PATTERN(dnnl, float_sdp_fusion)
+        .set_priority(20.0f)
+        .set_engine_kind(engine_kind::cpu)
+        .set_kind(partition_kind_t::mha)
+        .set_attr<FCreatePattern>("FCreatePattern",
+                [](const std::shared_ptr<pb_graph_t> &pgraph) -> void {
+                    auto matmul_qk = pgraph->append_op(
+                            graph::op_kind::MatMul, "matmul_qk");
+                    matmul_qk->append_decision_function(
+                            check_input_dtype<graph::data_type::f32>);
+                    matmul_qk->append_decision_function(check_input_num<2>);
+
+                    auto pscale_graph
+                            = std::make_shared<pb_graph_t>("pscale_graph");
+                    auto pscale = pscale_graph->append_alternation(
+                            {graph::op_kind::Divide, graph::op_kind::Multiply},
+                            "pscale");
+                    pscale_graph->create_input_port(0, pscale, 0);
+                    pscale_graph->create_output_port(0, pscale, 0);
+                    auto optional_scale = pgraph->append_optional(pscale_graph,
+                            in_edges_t {in_edge(0, matmul_qk, 0)},
+                            "optional_scale");
+
+                    auto pmask_graph
+                            = std::make_shared<pb_graph_t>("pmask_graph");
+                    auto pmask = pmask_graph->append_op(
+                            graph::op_kind::Add, "pmask");
+                    pmask_graph->create_input_port(0, pmask, 0);
+                    pmask_graph->create_output_port(0, pmask, 0);
+                    auto optional_mask = pgraph->append_optional(pmask_graph,
+                            in_edges_t {in_edge(0, optional_scale, 0)},
+                            "optional_mask");
+
+                    auto softmax = pgraph->append_op(graph::op_kind::SoftMax,
+                            in_edges_t {in_edge(0, optional_mask, 0)},
+                            "softmax");
+                    auto matmul_v = pgraph->append_op(graph::op_kind::MatMul,
+                            in_edges_t {in_edge(0, softmax, 0)}, "matmul_v");
+                    matmul_v->append_decision_function(
+                            check_input_dtype<graph::data_type::f32>);
+                    matmul_v->append_decision_function(check_input_num<2>);
+                })
+        .set_attr<FCreateKernel>("FCreateKernel", []() -> kernel_ptr {
+            return std::make_shared<sdp_t>();
+        });
+
+DNNL_BACKEND_REGISTER_PATTERN_DEF_END
+
+} // namespace pattern
+} // namespace dnnl_impl
+} // namespace graph
+} // namespace impl
+} // namespace dnnl
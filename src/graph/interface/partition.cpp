@@ -464,6 +464,33 @@ status_t DNNL_API dnnl_graph_compiled_partition_get_inplace_ports(
     return status::success;
 }
 
+status_t DNNL_API dnnl_graph_compiled_partition_get_scratchpad_size(
+        const compiled_partition_t *compiled_partition, size_t *size) {
+    if (utils::any_null(compiled_partition, size))
+        return status::invalid_arguments;
+
+    *size = compiled_partition->get_scratchpad_size();
+    return status::success;
+}
+
+status_t DNNL_API dnnl_graph_compiled_partition_get_constant_blob(
+        const compiled_partition_t *compiled_partition, size_t *size,
+        uint8_t *blob) {
+    if (utils::any_null(compiled_partition, size))
+        return status::invalid_arguments;
+
+    return compiled_partition->get_constant_blob(size, blob);
+}
+
+status_t DNNL_API dnnl_graph_compiled_partition_set_constant_blob(
+        compiled_partition_t *compiled_partition, size_t size,
+        const uint8_t *blob) {
+    if (utils::any_null(compiled_partition, blob))
+        return status::invalid_arguments;
+
+    return compiled_partition->set_constant_blob(size, blob);
+}
+
 status_t dnnl_graph_partition::infer_shape(
         std::vector<const logical_tensor_t *> &inputs,
         std::vector<logical_tensor_t *> &outputs) {
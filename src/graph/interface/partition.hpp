@@ -164,6 +164,16 @@ public:
         return pimpl_->get_inplace_pairs();
     }
 
+    size_t get_scratchpad_size() const { return pimpl_->get_scratchpad_size(); }
+
+    graph::status_t get_constant_blob(size_t *size, uint8_t *blob) const {
+        return pimpl_->get_constant_blob(size, blob);
+    }
+
+    graph::status_t set_constant_blob(size_t size, const uint8_t *blob) {
+        return pimpl_->set_constant_blob(size, blob);
+    }
+
     graph::status_t execute(const graph::stream_t *astream,
             const std::vector<graph::tensor_t> &inputs,
             const std::vector<graph::tensor_t> &outputs) const;
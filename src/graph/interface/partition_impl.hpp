@@ -277,6 +277,28 @@ public:
         return inplace_pairs_;
     }
 
+    /// The size in bytes of the temporary buffer which is allocated by the
+    /// backend on each execution for the intermediate results. This function
+    /// is used in C API
+    virtual size_t get_scratchpad_size() const { return 0; }
+
+    /// Export the constants folded by the backend to a blob. When the blob is
+    /// nullptr, the size of the blob is returned. This function is used in C
+    /// API
+    virtual status_t get_constant_blob(size_t *size, uint8_t *blob) const {
+        UNUSED(size);
+        UNUSED(blob);
+        return status::unimplemented;
+    }
+
+    /// Import the folded constants from a blob, so that they are not computed
+    /// again on the first execution. This function is used in C API
+    virtual status_t set_constant_blob(size_t size, const uint8_t *blob) {
+        UNUSED(size);
+        UNUSED(blob);
+        return status::unimplemented;
+    }
+
     /// Query out a specific logical tensor by using an id. This function
     /// is used in C APIThe queried
     /// @param tid The id used to find the required logical tensor
@@ -173,9 +173,8 @@ lru_cache_t &get_test_cache() {
 
 int test_persistent_cache_api(benchdnn_dnnl_wrapper_t<dnnl_primitive_t> &prim,
         const_dnnl_primitive_desc_t pd, res_t *res) {
-    if (!is_gpu() || (is_gpu() && DNNL_GPU_RUNTIME != DNNL_RUNTIME_OCL)) {
-        return OK;
-    }
+    if (is_gpu() && DNNL_GPU_RUNTIME != DNNL_RUNTIME_OCL) return OK;
+    if (is_cpu() && DNNL_CPU_RUNTIME == DNNL_RUNTIME_SYCL) return OK;
 
     // Start testing persistent cache API.
     // 1. Disable primitive cache to make sure that the next primitive will
@@ -236,6 +235,12 @@ float round_to_nearest_representable(dnnl_data_type_t dt, float value) {
         case dnnl_f64: break;
         case dnnl_bf16: value = (float)dnnl::impl::bfloat16_t(value); break;
         case dnnl_f16: value = (float)dnnl::impl::float16_t(value); break;
+        case dnnl_f8_e5m2:
+            value = (float)dnnl::impl::float8_e5m2_t(value);
+            break;
+        case dnnl_f8_e4m3:
+            value = (float)dnnl::impl::float8_e4m3_t(value);
+            break;
         case dnnl_s32:
         case dnnl_s8:
         case dnnl_u8: value = maybe_saturate(dt, value); break;
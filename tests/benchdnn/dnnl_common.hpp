@@ -78,6 +78,8 @@ int check_primitive_cache(dnnl_primitive_t p);
 /* aux */
 using bfloat16_t = dnnl::impl::bfloat16_t;
 using float16_t = dnnl::impl::float16_t;
+using float8_e5m2_t = dnnl::impl::float8_e5m2_t;
+using float8_e4m3_t = dnnl::impl::float8_e4m3_t;
 template <dnnl_data_type_t>
 struct prec_traits;
 template <>
@@ -89,6 +91,14 @@ struct prec_traits<dnnl_f16> {
     typedef float16_t type;
 };
 template <>
+struct prec_traits<dnnl_f8_e5m2> {
+    typedef float8_e5m2_t type;
+};
+template <>
+struct prec_traits<dnnl_f8_e4m3> {
+    typedef float8_e4m3_t type;
+};
+template <>
 struct prec_traits<dnnl_f32> {
     typedef float type;
 };
@@ -118,6 +128,8 @@ struct prec_traits<dnnl_u8> {
     switch (dt) { \
         CASE(dnnl_bf16); \
         CASE(dnnl_f16); \
+        CASE(dnnl_f8_e5m2); \
+        CASE(dnnl_f8_e4m3); \
         CASE(dnnl_f32); \
         CASE(dnnl_f64); \
         CASE(dnnl_s32); \
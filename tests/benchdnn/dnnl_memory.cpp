@@ -181,6 +181,12 @@ float dnn_mem_t::get_elem(int64_t idx, int buffer_index) const {
         case dnnl_f64: elem = static_cast<double *>(data)[idx]; break;
         case dnnl_f16: elem = static_cast<float16_t *>(data)[idx]; break;
         case dnnl_bf16: elem = static_cast<bfloat16_t *>(data)[idx]; break;
+        case dnnl_f8_e5m2:
+            elem = static_cast<float8_e5m2_t *>(data)[idx];
+            break;
+        case dnnl_f8_e4m3:
+            elem = static_cast<float8_e4m3_t *>(data)[idx];
+            break;
         default: assert(!"bad data type");
     }
     return elem;
@@ -197,6 +203,8 @@ void dnn_mem_t::set_elem(int64_t idx, float value, int buffer_index) const {
         case dnnl_f64: ((double *)data)[idx] = value; break;
         case dnnl_f16: ((float16_t *)data)[idx] = value; break;
         case dnnl_bf16: ((bfloat16_t *)data)[idx] = value; break;
+        case dnnl_f8_e5m2: ((float8_e5m2_t *)data)[idx] = value; break;
+        case dnnl_f8_e4m3: ((float8_e4m3_t *)data)[idx] = value; break;
         default: assert(!"bad data type");
     }
 }
@@ -844,6 +852,8 @@ int check_zero_padding(
 
             CASE(dnnl_bf16, bfloat16_t);
             CASE(dnnl_f16, float16_t);
+            CASE(dnnl_f8_e5m2, float8_e5m2_t);
+            CASE(dnnl_f8_e4m3, float8_e4m3_t);
             CASE(dnnl_f32, float);
             CASE(dnnl_f64, double);
             CASE(dnnl_s32, int32_t);
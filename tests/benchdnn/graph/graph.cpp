@@ -255,6 +255,9 @@ int doit(const prb_t *prb, res_t *res) {
     // mark partition outputs id to set as ANY layout
     set_any_layout(partitions, id_to_set_any_layout);
 
+    // the largest scratchpad among partitions, which are executed one by one
+    size_t max_scratchpad_size = 0;
+
     for (size_t i = 0; i < partitions.size(); ++i) {
         auto inputs = partitions[i].get_input_ports();
         auto outputs = partitions[i].get_output_ports();
@@ -274,6 +277,12 @@ int doit(const prb_t *prb, res_t *res) {
         record_queried_logical_tensors(
                 outputs, c_partitions.back(), id_to_queried_logical_tensors);
 
+        const size_t scratchpad_size
+                = c_partitions.back().get_scratchpad_size();
+        max_scratchpad_size = std::max(max_scratchpad_size, scratchpad_size);
+        BENCHDNN_PRINT(1, "Partition %zd scratchpad size: %zu bytes.\n", i,
+                scratchpad_size);
+
         // Creating tensors and allocating memory buffer
         auto input_ts = tm.construct_and_initialize_tensors(
                 inputs, c_partitions.back(), eng, 128);
@@ -282,6 +291,7 @@ int doit(const prb_t *prb, res_t *res) {
         tensors_in.emplace_back(input_ts);
         tensors_out.emplace_back(output_ts);
     }
+    BENCHDNN_PRINT(1, "Max scratchpad size: %zu bytes.\n", max_scratchpad_size);
 
     if (is_bench_mode(INIT)) return res->state = INITIALIZED, OK;
 
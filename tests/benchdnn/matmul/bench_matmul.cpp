@@ -35,6 +35,24 @@ void check_correctness(const settings_t &s) {
             bia_cfg.emplace_back(i_bia_dt, i_bia_mask);
     }
 
+    std::vector<sparse_options_t> sparse_cfg;
+#ifdef DNNL_EXPERIMENTAL_SPARSE
+    for (const auto &i_encoding : s.encoding) {
+        sparse_options_t sparse_options;
+        sparse_options.src_encoding = i_encoding;
+        if (i_encoding == dnnl_sparse_encoding_undef) {
+            sparse_cfg.push_back(sparse_options);
+            continue;
+        }
+        for (const auto &i_sparsity : s.sparsity) {
+            sparse_options.sparsity = i_sparsity;
+            sparse_cfg.push_back(sparse_options);
+        }
+    }
+#else
+    sparse_cfg.emplace_back();
+#endif
+
     for_(const auto &i_dt : s.dt)
     for_(const auto &i_stag : s.stag)
     for_(const auto &i_wtag : s.wtag)
@@ -48,13 +66,14 @@ void check_correctness(const settings_t &s) {
     for_(const auto &i_ctx_init : s.ctx_init)
     for_(const auto &i_ctx_exe : s.ctx_exe)
     for_(const auto &i_fpmath_mode : s.fpmath_mode)
+    for_(const auto &i_sparse_options : sparse_cfg)
     for (const auto &i_bia_cfg : bia_cfg) {
         auto attr = settings_t::get_attr(i_scales, i_zero_points, i_post_ops,
                 i_scratchpad_mode, i_fpmath_mode);
 
         const prb_t prb(s.prb_vdims, i_dt, i_stag, i_wtag, i_dtag, i_strides,
                 i_bia_cfg.first, i_bia_cfg.second, i_rt_dims_masks, attr,
-                i_ctx_init, i_ctx_exe);
+                i_ctx_init, i_ctx_exe, i_sparse_options);
         BENCHDNN_PRINT(1, "run: %s\n", prb.str());
 
         res_t res {};
@@ -150,6 +169,10 @@ int bench(int argc, char **argv) {
                         s.scratchpad_mode, def.scratchpad_mode, argv[0])
                 || parse_attr_fpmath_mode(
                         s.fpmath_mode, def.fpmath_mode, argv[0])
+#ifdef DNNL_EXPERIMENTAL_SPARSE
+                || parse_encoding(s.encoding, def.encoding, argv[0])
+                || parse_sparsity(s.sparsity, def.sparsity, argv[0])
+#endif
                 || parse_ctx_init(s.ctx_init, def.ctx_init, argv[0])
                 || parse_ctx_exe(s.ctx_exe, def.ctx_exe, argv[0])
                 || parse_perf_template(s.perf_template, s.perf_template_def,
@@ -58,6 +58,8 @@ cfg_t::cfg_entry_t::cfg_map_t cfg_t::get_cfg_map(data_kind_t kind) const {
             {{dnnl_f32}, {-128, 128}},
             {{dnnl_bf16}, {-8, 8}},
             {{dnnl_f16}, {-2, 2}},
+            {{dnnl_f8_e5m2}, {-2, 2}},
+            {{dnnl_f8_e4m3}, {-2, 2}},
             {{dnnl_s8}, {-4, 4}},
     };
 
@@ -14,8 +14,10 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <algorithm>
 #include <float.h>
 #include <math.h>
+#include <numeric>
 #include <random>
 #include <stdio.h>
 #include <stdlib.h>
@@ -53,8 +55,17 @@ dnnl_status_t init_pd(init_pd_args_t<prb_t> &init_pd_args) {
     const auto &dst_rt_dims
             = get_runtime_dims(prb->dst_dims, prb->dst_runtime_dim_mask());
 
-    auto src_d = dnn_mem_t::init_md(prb->ndims, src_rt_dims.data(),
-            prb->src_dt(), prb->stag, prb->strides[STRIDES_SRC]);
+    benchdnn_dnnl_wrapper_t<dnnl_memory_desc_t> src_d {};
+#ifdef DNNL_EXPERIMENTAL_SPARSE
+    if (prb->sparse_options.is_src_sparse()) {
+        src_d = dnn_mem_t::init_csr_md(prb->ndims, src_rt_dims.data(),
+                prb->src_dt(), prb->src_nnz(), dnnl_s32, dnnl_s32);
+    }
+#endif
+    if (!src_d) {
+        src_d = dnn_mem_t::init_md(prb->ndims, src_rt_dims.data(),
+                prb->src_dt(), prb->stag, prb->strides[STRIDES_SRC]);
+    }
     auto wei_d = dnn_mem_t::init_md(prb->ndims, weights_rt_dims.data(),
             prb->wei_dt(), prb->wtag, prb->strides[STRIDES_WEI]);
     auto dst_d = dnn_mem_t::init_md(prb->ndims, dst_rt_dims.data(),
@@ -185,6 +196,56 @@ int fill_data(data_kind_t kind, const prb_t *prb, dnn_mem_t &mem_dt,
     return OK;
 }
 
+#ifdef DNNL_EXPERIMENTAL_SPARSE
+// Fills the CSR source with `nnz` non-zero values at random positions and the
+// dense reference memory with the same values.
+int fill_sparse_src(const prb_t *prb, dnn_mem_t &mem_dt, dnn_mem_t &mem_fp,
+        res_t *res) {
+    const int64_t nelems = mem_fp.nelems();
+    if (nelems == 0) return OK;
+
+    cfg_t cfg(prb, {SRC, WEI, BIA, DST});
+    const auto dt = cfg.get_dt(SRC);
+
+    // Pick the positions of the non-zero elements in a row-major order.
+    const int64_t nnz = prb->src_nnz();
+    std::vector<int64_t> positions(nelems);
+    std::iota(positions.begin(), positions.end(), 0);
+    std::minstd_rand pos_seed(nelems);
+    std::shuffle(positions.begin(), positions.end(), pos_seed);
+    positions.resize(nnz);
+    std::sort(positions.begin(), positions.end());
+
+    for (int64_t idx = 0; idx < nelems; ++idx)
+        mem_fp.set_elem(idx, 0.f);
+
+    std::minstd_rand int_seed(nelems + 1);
+    int_seed.discard(1);
+    std::uniform_int_distribution<> gen(
+            cfg.get_range_min(SRC), cfg.get_range_max(SRC));
+
+    // The CSR buffers are the values, the column indices and the row
+    // pointers.
+    const int values_idx = 0, indices_idx = 1, pointers_idx = 2;
+    int64_t row = 0;
+    mem_dt.set_elem(0, 0, pointers_idx);
+    for (int64_t i = 0; i < nnz; ++i) {
+        float val = 0;
+        while (val == 0)
+            val = round_to_nearest_representable(dt, gen(int_seed));
+        mem_fp.set_elem(positions[i], val);
+        mem_dt.set_elem(i, val, values_idx);
+        mem_dt.set_elem(i, positions[i] % prb->k, indices_idx);
+        for (; row < positions[i] / prb->k; ++row)
+            mem_dt.set_elem(row + 1, i, pointers_idx);
+    }
+    for (; row < prb->m; ++row)
+        mem_dt.set_elem(row + 1, nnz, pointers_idx);
+
+    return OK;
+}
+#endif
+
 void skip_unimplemented_prb(const prb_t *prb, res_t *res) {
     skip_unimplemented_data_type(
             {prb->src_dt(), prb->wei_dt(), prb->bia_dt, prb->dst_dt()},
@@ -192,6 +253,12 @@ void skip_unimplemented_prb(const prb_t *prb, res_t *res) {
     skip_unimplemented_sum_po(prb->attr, res, prb->dst_dt());
 
     if (is_gpu()) {
+        // GPU doesn't support sparse memory.
+        if (prb->sparse_options.is_src_sparse()) {
+            res->state = SKIPPED, res->reason = CASE_NOT_SUPPORTED;
+            return;
+        }
+
         // GPU supports only single zero-point per tensor.
         if (prb->attr.zero_points.get(DNNL_ARG_SRC).policy != policy_t::COMMON
                 || prb->attr.zero_points.get(DNNL_ARG_DST).policy
@@ -249,6 +316,16 @@ void skip_invalid_prb(const prb_t *prb, res_t *res) {
     auto wei_rt_mask = prb->weights_runtime_dim_mask();
     auto dst_rt_mask = prb->dst_runtime_dim_mask();
 
+    // The sparse source is a 2D matrix with the layout defined by the
+    // encoding.
+    if (prb->sparse_options.is_src_sparse()
+            && (prb->ndims != 2 || src_rt_mask.any() || wei_rt_mask.any()
+                    || prb->stag != tag::any
+                    || !prb->strides[STRIDES_SRC].empty())) {
+        res->state = SKIPPED, res->reason = INVALID_CASE;
+        return;
+    }
+
     // Memory layouts must be defined when some dimensions are unknown at pd
     // creation time.
     if ((src_rt_mask.any() && prb->stag == "any")
@@ -291,6 +368,8 @@ void setup_cmp(compare::compare_t &cmp, const prb_t *prb, data_kind_t kind,
     const float trh = dt == dnnl_f32 ? 1e-6f : epsilon_dt(dt);
     cmp.set_threshold(trh);
     cmp.set_zero_trust_percent(90.f); // TODO: why so bad filling?
+    // A highly sparse source produces many zeros in the destination.
+    if (prb->sparse_options.is_src_sparse()) cmp.set_zero_trust_percent(100.f);
 }
 
 std::vector<int> supported_exec_args(dir_t dir) {
@@ -318,6 +397,12 @@ int init_ref_memory_args(dnn_mem_map_t &ref_mem_map, dnn_mem_map_t &mem_map,
 
         switch (exec_arg) {
             case DNNL_ARG_SRC:
+#ifdef DNNL_EXPERIMENTAL_SPARSE
+                if (prb->sparse_options.is_src_sparse()) {
+                    SAFE(fill_sparse_src(prb, mem, ref_mem, res), WARN);
+                    break;
+                }
+#endif
                 SAFE(fill_data(SRC, prb, mem, ref_mem, res), WARN);
                 break;
             case DNNL_ARG_WEIGHTS:
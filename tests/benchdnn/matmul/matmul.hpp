@@ -35,6 +35,23 @@ namespace matmul {
 
 typedef std::bitset<DNNL_MAX_NDIMS> dims_mask_t;
 
+// Only the source may be sparse, the weights and the destination are dense.
+struct sparse_options_t {
+#ifdef DNNL_EXPERIMENTAL_SPARSE
+    dnnl_sparse_encoding_t src_encoding = dnnl_sparse_encoding_undef;
+#endif
+    // The fraction of zero elements of the sparse source.
+    float sparsity = 0.9f;
+
+    bool is_src_sparse() const {
+#ifdef DNNL_EXPERIMENTAL_SPARSE
+        return src_encoding != dnnl_sparse_encoding_undef;
+#else
+        return false;
+#endif
+    }
+};
+
 struct settings_t : public base_settings_t {
     settings_t() = default;
 
@@ -51,6 +68,10 @@ struct settings_t : public base_settings_t {
     std::vector<dnnl_data_type_t> bia_dt {dnnl_data_type_undef};
     std::vector<int> bia_mask {2};
     std::vector<std::vector<dims_mask_t>> rt_dims_masks {{}};
+#ifdef DNNL_EXPERIMENTAL_SPARSE
+    std::vector<dnnl_sparse_encoding_t> encoding {dnnl_sparse_encoding_undef};
+    std::vector<float> sparsity {0.9f};
+#endif
 
     const char *perf_template_csv() const {
         static const std::string args = "%sdt%,%stag%,%wtag%,%dtag%";
@@ -63,8 +84,26 @@ struct settings_t : public base_settings_t {
         return dt.size() == 1 && stag.size() == 1 && wtag.size() == 1
                 && dtag.size() == 1 && strides.size() == 1 && bia_dt.size() == 1
                 && bia_mask.size() == 1 && rt_dims_masks.size() == 1
+                && has_single_sparse_setup()
                 && base_settings_t::has_single_setup();
     }
+
+    bool has_single_sparse_setup() const {
+#ifdef DNNL_EXPERIMENTAL_SPARSE
+        return encoding.size() == 1 && sparsity.size() == 1;
+#else
+        return true;
+#endif
+    }
+
+    sparse_options_t get_sparse_options() const {
+        sparse_options_t sparse_options;
+#ifdef DNNL_EXPERIMENTAL_SPARSE
+        sparse_options.src_encoding = encoding[0];
+        sparse_options.sparsity = sparsity[0];
+#endif
+        return sparse_options;
+    }
 };
 
 struct prb_t : public prb_vdims_t {
@@ -74,7 +113,7 @@ struct prb_t : public prb_vdims_t {
                 s.strides[0], s.bia_dt[0], s.bia_mask[0], s.rt_dims_masks[0],
                 settings_t::get_attr(s.scales[0], s.zero_points[0],
                         s.post_ops[0], s.scratchpad_mode[0], s.fpmath_mode[0]),
-                s.ctx_init[0], s.ctx_exe[0]) {
+                s.ctx_init[0], s.ctx_exe[0], s.get_sparse_options()) {
         SAFE_V(s.has_single_setup() ? OK : FAIL);
     }
 
@@ -83,7 +122,8 @@ struct prb_t : public prb_vdims_t {
             const std::string &dtag, const vdims_t &strides,
             dnnl_data_type_t bia_dt, int bia_mask,
             const std::vector<dims_mask_t> &rt_dims_masks, const attr_t &attr,
-            const thr_ctx_t &ctx_init, const thr_ctx_t &ctx_exe)
+            const thr_ctx_t &ctx_init, const thr_ctx_t &ctx_exe,
+            const sparse_options_t &sparse_options = sparse_options_t())
         : prb_vdims_t(prb_vdims)
         , dt(dt)
         , stag(stag)
@@ -95,7 +135,8 @@ struct prb_t : public prb_vdims_t {
         , rt_dims_masks(rt_dims_masks)
         , attr(attr)
         , ctx_init(ctx_init)
-        , ctx_exe(ctx_exe) {
+        , ctx_exe(ctx_exe)
+        , sparse_options(sparse_options) {
 
         // Broadcast data types if needed
         if (dt.size() == 1) {
@@ -132,6 +173,7 @@ struct prb_t : public prb_vdims_t {
 
     attr_t attr;
     thr_ctx_t ctx_init, ctx_exe;
+    sparse_options_t sparse_options;
 
     double ops;
 
@@ -164,6 +206,13 @@ struct prb_t : public prb_vdims_t {
     dnnl_data_type_t dst_dt() const { return dt[2]; }
     dnnl_data_type_t get_dt(data_kind_t data_kind) const;
 
+    // Returns the number of non-zero elements of the sparse source.
+    dnnl_dim_t src_nnz() const {
+        const dnnl_dim_t nelems = mb * m * k;
+        const auto nnz = (dnnl_dim_t)(nelems * (1.f - sparse_options.sparsity));
+        return std::max((dnnl_dim_t)1, std::min(nnz, nelems));
+    }
+
     // Used to construct memory desc when dimensions are runtime since such mds
     // can't be used directly from query and memory objects can't be constructed.
     benchdnn_dnnl_wrapper_t<dnnl_memory_desc_t> get_md(int arg) const;
@@ -82,6 +82,15 @@ std::string prb_t::set_repro_line() {
         s << "--runtime_dims_masks=" << src_runtime_dim_mask().to_ulong() << ":"
           << weights_runtime_dim_mask().to_ulong() << " ";
 
+#ifdef DNNL_EXPERIMENTAL_SPARSE
+    if (canonical || sparse_options.is_src_sparse()) {
+        s << "--encoding=" << sparse_encoding2str(sparse_options.src_encoding)
+          << " ";
+        if (canonical || sparse_options.sparsity != def.sparsity[0])
+            s << "--sparsity=" << sparse_options.sparsity << " ";
+    }
+#endif
+
     if (canonical || bia_dt != def.bia_dt[0]) {
         s << "--bia_dt=" << bia_dt << " ";
 
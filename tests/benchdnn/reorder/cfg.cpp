@@ -28,6 +28,8 @@ namespace reorder {
 
 const float int_max_exact = 1 << 24;
 const float f16_max_exact = 1 << 11;
+const float f8_e5m2_max_exact = 1 << 3;
+const float f8_e4m3_max_exact = 1 << 4;
 
 #define REG(dt, min, max) \
     const dt_conf_s CONCAT2(_conf_, dt) = {CONCAT2(dnnl_, dt), min, max}; \
@@ -37,6 +39,8 @@ REG(f32, -int_max_exact, int_max_exact);
 REG(f64, -int_max_exact, int_max_exact);
 REG(f16, -f16_max_exact, f16_max_exact);
 REG(bf16, -int_max_exact, int_max_exact);
+REG(f8_e5m2, -f8_e5m2_max_exact, f8_e5m2_max_exact);
+REG(f8_e4m3, -f8_e4m3_max_exact, f8_e4m3_max_exact);
 // Do not exceed max float value representable in integer. Otherwise, we get
 // a correctness issue caused by different computations in reference and the
 // library.
@@ -53,6 +57,8 @@ dt_conf_t dt2cfg(dnnl_data_type_t dt) {
     CASE(f64);
     CASE(f16);
     CASE(bf16);
+    CASE(f8_e5m2);
+    CASE(f8_e4m3);
     CASE(s32);
     CASE(s8);
     CASE(u8);
@@ -68,6 +74,8 @@ dnnl_data_type_t cfg2dt(dt_conf_t cfg) {
     CASE(f64);
     CASE(f16);
     CASE(bf16);
+    CASE(f8_e5m2);
+    CASE(f8_e4m3);
     CASE(s32);
     CASE(s8);
     CASE(u8);
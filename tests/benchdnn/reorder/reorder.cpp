@@ -275,11 +275,26 @@ void skip_unimplemented_prb(const prb_t *prb, res_t *res) {
             return;
         }
 
-        // CPU f16 reorders only support f16<->f32 combinations
-        const bool f16_src_ok = IMPLICATION(
-                sdt == dnnl_f16, ddt == dnnl_f16 || ddt == dnnl_f32);
-        const bool f16_dst_ok = IMPLICATION(
-                ddt == dnnl_f16, sdt == dnnl_f16 || sdt == dnnl_f32);
+        // CPU f8 reorders only support combinations with floating-point types
+        const auto is_f8 = [](dnnl_data_type_t dt) {
+            return dt == dnnl_f8_e5m2 || dt == dnnl_f8_e4m3;
+        };
+        const auto is_fp = [&](dnnl_data_type_t dt) {
+            return dt == dnnl_f32 || dt == dnnl_bf16 || dt == dnnl_f16
+                    || is_f8(dt);
+        };
+        const bool f8_ok = IMPLICATION(
+                is_f8(sdt) || is_f8(ddt), is_fp(sdt) && is_fp(ddt));
+        if (!f8_ok) {
+            res->state = SKIPPED, res->reason = CASE_NOT_SUPPORTED;
+            return;
+        }
+
+        // CPU f16 reorders only support f16<->f32 and f16<->f8 combinations
+        const bool f16_src_ok = IMPLICATION(sdt == dnnl_f16,
+                ddt == dnnl_f16 || ddt == dnnl_f32 || is_f8(ddt));
+        const bool f16_dst_ok = IMPLICATION(ddt == dnnl_f16,
+                sdt == dnnl_f16 || sdt == dnnl_f32 || is_f8(sdt));
         if (!f16_src_ok || !f16_dst_ok) {
             res->state = SKIPPED, res->reason = CASE_NOT_SUPPORTED;
             return;
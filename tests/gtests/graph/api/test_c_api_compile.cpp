@@ -246,6 +246,15 @@ TEST(CAPI, CompileConv2D) {
     EXPECT_EQ(num_inplace_pairs,
             0U); // Convolutional operator W/O sum has no in-place operation.
 
+    // Check scratchpad size query
+    size_t scratchpad_size = 0;
+    EXPECT_EQ(dnnl_graph_compiled_partition_get_scratchpad_size(
+                      compiled_partition, &scratchpad_size),
+            dnnl_success);
+    EXPECT_EQ(dnnl_graph_compiled_partition_get_scratchpad_size(
+                      compiled_partition, nullptr),
+            dnnl_invalid_arguments);
+
     COMPILED_CONV2D_DESTROY;
 #undef COMPILED_CONV2D_DESTROY
 }
@@ -14,6 +14,8 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <algorithm>
+
 #include "gtest/gtest.h"
 
 #include "interface/partition.hpp"
@@ -368,3 +370,172 @@ TEST(CompiledPartition, GetInputsAndOutputs) {
                 ltw(cp->get_outputs()[i]).is_identical(ltw(outputs[i])), true);
     }
 }
+
+TEST(CompiledPartition, DynamicShape) {
+    graph::engine_t *eng = get_engine();
+    graph::stream_t *strm = get_stream();
+
+    const graph::dim_t K = 16, N = 8;
+    graph::op_t matmul_op(0, graph::op_kind::MatMul, "matmul");
+    graph::op_t relu_op(1, graph::op_kind::ReLU, "relu");
+
+    // the number of rows is only known on execution
+    graph::logical_tensor_t src_lt = utils::logical_tensor_init(
+            0, {DNNL_GRAPH_UNKNOWN_DIM, K}, graph::data_type::f32);
+    graph::logical_tensor_t wei_lt
+            = utils::logical_tensor_init(1, {K, N}, graph::data_type::f32);
+    graph::logical_tensor_t mm_dst_lt = utils::logical_tensor_init(
+            2, {DNNL_GRAPH_UNKNOWN_DIM, N}, graph::data_type::f32);
+    graph::logical_tensor_t dst_lt = utils::logical_tensor_init(3,
+            {DNNL_GRAPH_UNKNOWN_DIM, N}, graph::data_type::f32,
+            graph::layout_type::any);
+
+    matmul_op.add_input(src_lt);
+    matmul_op.add_input(wei_lt);
+    matmul_op.add_output(mm_dst_lt);
+    relu_op.add_input(mm_dst_lt);
+    relu_op.add_output(dst_lt);
+
+    graph::graph_t g(eng->kind());
+    g.add_op(&matmul_op);
+    g.add_op(&relu_op);
+    g.finalize();
+    run_all_passes(g);
+
+    ASSERT_EQ(g.get_num_partitions(), 1U);
+    auto part = g.get_partitions()[0];
+
+    graph::partition_t p;
+    p.init(part);
+    graph::compiled_partition_t cp(p);
+
+    std::vector<const graph::logical_tensor_t *> lt_inputs {&src_lt, &wei_lt};
+    std::vector<const graph::logical_tensor_t *> lt_outputs {&dst_lt};
+    ASSERT_EQ(p.compile(&cp, lt_inputs, lt_outputs, eng),
+            graph::status::success);
+
+    graph::logical_tensor_t compiled_dst_lt;
+    ASSERT_EQ(cp.query_logical_tensor(dst_lt.id, &compiled_dst_lt),
+            graph::status::success);
+    ASSERT_EQ(compiled_dst_lt.layout_type, graph::layout_type::strided);
+    using ltw = graph::logical_tensor_wrapper_t;
+    ASSERT_TRUE(ltw(compiled_dst_lt).is_shape_unknown());
+
+    test::vector<float> wei(K * N);
+    for (size_t i = 0; i < wei.size(); i++)
+        wei[i] = static_cast<float>(i % 5) - 2.f;
+    graph::tensor_t wei_ts(wei_lt, eng, wei.data());
+
+    // execute the same compiled partition with different shapes, and the
+    // first shape once more
+    for (graph::dim_t M : {3, 7, 3}) {
+        test::vector<float> src(M * K), dst(M * N, 0.f);
+        for (size_t i = 0; i < src.size(); i++)
+            src[i] = static_cast<float>(i % 7) - 3.f;
+
+        graph::logical_tensor_t src_m_lt
+                = utils::logical_tensor_init(0, {M, K}, graph::data_type::f32);
+        graph::logical_tensor_t dst_m_lt
+                = utils::logical_tensor_init(3, {M, N}, graph::data_type::f32);
+        graph::tensor_t src_ts(src_m_lt, eng, src.data());
+        graph::tensor_t dst_ts(dst_m_lt, eng, dst.data());
+
+        ASSERT_EQ(cp.execute(strm, {src_ts, wei_ts}, {dst_ts}),
+                graph::status::success);
+        strm->wait();
+
+        for (graph::dim_t m = 0; m < M; m++) {
+            for (graph::dim_t n = 0; n < N; n++) {
+                float ref = 0.f;
+                for (graph::dim_t k = 0; k < K; k++)
+                    ref += src[m * K + k] * wei[k * N + n];
+                ASSERT_FLOAT_EQ(dst[m * N + n], std::max(ref, 0.f));
+            }
+        }
+    }
+
+    // the output tensor must have the inferred shape
+    test::vector<float> src(4 * K), dst(5 * N);
+    graph::logical_tensor_t src_m_lt
+            = utils::logical_tensor_init(0, {4, K}, graph::data_type::f32);
+    graph::logical_tensor_t dst_m_lt
+            = utils::logical_tensor_init(3, {5, N}, graph::data_type::f32);
+    graph::tensor_t src_ts(src_m_lt, eng, src.data());
+    graph::tensor_t dst_ts(dst_m_lt, eng, dst.data());
+    ASSERT_EQ(cp.execute(strm, {src_ts, wei_ts}, {dst_ts}),
+            graph::status::invalid_shape);
+}
+
+TEST(CompiledPartition, DynamicShapeSharedConstants) {
+    graph::engine_t *eng = get_engine();
+    graph::stream_t *strm = get_stream();
+    SKIP_IF(eng->kind() == graph::engine_kind::gpu,
+            "skip the constant cache check on gpu");
+
+    const graph::dim_t K = 64, N = 64;
+    graph::op_t matmul_op(0, graph::op_kind::MatMul, "matmul");
+
+    graph::logical_tensor_t src_lt = utils::logical_tensor_init(
+            0, {DNNL_GRAPH_UNKNOWN_DIM, K}, graph::data_type::f32);
+    graph::logical_tensor_t wei_lt
+            = utils::logical_tensor_init(1, {K, N}, graph::data_type::f32);
+    wei_lt.property = graph::property_type::constant;
+    graph::logical_tensor_t dst_lt = utils::logical_tensor_init(2,
+            {DNNL_GRAPH_UNKNOWN_DIM, N}, graph::data_type::f32,
+            graph::layout_type::any);
+
+    matmul_op.add_input(src_lt);
+    matmul_op.add_input(wei_lt);
+    matmul_op.add_output(dst_lt);
+
+    graph::graph_t g(eng->kind());
+    g.add_op(&matmul_op);
+    g.finalize();
+    run_all_passes(g);
+    ASSERT_EQ(g.get_num_partitions(), 1U);
+
+    graph::partition_t p;
+    p.init(g.get_partitions()[0]);
+    graph::compiled_partition_t cp(p);
+
+    std::vector<const graph::logical_tensor_t *> lt_inputs {&src_lt, &wei_lt};
+    std::vector<const graph::logical_tensor_t *> lt_outputs {&dst_lt};
+    ASSERT_EQ(p.compile(&cp, lt_inputs, lt_outputs, eng),
+            graph::status::success);
+
+    test::vector<float> wei(K * N), zero_wei(K * N, 0.f);
+    for (size_t i = 0; i < wei.size(); i++)
+        wei[i] = static_cast<float>(i % 5) - 2.f;
+    graph::tensor_t wei_ts(wei_lt, eng, wei.data());
+    graph::tensor_t zero_wei_ts(wei_lt, eng, zero_wei.data());
+
+    // The weights are folded by the first execution. The kernels compiled
+    // for the other shapes reuse the folded weights instead of the weights
+    // tensor, which is zeroed.
+    for (graph::dim_t M : {2, 5, 9}) {
+        test::vector<float> src(M * K), dst(M * N, 0.f);
+        for (size_t i = 0; i < src.size(); i++)
+            src[i] = static_cast<float>(i % 7) - 3.f;
+
+        graph::logical_tensor_t src_m_lt
+                = utils::logical_tensor_init(0, {M, K}, graph::data_type::f32);
+        graph::logical_tensor_t dst_m_lt
+                = utils::logical_tensor_init(2, {M, N}, graph::data_type::f32);
+        graph::tensor_t src_ts(src_m_lt, eng, src.data());
+        graph::tensor_t dst_ts(dst_m_lt, eng, dst.data());
+
+        ASSERT_EQ(cp.execute(strm, {src_ts, M == 2 ? wei_ts : zero_wei_ts},
+                          {dst_ts}),
+                graph::status::success);
+        strm->wait();
+
+        for (graph::dim_t m = 0; m < M; m++) {
+            for (graph::dim_t n = 0; n < N; n++) {
+                float ref = 0.f;
+                for (graph::dim_t k = 0; k < K; k++)
+                    ref += src[m * K + k] * wei[k * N + n];
+                ASSERT_FLOAT_EQ(dst[m * N + n], ref);
+            }
+        }
+    }
+}
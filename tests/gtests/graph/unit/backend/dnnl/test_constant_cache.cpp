@@ -13,19 +13,28 @@
 * See the License for the specific language governing permissions and
 * limitations under the License.
 *******************************************************************************/
+#include <cstring>
+#include <vector>
+
 #include "gtest/gtest.h"
 
+#include "backend/dnnl/constant_blob.hpp"
 #include "backend/dnnl/constant_cache.hpp"
+#include "backend/dnnl/dnnl_backend.hpp"
 
+#include "interface/partition.hpp"
+#include "interface/tensor.hpp"
 #include "interface/value.hpp"
 
 #include "graph/unit/unit_test_common.hpp"
 #include "graph/unit/utils.hpp"
 
+#include "utils/pm/pass_manager.hpp"
 #include "utils/utils.hpp"
 
 namespace graph = dnnl::impl::graph;
 namespace dnnl_impl = graph::dnnl_impl;
+namespace utils = dnnl::graph::tests::unit::utils;
 
 TEST(ConstantCache, SetGetCapacity) {
     graph::dnnl_impl::constant_cache_t cache;
@@ -76,3 +85,110 @@ TEST(ConstantCache, Evict) {
     ASSERT_EQ(cache.set_capacity(3), graph::status::success);
     ASSERT_EQ(cache.set_capacity(0), graph::status::success);
 }
+
+TEST(ConstantCache, ConstantBlob) {
+    graph::engine_t *engine = get_engine();
+    graph::stream_t *strm = get_stream();
+    SKIP_IF(engine->kind() == graph::engine_kind::gpu,
+            "constant blobs are only supported on cpu");
+
+    graph::op_t conv_op(0, graph::op_kind::Convolution, "conv");
+    utils::set_conv_common_attr(conv_op);
+    auto src_lt = utils::logical_tensor_init(
+            0, {1, 8, 8, 16}, graph::data_type::f32);
+    auto wei_lt = utils::logical_tensor_init(
+            1, {3, 3, 16, 32}, graph::data_type::f32);
+    wei_lt.property = graph::property_type::constant;
+    auto dst_lt = utils::logical_tensor_init(
+            2, {1, 6, 6, 32}, graph::data_type::f32);
+    conv_op.add_input(src_lt);
+    conv_op.add_input(wei_lt);
+    conv_op.add_output(dst_lt);
+
+    graph::graph_t g(engine->kind());
+    g.add_op(&conv_op);
+    g.finalize();
+    auto &backend = dnnl_impl::dnnl_backend::get_singleton();
+    graph::pass::pass_manager_t pm(backend.get_pass_registry());
+    pm.run_passes(g, "", graph::partition_policy::fusion);
+    ASSERT_EQ(g.get_num_partitions(), 1U);
+
+    graph::partition_t p;
+    p.init(g.get_partitions()[0]);
+    std::vector<const graph::logical_tensor_t *> lt_ins {&src_lt, &wei_lt};
+    std::vector<const graph::logical_tensor_t *> lt_outs {&dst_lt};
+
+    test::vector<float> src(8 * 8 * 16), wei(3 * 3 * 16 * 32);
+    test::vector<float> zero_wei(wei.size(), 0.f);
+    test::vector<float> ref_dst(6 * 6 * 32), dst(ref_dst.size());
+    for (size_t i = 0; i < src.size(); i++)
+        src[i] = static_cast<float>(i % 11) * 0.1f - 0.5f;
+    for (size_t i = 0; i < wei.size(); i++)
+        wei[i] = static_cast<float>(i % 7) * 0.1f - 0.3f;
+
+    graph::tensor_t src_ts(src_lt, engine, src.data());
+    graph::tensor_t wei_ts(wei_lt, engine, wei.data());
+    graph::tensor_t zero_wei_ts(wei_lt, engine, zero_wei.data());
+    graph::tensor_t ref_dst_ts(dst_lt, engine, ref_dst.data());
+    graph::tensor_t dst_ts(dst_lt, engine, dst.data());
+
+    // Storage of the imported blobs, which must outlive the compiled
+    // partitions.
+    std::vector<uint8_t> aligned_storage, unaligned_storage;
+
+    graph::compiled_partition_t cp(p);
+    ASSERT_EQ(p.compile(&cp, lt_ins, lt_outs, engine), graph::status::success);
+
+    size_t size = 0;
+    ASSERT_EQ(cp.get_constant_blob(&size, nullptr), graph::status::success);
+    ASSERT_GE(size, dnnl_impl::constant_blob_page_size);
+    const bool has_constants = size > dnnl_impl::constant_blob_page_size;
+
+    // The constants are folded on the first execution.
+    std::vector<uint8_t> blob(size);
+    if (has_constants) {
+        ASSERT_EQ(cp.get_constant_blob(&size, blob.data()),
+                graph::status::invalid_arguments);
+    }
+    ASSERT_EQ(cp.execute(strm, {src_ts, wei_ts}, {ref_dst_ts}),
+            graph::status::success);
+    strm->wait();
+    ASSERT_EQ(cp.get_constant_blob(&size, blob.data()), graph::status::success);
+
+    // The constants of the blob are used in place when they are aligned, and
+    // copied otherwise.
+    const size_t page = dnnl_impl::constant_blob_page_size;
+    aligned_storage.resize(blob.size() + page);
+    uint8_t *aligned_blob = aligned_storage.data() + page
+            - reinterpret_cast<size_t>(aligned_storage.data()) % page;
+    std::memcpy(aligned_blob, blob.data(), blob.size());
+    unaligned_storage.resize(blob.size() + 1);
+    uint8_t *unaligned_blob = unaligned_storage.data()
+            + (reinterpret_cast<size_t>(unaligned_storage.data()) % 2 == 0);
+    std::memcpy(unaligned_blob, blob.data(), blob.size());
+
+    for (const uint8_t *b : {aligned_blob, unaligned_blob}) {
+        graph::compiled_partition_t cp_loaded(p);
+        ASSERT_EQ(p.compile(&cp_loaded, lt_ins, lt_outs, engine),
+                graph::status::success);
+
+        // A blob of another library version or layout is rejected.
+        std::vector<uint8_t> bad_blob(blob);
+        bad_blob[8] ^= 1;
+        ASSERT_EQ(cp_loaded.set_constant_blob(bad_blob.size(), bad_blob.data()),
+                graph::status::invalid_arguments);
+        ASSERT_EQ(cp_loaded.set_constant_blob(blob.size() - 1, b),
+                graph::status::invalid_arguments);
+
+        ASSERT_EQ(cp_loaded.set_constant_blob(blob.size(), b),
+                graph::status::success);
+
+        // The folded weights come from the blob, not from the weights tensor.
+        ASSERT_EQ(cp_loaded.execute(strm, {src_ts, zero_wei_ts}, {dst_ts}),
+                graph::status::success);
+        strm->wait();
+        if (!has_constants) continue;
+        for (size_t i = 0; i < dst.size(); i++)
+            ASSERT_FLOAT_EQ(dst[i], ref_dst[i]);
+    }
+}
@@ -14,15 +14,26 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <algorithm>
+#include <cmath>
 #include <functional>
+#include <map>
 #include <random>
 
 #include "gtest/gtest.h"
 
+#include "backend/dnnl/dnnl_backend.hpp"
+#include "backend/dnnl/dnnl_partition_impl.hpp"
+#include "backend/dnnl/passes/utils.hpp"
+
 #include "graph/unit/backend/dnnl/dnnl_test_common.hpp"
 #include "graph/unit/unit_test_common.hpp"
 #include "graph/unit/utils.hpp"
 
+#ifdef _WIN32
+#include <windows.h>
+#endif
+
 namespace graph = dnnl::impl::graph;
 namespace utils = dnnl::graph::tests::unit::utils;
 
@@ -284,6 +295,122 @@ TEST(Execute, F32Resnet50Stage2Block) {
     strm->wait();
 }
 
+TEST(Execute, F32Resnet50Stage2BlockParallelOps) {
+    graph::engine_t *eng = get_engine();
+    graph::stream_t *strm = get_stream();
+    if (eng->kind() != graph::engine_kind::cpu) {
+        GTEST_SKIP() << "parallel ops are supported on CPU only";
+    }
+
+    utils::id_generator id_gen;
+    graph::graph_t g(eng->kind());
+    utils::construct_f32_resnet50_stage2_block(
+            &g, id_gen, 3, /* use biasadd */ true);
+    g.finalize();
+
+    graph::pass::pass_base_ptr apass = get_pass("f32_resnet50_stage_2_fusion");
+    apass->run(g);
+    ASSERT_EQ(g.get_num_partitions(), 1U);
+    using partition_impl_t = graph::dnnl_impl::dnnl_partition_impl_t;
+    auto part = std::dynamic_pointer_cast<partition_impl_t>(
+            g.get_partitions()[0]);
+    ASSERT_TRUE(part);
+
+    std::vector<graph::logical_tensor_t> inputs = part->get_inputs();
+    std::vector<graph::logical_tensor_t> outputs;
+    for (const auto &lt : part->get_outputs())
+        outputs.emplace_back(utils::logical_tensor_init(
+                lt.id, lt.data_type, graph::layout_type::strided));
+
+    using ltw = graph::logical_tensor_wrapper_t;
+    std::default_random_engine generator(7);
+    std::uniform_real_distribution<float> distribution(-1.f, 1.f);
+    std::vector<test::vector<float>> inputs_data;
+    std::vector<graph::tensor_t> inputs_ts;
+    for (const auto &lt : inputs) {
+        inputs_data.emplace_back(utils::product(ltw(lt).vdims()));
+        std::generate(inputs_data.back().begin(), inputs_data.back().end(),
+                [&]() { return distribution(generator); });
+        inputs_ts.emplace_back(lt, eng, inputs_data.back().data());
+    }
+
+    // The partition is compiled and executed with the ops executed one by
+    // one, and then with the independent ops executed concurrently.
+    const bool enabled = graph::dnnl_impl::is_parallel_ops_enabled(
+            graph::dnnl_impl::make_dnnl_engine(*eng));
+    std::vector<test::vector<float>> results;
+    for (bool parallel_ops : {false, true}) {
+        graph::dnnl_impl::set_parallel_ops_enabled(parallel_ops);
+        auto part_copy
+                = std::dynamic_pointer_cast<partition_impl_t>(part->clone());
+        auto kernel = graph::dnnl_impl::large_partition_kernel_creator();
+        std::vector<graph::logical_tensor_t> compiled_outputs = outputs;
+        ASSERT_EQ(kernel->compile(
+                          part_copy.get(), eng, inputs, compiled_outputs),
+                graph::status::success);
+
+        ASSERT_EQ(compiled_outputs.size(), 1U);
+        results.emplace_back(
+                utils::product(ltw(compiled_outputs[0]).vdims()), 0.f);
+        graph::tensor_t output_ts(
+                compiled_outputs[0], eng, results.back().data());
+
+        ASSERT_EQ(kernel->execute(strm, inputs_ts, {output_ts}),
+                graph::status::success);
+        strm->wait();
+    }
+    graph::dnnl_impl::set_parallel_ops_enabled(enabled);
+
+    ASSERT_TRUE(allclose(results[0], results[1], /*rtol*/ 1e-5f,
+            /*atol*/ 1e-6f));
+}
+
+TEST(Compile, F32Resnet50Stage2BlockArenaPlanning) {
+    graph::engine_t *eng = get_engine();
+
+    utils::id_generator id_gen;
+    graph::graph_t g(eng->kind());
+    utils::construct_f32_resnet50_stage2_block(
+            &g, id_gen, 3, /* use biasadd */ true);
+    g.finalize();
+
+    graph::pass::pass_base_ptr apass = get_pass("f32_resnet50_stage_2_fusion");
+    apass->run(g);
+    ASSERT_EQ(g.get_num_partitions(), 1U);
+    using partition_impl_t = graph::dnnl_impl::dnnl_partition_impl_t;
+    auto part = std::dynamic_pointer_cast<partition_impl_t>(
+            g.get_partitions()[0]);
+    ASSERT_TRUE(part);
+
+    std::vector<graph::logical_tensor_t> inputs = part->get_inputs();
+    std::vector<graph::logical_tensor_t> outputs;
+    for (const auto &lt : part->get_outputs())
+        outputs.emplace_back(utils::logical_tensor_init(
+                lt.id, lt.data_type, graph::layout_type::strided));
+
+    // The partition is compiled with the greedy buffer sharing, and then with
+    // the temporary buffers packed into one arena.
+    std::vector<size_t> scratchpad_sizes;
+    for (const char *arena_planning : {"0", "1"}) {
+#ifdef _WIN32
+        SetEnvironmentVariable("_ONEDNN_ENABLE_ARENA_PLANNING", arena_planning);
+#else
+        ::setenv("_ONEDNN_ENABLE_ARENA_PLANNING", arena_planning, 1);
+#endif
+        auto part_copy
+                = std::dynamic_pointer_cast<partition_impl_t>(part->clone());
+        auto kernel = graph::dnnl_impl::large_partition_kernel_creator();
+        std::vector<graph::logical_tensor_t> compiled_outputs = outputs;
+        ASSERT_EQ(kernel->compile(
+                          part_copy.get(), eng, inputs, compiled_outputs),
+                graph::status::success);
+        scratchpad_sizes.emplace_back(kernel->get_scratchpad_size());
+    }
+
+    ASSERT_GT(scratchpad_sizes[0], 0U);
+    ASSERT_LE(scratchpad_sizes[1], scratchpad_sizes[0]);
+}
+
 TEST(Execute, ItexInt8Resnet50Stage2Block) {
     graph::engine_t *eng = get_engine();
     graph::stream_t *strm = get_stream();
@@ -552,6 +679,108 @@ TEST(Execute, F32Mha) {
     strm->wait();
 }
 
+TEST(Execute, F32Sdp) {
+    graph::engine_t *eng = get_engine();
+    graph::stream_t *strm = get_stream();
+
+    // seq_len is not a multiple of the kernel tile sizes on purpose
+    const int mb = 2, nh = 2, sl = 300, hd = 32;
+    graph::graph_t g(eng->kind());
+    utils::construct_f32_sdp(&g, mb, nh, sl, hd);
+    g.finalize();
+
+    ASSERT_EQ(g.get_ops().size(), 5U);
+
+    graph::pass::pass_base_ptr apass = get_pass("float_sdp_fusion");
+    apass->run(g);
+    ASSERT_EQ(g.get_num_partitions(), 1U);
+    auto part = g.get_partitions()[0];
+
+    graph::partition_t p;
+    p.init(part);
+
+    auto partition_inputs = p.get_inputs();
+    auto partition_outputs = p.get_outputs();
+    ASSERT_EQ(partition_inputs.size(), 5U);
+    ASSERT_EQ(partition_outputs.size(), 1U);
+
+    std::vector<const graph::logical_tensor_t *> inputs, outputs;
+    for (auto &lt : partition_inputs) {
+        inputs.emplace_back(&lt);
+    }
+    for (auto &lt : partition_outputs) {
+        lt = utils::logical_tensor_init(
+                lt.id, lt.data_type, graph::layout_type::strided);
+        outputs.emplace_back(&lt);
+    }
+
+    graph::compiled_partition_t cp(p);
+    ASSERT_EQ(p.compile(&cp, inputs, outputs, eng), graph::status::success);
+
+    using ltw = graph::logical_tensor_wrapper_t;
+
+    // ids follow construct_f32_sdp()
+    const size_t mask_id = 0, q_id = 1, k_id = 2, scale_id = 4, v_id = 8;
+    const float scale = 8.f;
+    std::default_random_engine generator(7);
+    std::uniform_real_distribution<float> distribution(-1.f, 1.f);
+
+    std::map<size_t, test::vector<float>> data;
+    std::vector<graph::tensor_t> inputs_ts, outputs_ts;
+    for (auto &lt : inputs) {
+        auto &d = data[lt->id];
+        d.resize(utils::product(ltw(lt).vdims()));
+        if (lt->id == scale_id) {
+            d[0] = scale;
+        } else if (lt->id == mask_id) {
+            for (size_t i = 0; i < d.size(); i++)
+                d[i] = i % 7 == 0 ? -10000.f : 0.f;
+        } else {
+            std::generate(d.begin(), d.end(),
+                    [&]() { return distribution(generator); });
+        }
+        inputs_ts.emplace_back(*lt, eng, d.data());
+    }
+
+    graph::logical_tensor_t compiled_output;
+    cp.query_logical_tensor(outputs[0]->id, &compiled_output);
+    ASSERT_EQ(ltw(compiled_output).vdims(),
+            std::vector<int64_t>({mb, nh, sl, hd}));
+    test::vector<float> dst(utils::product(ltw(compiled_output).vdims()));
+    outputs_ts.emplace_back(compiled_output, eng, dst.data());
+
+    ASSERT_EQ(cp.execute(strm, inputs_ts, outputs_ts), graph::status::success);
+    strm->wait();
+
+    // naive reference: softmax(Q * K^T / scale + mask) * V
+    const auto &q = data[q_id], &k = data[k_id], &v = data[v_id];
+    const auto &mask = data[mask_id];
+    test::vector<float> ref(dst.size(), 0.f);
+    std::vector<float> s(sl);
+    for (int b = 0; b < mb * nh; b++) {
+        const size_t off = static_cast<size_t>(b) * sl * hd;
+        const float *m = mask.data() + static_cast<size_t>(b / nh) * sl;
+        for (int i = 0; i < sl; i++) {
+            float max = -INFINITY, sum = 0.f;
+            for (int j = 0; j < sl; j++) {
+                float acc = 0.f;
+                for (int x = 0; x < hd; x++)
+                    acc += q[off + i * hd + x] * k[off + j * hd + x];
+                s[j] = acc / scale + m[j];
+                max = std::max(max, s[j]);
+            }
+            for (int j = 0; j < sl; j++) {
+                s[j] = std::exp(s[j] - max);
+                sum += s[j];
+            }
+            for (int j = 0; j < sl; j++)
+                for (int x = 0; x < hd; x++)
+                    ref[off + i * hd + x] += s[j] / sum * v[off + j * hd + x];
+        }
+    }
+    ASSERT_TRUE(allclose(dst, ref, /*rtol*/ 1e-4f, /*atol*/ 1e-5f));
+}
+
 TEST(Execute, Int8Bf16Mha) {
     graph::engine_t *eng = get_engine();
     graph::stream_t *strm = get_stream();
@@ -37,3 +37,32 @@ TEST(MemoryPlanning, GetMemoryInfo) {
     graph::value_t val {op, 0, lt};
     ASSERT_NO_THROW(mp.get_memory_info(&val));
 }
+
+TEST(MemoryPlanning, ArenaPlanner) {
+    // id, size and live range of each buffer
+    dnnl_impl::arena_planner_t arena(64);
+    arena.add(0, 100, 0, 1);
+    arena.add(1, 200, 1, 2);
+    arena.add(2, 100, 2, 3);
+    arena.add(3, 50, 3, 3);
+
+    // 1 is placed first as the largest one. 0 and 2 are alive together with 1
+    // but not with each other, so they share the space above 1. 3 fits into
+    // the gap below 2.
+    ASSERT_EQ(arena.run(), 356U);
+    ASSERT_EQ(arena.size(), 356U);
+    ASSERT_EQ(arena.get_offset(1), 0U);
+    ASSERT_EQ(arena.get_offset(0), 256U);
+    ASSERT_EQ(arena.get_offset(2), 256U);
+    ASSERT_EQ(arena.get_offset(3), 0U);
+
+    dnnl_impl::registry_t registry;
+    dnnl_impl::registrar_t registrar = registry.registrar();
+    const size_t sizes[] = {100, 200, 100, 50};
+    for (size_t id = 0; id < 4; id++)
+        registrar.book_at(id, arena.get_offset(id), sizes[id]);
+    ASSERT_EQ(registry.get(0), 256U);
+    ASSERT_EQ(registry.get(3), 0U);
+    // the arena size plus the reserved space for alignment
+    ASSERT_EQ(registry.size(), 356U + 64U);
+}
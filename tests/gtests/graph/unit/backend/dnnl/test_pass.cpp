@@ -13728,6 +13728,22 @@ TEST(Pass, F32MhaFusion) {
     ASSERT_EQ(agraph.get_num_partitions(), 1U);
 }
 
+TEST(Pass, F32SdpFusion) {
+    dnnl::impl::graph::graph_t agraph;
+    dnnl::graph::tests::unit::utils::construct_f32_sdp(&agraph);
+    agraph.finalize();
+    ASSERT_EQ(agraph.get_ops().size(), 5U);
+
+    dnnl::impl::graph::pass::pass_base_ptr apass
+            = get_pass("float_sdp_fusion");
+    apass->run(agraph);
+    ASSERT_EQ(agraph.get_num_partitions(), 1U);
+    ASSERT_EQ(agraph.get_partitions()[0]->get_kind(),
+            dnnl::impl::graph::partition_kind_t::mha);
+    ASSERT_EQ(agraph.get_partitions()[0]->get_inputs().size(), 5U);
+    ASSERT_EQ(agraph.get_partitions()[0]->get_outputs().size(), 1U);
+}
+
 TEST(Pass, FuseReduceAdd) {
     /* reduce
           |
@@ -1156,6 +1156,67 @@ TEST(SubgraphPass, MemoryPlanning) {
     ASSERT_TRUE(mem_offkeys.empty());
 }
 
+TEST(SubgraphPass, GetOpLevels) {
+    /*
+          / -> op2 \
+    op1 -           -> op4     op5 (constant)
+          \ -> op3 /
+    */
+    graph::engine_t *g_eng = get_engine();
+    dnnl::engine p_eng = dnnl::impl::graph::dnnl_impl::make_dnnl_engine(*g_eng);
+
+    std::vector<int64_t> shape {8, 16};
+
+    graph::op_t op1(1, dnnl_impl::op_kind::dnnl_mul_scales, "op1");
+    graph::op_t op2(2, dnnl_impl::op_kind::dnnl_mul_scales, "op2");
+    graph::op_t op3(3, dnnl_impl::op_kind::dnnl_mul_scales, "op3");
+    graph::op_t op4(4, dnnl_impl::op_kind::dnnl_binary, "op4");
+    graph::op_t op5(5, dnnl_impl::op_kind::dnnl_mul_scales, "op5");
+    for (auto *op : {&op1, &op2, &op3, &op5})
+        op->set_attr<std::vector<float>>(op_attr::scales, {0.5});
+    op4.set_attr<int64_t>(dnnl_impl::op_attr::alg_kind,
+            static_cast<int64_t>(dnnl::algorithm::binary_add));
+    op5.set_attr<bool>(dnnl_impl::op_attr::is_constant, true);
+
+    std::vector<logical_tensor_t> vals;
+    for (size_t i = 0; i < 8; i++)
+        vals.emplace_back(
+                logical_tensor_init(i, shape, graph::data_type::f32));
+
+    op1.add_input(vals[0]);
+    op1.add_output(vals[1]);
+    op2.add_input(vals[1]);
+    op2.add_output(vals[2]);
+    op3.add_input(vals[1]);
+    op3.add_output(vals[3]);
+    op4.add_input(vals[2]);
+    op4.add_input(vals[3]);
+    op4.add_output(vals[4]);
+    op4.add_output(vals[7]);
+    op5.add_input(vals[5]);
+    op5.add_output(vals[6]);
+
+    graph::graph_t g;
+    g.add_op(&op1);
+    g.add_op(&op2);
+    g.add_op(&op3);
+    g.add_op(&op4);
+    g.add_op(&op5);
+    g.finalize();
+
+    auto subgraph = std::make_shared<dnnl_impl::subgraph_t>(
+            g.get_ops(), p_eng, /* reset_layout */ false);
+    ASSERT_EQ(subgraph->get_ops().size(), 5U);
+
+    auto levels = dnnl_impl::get_op_levels(subgraph);
+    ASSERT_EQ(levels.size(), 5U);
+    for (const auto &op_level : levels) {
+        const size_t id = op_level.first->get_id();
+        const size_t expected = id == 1 ? 1 : id == 4 ? 3 : id == 5 ? 0 : 2;
+        ASSERT_EQ(op_level.second, expected);
+    }
+}
+
 TEST(SubgraphPass, FusePostOpsForConvDepthwise) {
     /*   conv
           |
@@ -985,6 +985,74 @@ inline void construct_dnnl_f32_MHA(dnnl::impl::graph::graph_t *agraph,
     agraph->add_op(&reshape_output);
 }
 
+// Scaled dot-product attention without the output transpose and reshape:
+// MatMul(Q, K^T) -> Divide -> Add(mask) -> SoftMax -> MatMul(V).
+inline void construct_f32_sdp(dnnl::impl::graph::graph_t *agraph,
+        int batch_size = 1, int num_head = 16, int seq_len = 384,
+        int size_per_head = 64) {
+    using namespace dnnl::impl::graph;
+    using namespace dnnl::graph::tests;
+
+    dims ATTENTION_MASK_SHAPE = {batch_size, 1, 1, seq_len};
+    dims QKV_SHAPE = {batch_size, num_head, seq_len, size_per_head};
+    dims MATMUL_QK_OUTPUT_SHAPE = {batch_size, num_head, seq_len, seq_len};
+    dims CONST_SHAPE = {1};
+
+    size_t lt_id = 0;
+
+    auto attention_mask = unit::utils::logical_tensor_init(
+            lt_id++, ATTENTION_MASK_SHAPE, data_type::f32);
+    auto query_input = unit::utils::logical_tensor_init(
+            lt_id++, QKV_SHAPE, data_type::f32);
+    auto key_input = unit::utils::logical_tensor_init(
+            lt_id++, QKV_SHAPE, data_type::f32);
+    auto matmul_qk_out = unit::utils::logical_tensor_init(
+            lt_id++, MATMUL_QK_OUTPUT_SHAPE, data_type::f32);
+    auto fscore_scale = unit::utils::logical_tensor_init(
+            lt_id++, CONST_SHAPE, data_type::f32);
+    auto fscore_div_out = unit::utils::logical_tensor_init(
+            lt_id++, MATMUL_QK_OUTPUT_SHAPE, data_type::f32);
+    auto fscore_add_out = unit::utils::logical_tensor_init(
+            lt_id++, MATMUL_QK_OUTPUT_SHAPE, data_type::f32);
+    auto softmax_out = unit::utils::logical_tensor_init(
+            lt_id++, MATMUL_QK_OUTPUT_SHAPE, data_type::f32);
+    auto value_input = unit::utils::logical_tensor_init(
+            lt_id++, QKV_SHAPE, data_type::f32);
+    auto matmul_v_out = unit::utils::logical_tensor_init(
+            lt_id++, QKV_SHAPE, data_type::f32);
+
+    op_t matmul_qk {0, op_kind::MatMul, "matmul_qk"};
+    matmul_qk.set_attr(op_attr::transpose_b, true);
+    op_t fscore_div {1, op_kind::Divide, "fscore_div"};
+    fscore_div.set_attr(op_attr::auto_broadcast, std::string("numpy"));
+    op_t fscore_add {2, op_kind::Add, "fscore_add"};
+    fscore_add.set_attr(op_attr::auto_broadcast, std::string("numpy"));
+    op_t softmax {3, op_kind::SoftMax, "softmax"};
+    softmax.set_attr(op_attr::axis, (int64_t)3);
+    op_t matmul_v {4, op_kind::MatMul, "matmul_v"};
+
+    matmul_qk.add_input(query_input);
+    matmul_qk.add_input(key_input);
+    matmul_qk.add_output(matmul_qk_out);
+    fscore_div.add_input(matmul_qk_out);
+    fscore_div.add_input(fscore_scale);
+    fscore_div.add_output(fscore_div_out);
+    fscore_add.add_input(fscore_div_out);
+    fscore_add.add_input(attention_mask);
+    fscore_add.add_output(fscore_add_out);
+    softmax.add_input(fscore_add_out);
+    softmax.add_output(softmax_out);
+    matmul_v.add_input(softmax_out);
+    matmul_v.add_input(value_input);
+    matmul_v.add_output(matmul_v_out);
+
+    agraph->add_op(&matmul_qk);
+    agraph->add_op(&fscore_div);
+    agraph->add_op(&fscore_add);
+    agraph->add_op(&softmax);
+    agraph->add_op(&matmul_v);
+}
+
 inline void construct_int8_MHA(dnnl::impl::graph::graph_t *agraph,
         int batch_size = 1, int seq_len = 384, int num_head = 16,
         int head_dim = 1024) {
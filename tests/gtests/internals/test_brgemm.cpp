@@ -26,6 +26,8 @@
 
 #include "cpu/x64/amx_tile_configure.hpp"
 #include "cpu/x64/brgemm/brgemm.hpp"
+#include "cpu/x64/brgemm/brgemm_containers.hpp"
+#include "cpu/x64/jit_kernel_registry.hpp"
 
 namespace dnnl {
 
@@ -266,6 +268,70 @@ private:
     std::shared_ptr<test_memory> b_mem_reordered_;
 };
 
+TEST(brgemm_kernel_sharing_test, TestSameDescriptor) {
+    using namespace dnnl::impl::cpu::x64;
+
+    const auto create_desc = [](brgemm_t &desc, impl::dim_t N) {
+        return brgemm_desc_init(&desc, isa_undef, brgemm_addr, dnnl_f32,
+                dnnl_f32, false, false, brgemm_row_major, 1.f, 0.f, 16, N, N,
+                16, N, 16);
+    };
+
+    brgemm_t desc_a, desc_b, desc_c;
+    SKIP_IF(create_desc(desc_a, 16) != dnnl_success,
+            "brgemm is not supported on this platform.");
+    ASSERT_EQ(create_desc(desc_b, 16), dnnl_success);
+    ASSERT_EQ(create_desc(desc_c, 32), dnnl_success);
+
+    const size_t n_kernels = get_jit_kernel_registry_size();
+    brgemm_kernel_t *kernel_a, *kernel_b, *kernel_c;
+    ASSERT_EQ(brgemm_kernel_create(&kernel_a, desc_a), dnnl_success);
+    ASSERT_EQ(get_jit_kernel_registry_size(), n_kernels + 1);
+    // The same descriptor takes the kernel that already exists.
+    ASSERT_EQ(brgemm_kernel_create(&kernel_b, desc_b), dnnl_success);
+    ASSERT_EQ(get_jit_kernel_registry_size(), n_kernels + 1);
+    ASSERT_EQ(brgemm_kernel_create(&kernel_c, desc_c), dnnl_success);
+    ASSERT_EQ(get_jit_kernel_registry_size(), n_kernels + 2);
+
+    // A shared kernel is alive until the last user is destroyed.
+    brgemm_kernel_destroy(kernel_a);
+    ASSERT_EQ(get_jit_kernel_registry_size(), n_kernels + 2);
+    brgemm_kernel_destroy(kernel_b);
+    ASSERT_EQ(get_jit_kernel_registry_size(), n_kernels + 1);
+    brgemm_kernel_destroy(kernel_c);
+    ASSERT_EQ(get_jit_kernel_registry_size(), n_kernels);
+}
+
+TEST(brgemm_kernel_container_test, TestLazyKernels) {
+    using namespace dnnl::impl::cpu::x64;
+
+    const auto create_desc = [](brgemm_t &desc, impl::dim_t N) {
+        return brgemm_desc_init(&desc, isa_undef, brgemm_addr, dnnl_f32,
+                dnnl_f32, false, false, brgemm_row_major, 1.f, 0.f, 16, N, N,
+                16, N, 16);
+    };
+
+    brgemm_t desc_main, desc_tail;
+    SKIP_IF(create_desc(desc_main, 16) != dnnl_success,
+            "brgemm is not supported on this platform.");
+    ASSERT_EQ(create_desc(desc_tail, 7), dnnl_success);
+
+    brgemm_containers::brgemm_kernel_container_t kernels;
+    kernels.resize(2);
+    ASSERT_EQ(kernels.insert(0, desc_main), dnnl_success);
+    ASSERT_EQ(kernels.insert(1, desc_tail, true), dnnl_success);
+    ASSERT_EQ(kernels.num_registered(), 2);
+    ASSERT_EQ(kernels.num_materialized(), 1);
+
+    // The lazy kernel is generated once on the first use.
+    const brgemm_kernel_t *tail = kernels.get(1);
+    ASSERT_NE(tail, nullptr);
+    ASSERT_EQ(kernels.num_materialized(), 2);
+    ASSERT_EQ(kernels.get(1), tail);
+    ASSERT_EQ(kernels.num_materialized(), 2);
+    ASSERT_EQ(kernels.status(), dnnl_success);
+}
+
 TEST_P(brgemm_test_t, TestsBRGEMM) {}
 INSTANTIATE_TEST_SUITE_P(TestBRGEMMSimple, brgemm_test_t,
         ::testing::ValuesIn(params_creator_t().create_simple_brgemm_params()));
@@ -443,4 +443,66 @@ INST_TEST_CASE(EltwiseSimpleF32, all_cases, EXPAND_DTS(f32, f32, f32));
 INST_TEST_CASE(EltwiseSimpleBF16, all_cases, EXPAND_DTS(bf16, bf16, bf16));
 INST_TEST_CASE(EltwiseSimpleF16, all_cases, EXPAND_DTS(f16, f16, undef));
 INST_TEST_CASE(EltwiseSimpleU8, all_cases, EXPAND_DTS(u8, u8, undef));
+
+TEST(eltwise_dst_amax_test_t, TestLinear) {
+    auto eng = get_test_engine();
+    auto strm = make_stream(eng);
+
+    // The number of elements is not a multiple of the vector length, and the
+    // largest magnitude comes from the most negative destination value.
+    const float alpha = -2.f, beta = 1.f;
+    const memory::dims dims = {3, 37, 5, 7};
+    const memory::dim nelems = 3 * 37 * 5 * 7;
+    auto src_value = [](memory::dim i) {
+        return (float)((i * 37) % 201 - 90) / 8.f;
+    };
+
+    for (const auto data_dt : {dt::f32, dt::bf16}) {
+        SKIP_FOR_LOOP(unsupported_data_type(data_dt, eng),
+                "Engine does not support this data type.");
+        auto data_md = memory::desc(dims, data_dt, tag::nchw);
+        auto scalar_md = memory::desc({1}, dt::f32, tag::a);
+
+        primitive_attr attr;
+        attr.set_dst_amax(true);
+
+        eltwise_forward::primitive_desc eltwise_pd;
+        try {
+            eltwise_pd = eltwise_forward::primitive_desc(eng,
+                    prop_kind::forward_inference, algorithm::eltwise_linear,
+                    data_md, data_md, alpha, beta, attr);
+        } catch (error &e) {
+            if (e.status == dnnl_unimplemented)
+                GTEST_SKIP() << "Destination amax is not supported";
+            throw;
+        }
+
+        auto src_m = test::make_memory(data_md, eng);
+        auto dst_m = test::make_memory(data_md, eng);
+        auto dst_amax_m = test::make_memory(scalar_md, eng);
+        {
+            auto f32_m = test::make_memory(
+                    memory::desc(dims, dt::f32, tag::nchw), eng);
+            {
+                auto s = map_memory<float>(f32_m);
+                for (memory::dim i = 0; i < nelems; i++)
+                    s[i] = src_value(i);
+            }
+            reorder(f32_m, src_m).execute(strm, f32_m, src_m);
+            map_memory<float>(dst_amax_m)[0] = -1.f;
+        }
+
+        eltwise_forward(eltwise_pd)
+                .execute(strm,
+                        {{DNNL_ARG_SRC, src_m}, {DNNL_ARG_DST, dst_m},
+                                {DNNL_ARG_DST_AMAX, dst_amax_m}});
+        strm.wait();
+
+        float ref_amax = 0.f;
+        for (memory::dim i = 0; i < nelems; i++)
+            ref_amax = std::max(
+                    ref_amax, std::fabs(alpha * src_value(i) + beta));
+        ASSERT_EQ(map_memory<float>(dst_amax_m)[0], ref_amax);
+    }
+}
 } // namespace dnnl
@@ -15,6 +15,8 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <cstring>
+
 #include "dnnl_test_common.hpp"
 #include "gtest/gtest.h"
 
@@ -119,6 +121,85 @@ HANDLE_EXCEPTIONS_FOR_TEST_F(attr_test_t, TestScratchpadArg) {
     }
 }
 
+TEST_F(attr_test_t, TestRoundingMode) {
+    dnnl::primitive_attr attr;
+    for (auto arg : {DNNL_ARG_DST, DNNL_ARG_DIFF_WEIGHTS})
+        ASSERT_EQ(attr.get_rounding_mode(arg), rounding_mode::environment);
+
+    for (auto m : {rounding_mode::stochastic, rounding_mode::environment}) {
+        attr.set_rounding_mode(DNNL_ARG_DST, m);
+        ASSERT_EQ(m, attr.get_rounding_mode(DNNL_ARG_DST));
+        ASSERT_EQ(attr.get_rounding_mode(DNNL_ARG_DIFF_WEIGHTS),
+                rounding_mode::environment);
+    }
+}
+
+HANDLE_EXCEPTIONS_FOR_TEST_F(attr_test_t, TestStochasticRounding) {
+    auto engine_kind = get_test_engine_kind();
+    SKIP_IF(engine_kind != engine::kind::cpu,
+            "Stochastic rounding is only supported on CPU engine");
+
+    engine eng {engine_kind, 0};
+    stream s(eng);
+
+    // The value lies at a quarter of the distance between two neighboring
+    // bf16 values: 1.0f and 1.0f + 2^-7.
+    const memory::dim nelems = 8192;
+    const float lo = 1.f, hi = 1.f + 1.f / 128, val = 1.f + 1.f / 512;
+
+    memory::desc src_md({nelems}, data_type::f32, tag::a);
+    memory::desc dst_md({nelems}, data_type::bf16, tag::a);
+    memory::desc seed_md({1}, data_type::s32, tag::x);
+
+    dnnl::primitive_attr attr;
+    attr.set_rounding_mode(DNNL_ARG_DST, rounding_mode::stochastic);
+    auto reorder_pd = reorder::primitive_desc(eng, src_md, eng, dst_md, attr);
+
+    auto src = test::make_memory(src_md, eng);
+    auto seed = test::make_memory(seed_md, eng);
+    {
+        auto src_ptr = map_memory<float>(src);
+        for (memory::dim i = 0; i < nelems; i++)
+            src_ptr[i] = val;
+    }
+
+    auto run = [&](int32_t seed_val) {
+        {
+            auto seed_ptr = map_memory<int32_t>(seed);
+            seed_ptr[0] = seed_val;
+        }
+        auto dst = test::make_memory(dst_md, eng);
+        reorder(reorder_pd)
+                .execute(s,
+                        {{DNNL_ARG_FROM, src}, {DNNL_ARG_TO, dst},
+                                {DNNL_ARG_ATTR_ROUNDING_SEED, seed}});
+        s.wait();
+
+        std::vector<float> res(nelems);
+        auto dst_ptr = map_memory<uint16_t>(dst);
+        for (memory::dim i = 0; i < nelems; i++) {
+            const uint32_t bits = static_cast<uint32_t>(dst_ptr[i]) << 16;
+            std::memcpy(&res[i], &bits, sizeof(float));
+        }
+        return res;
+    };
+
+    const auto res0 = run(42);
+    const auto res1 = run(42);
+    const auto res2 = run(7);
+    ASSERT_EQ(res0, res1);
+    ASSERT_NE(res0, res2);
+
+    // Every value is rounded to one of the neighbors and the rounding is
+    // unbiased on average.
+    double sum = 0;
+    for (memory::dim i = 0; i < nelems; i++) {
+        ASSERT_TRUE(res0[i] == lo || res0[i] == hi);
+        sum += res0[i];
+    }
+    ASSERT_NEAR(sum / nelems, val, (hi - lo) / 16);
+}
+
 TEST_F(attr_test_t, TestZeroPoints) {
     dnnl::primitive_attr attr;
 
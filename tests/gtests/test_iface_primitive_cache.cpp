@@ -104,6 +104,132 @@ TEST(primitive_cache_test, TestCacheHit) {
 #endif
     ASSERT_EQ(get_primitive_cache_size(), 2);
 }
+
+TEST(primitive_cache_test, TestFootprint) {
+    set_primitive_cache_capacity(0);
+    set_primitive_cache_capacity(8);
+    ASSERT_EQ(get_primitive_cache_footprint(), 0u);
+
+    fill_primitive_cache(4);
+    const size_t footprint = get_primitive_cache_footprint();
+    ASSERT_GT(footprint, 0u);
+    ASSERT_EQ(get_primitive_cache_footprint(primitive::kind::eltwise),
+            footprint);
+    ASSERT_EQ(get_primitive_cache_footprint(primitive::kind::reorder), 0u);
+
+    set_primitive_cache_capacity(0);
+    ASSERT_EQ(get_primitive_cache_footprint(), 0u);
+}
+
+TEST(primitive_cache_test, TestMemoryLimit) {
+    ASSERT_EQ(get_primitive_cache_memory_limit(), 0u);
+
+    set_primitive_cache_capacity(0);
+    set_primitive_cache_capacity(16);
+    fill_primitive_cache(8);
+    ASSERT_EQ(get_primitive_cache_size(), 8);
+    const size_t footprint = get_primitive_cache_footprint();
+
+    // Shrinking the limit evicts the entries that don't fit.
+    set_primitive_cache_memory_limit(footprint / 2);
+    ASSERT_EQ(get_primitive_cache_memory_limit(), footprint / 2);
+    ASSERT_LT(get_primitive_cache_size(), 8);
+    ASSERT_LE(get_primitive_cache_footprint(), footprint / 2);
+
+    // New entries are added within the limit as well.
+    fill_primitive_cache(16);
+    ASSERT_LE(get_primitive_cache_footprint(), footprint / 2);
+
+    set_primitive_cache_memory_limit(0);
+    fill_primitive_cache(16);
+    ASSERT_EQ(get_primitive_cache_size(), 16);
+}
+
+TEST(primitive_cache_test, TestFootprintSharedKernels) {
+    using tag = memory::format_tag;
+    using dt = memory::data_type;
+
+    engine eng(get_test_engine_kind(), 0);
+    auto md = memory::desc({64, 64}, dt::f32, tag::ab);
+    // The primitives differ only in the scratchpad mode, so they have the
+    // same kernels that may be shared.
+    primitive_attr attr;
+    attr.set_scratchpad_mode(scratchpad_mode::user);
+    auto pd0 = matmul::primitive_desc(eng, md, md, md);
+    auto pd1 = matmul::primitive_desc(eng, md, md, md, attr);
+
+    set_primitive_cache_capacity(0);
+    set_primitive_cache_capacity(8);
+    {
+        matmul p0(pd0);
+        matmul p1(pd1);
+    }
+    const size_t footprint = get_primitive_cache_footprint();
+    ASSERT_EQ(get_primitive_cache_footprint(primitive::kind::matmul),
+            footprint);
+
+    set_primitive_cache_capacity(0);
+    set_primitive_cache_capacity(8);
+    { matmul p0(pd0); }
+    const size_t footprint0 = get_primitive_cache_footprint();
+
+    set_primitive_cache_capacity(0);
+    set_primitive_cache_capacity(8);
+    { matmul p1(pd1); }
+    const size_t footprint1 = get_primitive_cache_footprint();
+
+    // The shared brgemm kernels are counted once.
+    ASSERT_LE(footprint, footprint0 + footprint1);
+    if (std::string(pd0.impl_info_str()).find("brg") != std::string::npos)
+        ASSERT_LT(footprint, footprint0 + footprint1);
+
+    // The footprint of the remaining entry doesn't include the kernels that
+    // are no longer shared.
+    set_primitive_cache_capacity(0);
+    set_primitive_cache_capacity(8);
+    {
+        matmul p0(pd0);
+        matmul p1(pd1);
+    }
+    set_primitive_cache_capacity(1);
+    ASSERT_EQ(get_primitive_cache_footprint(), footprint1);
+}
+
+TEST(primitive_cache_test, TestStats) {
+    using tag = memory::format_tag;
+    using dt = memory::data_type;
+
+    set_primitive_cache_capacity(0);
+    set_primitive_cache_capacity(8);
+    reset_primitive_cache_stats();
+
+    engine eng(get_test_engine_kind(), 0);
+    std::vector<eltwise_forward::primitive_desc> pds;
+    for (int i = 0; i < 4; i++) {
+        auto md = memory::desc({i + 1, 1, 1, 1}, dt::f32, tag::nchw);
+        pds.emplace_back(eng, prop_kind::forward_inference,
+                algorithm::eltwise_relu, md, md, 0.f, 0.f);
+    }
+    for (int iter = 0; iter < 2; iter++)
+        for (const auto &pd : pds)
+            eltwise_forward p(pd);
+
+    auto stats = get_primitive_cache_stats(primitive::kind::eltwise);
+    ASSERT_EQ(stats.misses, 4u);
+    ASSERT_EQ(stats.hits, 4u);
+    ASSERT_EQ(stats.evictions, 0u);
+    ASSERT_GE(stats.creation_ms, 0.);
+    ASSERT_EQ(get_primitive_cache_stats(primitive::kind::reorder).misses, 0u);
+
+    set_primitive_cache_capacity(1);
+    stats = get_primitive_cache_stats();
+    ASSERT_EQ(stats.evictions, 3u);
+    ASSERT_GE(stats.misses, 4u);
+
+    reset_primitive_cache_stats();
+    stats = get_primitive_cache_stats();
+    ASSERT_EQ(stats.hits + stats.misses + stats.evictions, 0u);
+}
 #endif
 
 } // namespace dnnl
@@ -219,4 +219,100 @@ TEST(iface_sparse_test_t, TestSparseMemoryMapUnmap) {
     ASSERT_NO_THROW(mem.unmap_data(mapped_pointers, 2));
 }
 
+TEST(iface_sparse_test_t, TestSparseMatmul) {
+    engine eng = get_test_engine();
+
+    const bool is_unimplemented = (eng.get_kind() == engine::kind::gpu
+            || DNNL_CPU_RUNTIME == DNNL_RUNTIME_SYCL);
+    if (is_unimplemented) return;
+
+    // N is not a multiple of the vector length to exercise the tails.
+    const memory::dim M = 7, K = 13, N = 37;
+
+    // A dense matrix with about a quarter of non-zero entries, and the same
+    // matrix in the CSR encoding.
+    auto make_sparse = [](memory::dim rows, memory::dim cols,
+                               std::vector<float> &dense,
+                               std::vector<float> &values,
+                               std::vector<int> &indices,
+                               std::vector<int> &pointers) {
+        dense.assign(rows * cols, 0.f);
+        pointers.assign(1, 0);
+        for (memory::dim r = 0; r < rows; r++) {
+            // Leave one of the rows empty.
+            for (memory::dim c = 0; c < cols && r != 3; c++) {
+                if ((r * 3 + c * 5) % 4 != 0) continue;
+                const float v = (float)((r + c) % 7 - 3);
+                dense[r * cols + c] = v;
+                values.push_back(v);
+                indices.push_back((int)c);
+            }
+            pointers.push_back((int)values.size());
+        }
+    };
+
+    std::vector<float> dense_src(M * K), dense_wei(K * N);
+    for (memory::dim i = 0; i < M * K; i++)
+        dense_src[i] = (float)(i % 5 - 2);
+    for (memory::dim i = 0; i < K * N; i++)
+        dense_wei[i] = (float)(i % 9 - 4);
+
+    for (const bool is_src_sparse : {true, false}) {
+        std::vector<float> values;
+        std::vector<int> indices, pointers;
+        if (is_src_sparse)
+            make_sparse(M, K, dense_src, values, indices, pointers);
+        else
+            make_sparse(K, N, dense_wei, values, indices, pointers);
+        const memory::dim nnz = values.size();
+
+        auto src_md = is_src_sparse
+                ? memory::desc::csr({M, K}, dt::f32, nnz, dt::s32, dt::s32)
+                : memory::desc({M, K}, dt::f32, memory::format_tag::ab);
+        auto wei_md = is_src_sparse
+                ? memory::desc({K, N}, dt::f32, memory::format_tag::ab)
+                : memory::desc::csr({K, N}, dt::f32, nnz, dt::s32, dt::s32);
+        auto dst_md = memory::desc({M, N}, dt::f32, memory::format_tag::ab);
+
+        matmul::primitive_desc pd;
+        ASSERT_NO_THROW(
+                pd = matmul::primitive_desc(eng, src_md, wei_md, dst_md));
+        // The sparse descriptors are kept as is.
+        ASSERT_EQ(pd.src_desc(), src_md);
+        ASSERT_EQ(pd.weights_desc(), wei_md);
+
+        std::vector<void *> sparse_handles
+                = {values.data(), indices.data(), pointers.data()};
+        memory src_mem = is_src_sparse ? memory(src_md, eng, sparse_handles)
+                                       : memory(src_md, eng, dense_src.data());
+        memory wei_mem = is_src_sparse ? memory(wei_md, eng, dense_wei.data())
+                                       : memory(wei_md, eng, sparse_handles);
+        std::vector<float> dst(M * N, -1.f);
+        memory dst_mem(dst_md, eng, dst.data());
+
+        stream strm(eng);
+        matmul(pd).execute(strm,
+                {{DNNL_ARG_SRC, src_mem}, {DNNL_ARG_WEIGHTS, wei_mem},
+                        {DNNL_ARG_DST, dst_mem}});
+        strm.wait();
+
+        for (memory::dim m = 0; m < M; m++)
+            for (memory::dim n = 0; n < N; n++) {
+                float ref = 0.f;
+                for (memory::dim k = 0; k < K; k++)
+                    ref += dense_src[m * K + k] * dense_wei[k * N + n];
+                // All the values are small integers, so the result is exact.
+                ASSERT_EQ(dst[m * N + n], ref);
+            }
+    }
+
+    // Both inputs can't be sparse.
+    {
+        auto src_md = memory::desc::csr({M, K}, dt::f32, 1, dt::s32, dt::s32);
+        auto wei_md = memory::desc::csr({K, N}, dt::f32, 1, dt::s32, dt::s32);
+        auto dst_md = memory::desc({M, N}, dt::f32, memory::format_tag::ab);
+        EXPECT_ANY_THROW(matmul::primitive_desc(eng, src_md, wei_md, dst_md));
+    }
+}
+
 } // namespace dnnl
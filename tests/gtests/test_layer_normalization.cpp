@@ -456,4 +456,79 @@ CPU_INST_TEST_CASE(LnormSimpleBF16F32, EXPAND_DTS(bf16, f32, bf16))
 CPU_INST_TEST_CASE(LnormSimpleF32S8, EXPAND_DTS(f32, s8, undef))
 CPU_INST_TEST_CASE(LnormSimpleBF16U8, EXPAND_DTS(bf16, u8, undef))
 
+TEST(lnorm_dst_zero_point_test_t, TestS8U8) {
+    using tag = memory::format_tag;
+    using dt = memory::data_type;
+    auto eng = get_test_engine();
+    auto strm = make_stream(eng);
+
+    // The normalized axis length is not a multiple of the vector length.
+    const memory::dim N = 4, C = 45;
+    const float src_scale = 0.5f, dst_scale = 1.f / 32.f;
+    const int32_t dst_zp = 128;
+    auto src_value = [&](memory::dim n, memory::dim c) {
+        return (int8_t)((n * 7 + c * 13) % 61 - 30);
+    };
+
+    auto src_md = memory::desc({N, C}, dt::s8, tag::nc);
+    auto dst_md = memory::desc({N, C}, dt::u8, tag::nc);
+    auto scale_md = memory::desc({1}, dt::f32, tag::a);
+    auto zp_md = memory::desc({1}, dt::s32, tag::a);
+
+    primitive_attr attr;
+    attr.set_scales_mask(DNNL_ARG_SRC, 0);
+    attr.set_scales_mask(DNNL_ARG_DST, 0);
+    attr.set_zero_points_mask(DNNL_ARG_DST, 0);
+
+    layer_normalization_forward::primitive_desc lnorm_pd;
+    try {
+        lnorm_pd = layer_normalization_forward::primitive_desc(eng,
+                prop_kind::forward_inference, src_md, dst_md, epsilon,
+                normalization_flags::none, attr);
+    } catch (error &e) {
+        if (e.status == dnnl_unimplemented)
+            GTEST_SKIP() << "Destination zero point is not supported";
+        throw;
+    }
+
+    auto src_m = test::make_memory(src_md, eng);
+    auto dst_m = test::make_memory(dst_md, eng);
+    auto src_scale_m = test::make_memory(scale_md, eng);
+    auto dst_scale_m = test::make_memory(scale_md, eng);
+    auto zp_m = test::make_memory(zp_md, eng);
+    {
+        auto s = map_memory<int8_t>(src_m);
+        for (memory::dim n = 0; n < N; n++)
+            for (memory::dim c = 0; c < C; c++)
+                s[n * C + c] = src_value(n, c);
+        map_memory<float>(src_scale_m)[0] = src_scale;
+        map_memory<float>(dst_scale_m)[0] = dst_scale;
+        map_memory<int32_t>(zp_m)[0] = dst_zp;
+    }
+
+    layer_normalization_forward(lnorm_pd).execute(strm,
+            {{DNNL_ARG_SRC, src_m}, {DNNL_ARG_DST, dst_m},
+                    {DNNL_ARG_ATTR_SCALES | DNNL_ARG_SRC, src_scale_m},
+                    {DNNL_ARG_ATTR_SCALES | DNNL_ARG_DST, dst_scale_m},
+                    {DNNL_ARG_ATTR_ZERO_POINTS | DNNL_ARG_DST, zp_m}});
+    strm.wait();
+
+    auto d = map_memory<uint8_t>(dst_m);
+    for (memory::dim n = 0; n < N; n++) {
+        float mean = 0.f, var = 0.f;
+        for (memory::dim c = 0; c < C; c++)
+            mean += src_value(n, c);
+        mean /= C;
+        for (memory::dim c = 0; c < C; c++)
+            var += (src_value(n, c) - mean) * (src_value(n, c) - mean);
+        var /= C;
+        for (memory::dim c = 0; c < C; c++) {
+            const float norm
+                    = (src_value(n, c) - mean) / std::sqrt(var + epsilon);
+            const float ref = norm * src_scale / dst_scale + dst_zp;
+            ASSERT_NEAR((float)d[n * C + c], ref, 1.f);
+        }
+    }
+}
+
 } // namespace dnnl
@@ -18,6 +18,7 @@
 #include "gtest/gtest.h"
 
 #include "oneapi/dnnl/dnnl.hpp"
+#include "tests/test_isa_common.hpp"
 
 #include <vector>
 
@@ -668,4 +669,749 @@ INSTANTIATE_TEST_SUITE_P(TensorDims, attr_test_t,
                         memory::dims {2, 10, 10, 10}, tag::abcd,
                         memory::data_type::f16, 4)));
 
+// Returns true if a CPU engine is expected to implement a matmul feature that
+// requires the `isa` instructions.
+bool is_matmul_feature_supported(const engine &eng, cpu_isa isa) {
+#if DNNL_X64 && (DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE)
+    return eng.get_kind() == engine::kind::cpu && mayiuse(isa);
+#else
+    return false;
+#endif
+}
+
+// Creates a primitive descriptor for a matmul feature implemented on CPUs with
+// the `isa` instructions. The creation must succeed on such CPUs, elsewhere
+// the feature may be unimplemented, which is reported by returning false.
+bool create_matmul_pd(matmul::primitive_desc &pd, const engine &eng,
+        const memory::desc &src_md, const memory::desc &wei_md,
+        const memory::desc &dst_md, const primitive_attr &attr, cpu_isa isa) {
+    try {
+        pd = matmul::primitive_desc(eng, src_md, wei_md, dst_md, attr);
+    } catch (error &e) {
+        if (e.status == dnnl_unimplemented
+                && !is_matmul_feature_supported(eng, isa))
+            return false;
+        throw;
+    }
+    return true;
+}
+
+// A single primitive with runtime M is executed with different M values to
+// check that the kernels generated for the nominal M handle any M.
+TEST(matmul_runtime_m_test_t, TestReuseAcrossM) {
+    auto eng = get_test_engine();
+    auto strm = make_stream(eng);
+
+    const memory::dim K = 35, N = 47;
+    const memory::dim M_values[] = {1, 17, 64, 65, 130, 7, 33};
+
+    auto src_md = memory::desc(
+            {DNNL_RUNTIME_DIM_VAL, K}, memory::data_type::f32, tag::ab);
+    auto wei_md = memory::desc({K, N}, memory::data_type::f32, tag::ab);
+    auto dst_md = memory::desc(
+            {DNNL_RUNTIME_DIM_VAL, N}, memory::data_type::f32, tag::ab);
+
+    // The reference implementation supports runtime dimensions on any CPU.
+    matmul::primitive_desc matmul_pd;
+    if (!create_matmul_pd(matmul_pd, eng, src_md, wei_md, dst_md,
+                primitive_attr(), cpu_isa::sse41))
+        GTEST_SKIP() << "Runtime M is not supported";
+    auto matmul_p = matmul(matmul_pd);
+
+    auto wei_m = test::make_memory(wei_md, eng);
+    {
+        auto w = map_memory<float>(wei_m);
+        for (memory::dim i = 0; i < K * N; i++)
+            w[i] = (float)((i * 7) % 11 - 5);
+    }
+
+    for (const memory::dim M : M_values) {
+        auto src_m = test::make_memory(
+                {{M, K}, memory::data_type::f32, tag::ab}, eng);
+        auto dst_m = test::make_memory(
+                {{M, N}, memory::data_type::f32, tag::ab}, eng);
+        {
+            auto s = map_memory<float>(src_m);
+            for (memory::dim i = 0; i < M * K; i++)
+                s[i] = (float)((i * 5) % 9 - 4);
+        }
+
+        matmul_p.execute(strm,
+                {{DNNL_ARG_SRC, src_m}, {DNNL_ARG_WEIGHTS, wei_m},
+                        {DNNL_ARG_DST, dst_m}});
+        strm.wait();
+
+        auto s = map_memory<float>(src_m);
+        auto w = map_memory<float>(wei_m);
+        auto d = map_memory<float>(dst_m);
+        for (memory::dim m = 0; m < M; m++)
+            for (memory::dim n = 0; n < N; n++) {
+                float ref = 0.f;
+                for (memory::dim k = 0; k < K; k++)
+                    ref += s[m * K + k] * w[k * N + n];
+                // All the values are small integers, so the result is exact.
+                ASSERT_EQ(d[m * N + n], ref) << "M: " << M << " m: " << m
+                                             << " n: " << n;
+            }
+    }
+}
+
+TEST(matmul_zero_blocks_test_t, TestPrunedWeights) {
+    auto eng = get_test_engine();
+    auto strm = make_stream(eng);
+
+    const memory::dim M = 5, K = 1024, N = 80;
+    auto src_md = memory::desc({M, K}, memory::data_type::f32, tag::ab);
+    auto wei_md = memory::desc({K, N}, memory::data_type::f32, tag::ab);
+    auto bia_md = memory::desc({1, N}, memory::data_type::f32, tag::ab);
+    auto dst_md = memory::desc({M, N}, memory::data_type::f32, tag::ab);
+
+    auto matmul_pd
+            = matmul::primitive_desc(eng, src_md, wei_md, bia_md, dst_md);
+    auto matmul_p = matmul(matmul_pd);
+
+    auto src_m = test::make_memory(src_md, eng);
+    auto wei_m = test::make_memory(wei_md, eng);
+    auto bia_m = test::make_memory(bia_md, eng);
+    auto dst_m = test::make_memory(dst_md, eng);
+    {
+        auto s = map_memory<float>(src_m);
+        for (memory::dim i = 0; i < M * K; i++)
+            s[i] = (float)((i * 5) % 9 - 4);
+        auto b = map_memory<float>(bia_m);
+        for (memory::dim n = 0; n < N; n++)
+            b[n] = (float)(n % 3 - 1);
+    }
+
+    // The first case has only a few non-zero rows of the weights, so most of
+    // the blocks are skipped. The second one has no non-zero values at all,
+    // so the result is defined by the bias only.
+    for (const bool all_zeros : {false, true}) {
+        {
+            auto w = map_memory<float>(wei_m);
+            for (memory::dim k = 0; k < K; k++)
+                for (memory::dim n = 0; n < N; n++) {
+                    const bool is_zero = all_zeros || (k > 8 && k < K - 8);
+                    w[k * N + n] = is_zero ? 0.f : (float)((k + n) % 7 - 3);
+                }
+        }
+
+        matmul_p.execute(strm,
+                {{DNNL_ARG_SRC, src_m}, {DNNL_ARG_WEIGHTS, wei_m},
+                        {DNNL_ARG_BIAS, bia_m}, {DNNL_ARG_DST, dst_m}});
+        strm.wait();
+
+        auto s = map_memory<float>(src_m);
+        auto w = map_memory<float>(wei_m);
+        auto b = map_memory<float>(bia_m);
+        auto d = map_memory<float>(dst_m);
+        for (memory::dim m = 0; m < M; m++)
+            for (memory::dim n = 0; n < N; n++) {
+                float ref = b[n];
+                for (memory::dim k = 0; k < K; k++)
+                    ref += s[m * K + k] * w[k * N + n];
+                // All the values are small integers, so the result is exact.
+                ASSERT_EQ(d[m * N + n], ref) << "all_zeros: " << all_zeros
+                                             << " m: " << m << " n: " << n;
+            }
+    }
+}
+
+TEST(matmul_int4_weights_test_t, TestDecompression) {
+    auto eng = get_test_engine();
+    auto strm = make_stream(eng);
+
+    // N has a tail with respect to the copy routine blocking.
+    const memory::dim M = 3, K = 37, N = 50;
+    for (const auto wei_dt : {memory::data_type::s4, memory::data_type::u4}) {
+        auto src_md = memory::desc({M, K}, memory::data_type::f32, tag::ab);
+        auto wei_md = memory::desc({K, N}, wei_dt, tag::ab);
+        auto dst_md = memory::desc({M, N}, memory::data_type::f32, tag::ab);
+
+        matmul::primitive_desc matmul_pd;
+        if (!create_matmul_pd(matmul_pd, eng, src_md, wei_md, dst_md,
+                    primitive_attr(), cpu_isa::avx512_core))
+            GTEST_SKIP() << "4-bit weights are not supported";
+        auto matmul_p = matmul(matmul_pd);
+
+        // Two values share a byte, the first one is in the lower half.
+        ASSERT_EQ(wei_md.get_size(), (size_t)(K * N / 2));
+
+        const bool is_signed = wei_dt == memory::data_type::s4;
+        auto wei_value = [&](memory::dim i) {
+            const int v = (int)((i * 7) % 16);
+            return is_signed ? v - 8 : v;
+        };
+
+        auto src_m = test::make_memory(src_md, eng);
+        auto wei_m = test::make_memory(wei_md, eng);
+        auto dst_m = test::make_memory(dst_md, eng);
+        {
+            auto s = map_memory<float>(src_m);
+            for (memory::dim i = 0; i < M * K; i++)
+                s[i] = (float)((i * 5) % 9 - 4);
+            auto w = map_memory<uint8_t>(wei_m);
+            for (memory::dim i = 0; i < K * N / 2; i++)
+                w[i] = (uint8_t)((wei_value(2 * i) & 0xf)
+                        | ((wei_value(2 * i + 1) & 0xf) << 4));
+        }
+
+        matmul_p.execute(strm,
+                {{DNNL_ARG_SRC, src_m}, {DNNL_ARG_WEIGHTS, wei_m},
+                        {DNNL_ARG_DST, dst_m}});
+        strm.wait();
+
+        auto s = map_memory<float>(src_m);
+        auto d = map_memory<float>(dst_m);
+        for (memory::dim m = 0; m < M; m++)
+            for (memory::dim n = 0; n < N; n++) {
+                float ref = 0.f;
+                for (memory::dim k = 0; k < K; k++)
+                    ref += s[m * K + k] * (float)wei_value(k * N + n);
+                // All the values are small integers, so the result is exact.
+                ASSERT_EQ(d[m * N + n], ref) << "signed: " << is_signed
+                                             << " m: " << m << " n: " << n;
+            }
+    }
+}
+
+TEST(matmul_f8_weights_test_t, TestDecompression) {
+    auto eng = get_test_engine();
+    auto strm = make_stream(eng);
+
+    // The source is an identity matrix, so the destination holds the
+    // up-converted weights. Every encoding of the 8-bit types is used, N has
+    // a tail with respect to the copy routine blocking.
+    const memory::dim K = 16, M = K, N = 20;
+
+    // Decodes an 8-bit float with the given exponent width and bias, the
+    // encodings with all the exponent bits set are not used.
+    auto decode = [](uint8_t v, int exp_bits, int bias) {
+        const int mant_bits = 7 - exp_bits;
+        const int e = (v & 0x7f) >> mant_bits;
+        const int m = v & ((1 << mant_bits) - 1);
+        const float f = e == 0
+                ? std::ldexp((float)m, 1 - bias - mant_bits)
+                : std::ldexp((float)(m + (1 << mant_bits)),
+                        e - bias - mant_bits);
+        return v & 0x80 ? -f : f;
+    };
+
+    for (const auto src_dt : {memory::data_type::f32, memory::data_type::bf16})
+        for (const auto wei_dt :
+                {memory::data_type::f8_e5m2, memory::data_type::f8_e4m3}) {
+            const bool is_e5m2 = wei_dt == memory::data_type::f8_e5m2;
+            const int exp_bits = is_e5m2 ? 5 : 4;
+            const int bias = is_e5m2 ? 15 : 7;
+            // Infinities and NaNs would spread to the whole column.
+            auto wei_value = [&](memory::dim i) {
+                const uint8_t v = (uint8_t)(i % 256);
+                const bool is_special = is_e5m2 ? (v & 0x7c) == 0x7c
+                                                : (v & 0x7f) == 0x7f;
+                return is_special ? (uint8_t)0 : v;
+            };
+
+            auto src_md = memory::desc({M, K}, src_dt, tag::ab);
+            auto wei_md = memory::desc({K, N}, wei_dt, tag::ab);
+            auto dst_md = memory::desc({M, N}, memory::data_type::f32, tag::ab);
+
+            const auto isa = src_dt == memory::data_type::bf16
+                    ? cpu_isa::avx512_core_bf16
+                    : cpu_isa::avx512_core;
+            matmul::primitive_desc matmul_pd;
+            if (!create_matmul_pd(matmul_pd, eng, src_md, wei_md, dst_md,
+                        primitive_attr(), isa))
+                GTEST_SKIP() << "8-bit floating-point weights are not "
+                                "supported";
+            auto matmul_p = matmul(matmul_pd);
+
+            auto src_f32_md
+                    = memory::desc({M, K}, memory::data_type::f32, tag::ab);
+            auto src_f32_m = test::make_memory(src_f32_md, eng);
+            auto src_m = test::make_memory(src_md, eng);
+            auto wei_m = test::make_memory(wei_md, eng);
+            auto dst_m = test::make_memory(dst_md, eng);
+            {
+                auto s = map_memory<float>(src_f32_m);
+                for (memory::dim m = 0; m < M; m++)
+                    for (memory::dim k = 0; k < K; k++)
+                        s[m * K + k] = m == k ? 1.f : 0.f;
+                auto w = map_memory<uint8_t>(wei_m);
+                for (memory::dim i = 0; i < K * N; i++)
+                    w[i] = wei_value(i);
+            }
+            reorder(src_f32_m, src_m).execute(strm, src_f32_m, src_m);
+
+            matmul_p.execute(strm,
+                    {{DNNL_ARG_SRC, src_m}, {DNNL_ARG_WEIGHTS, wei_m},
+                            {DNNL_ARG_DST, dst_m}});
+            strm.wait();
+
+            auto d = map_memory<float>(dst_m);
+            for (memory::dim m = 0; m < M; m++)
+                for (memory::dim n = 0; n < N; n++) {
+                    const float ref
+                            = decode(wei_value(m * N + n), exp_bits, bias);
+                    ASSERT_EQ(d[m * N + n], ref)
+                            << "e5m2: " << is_e5m2 << " m: " << m
+                            << " n: " << n;
+                }
+        }
+}
+
+TEST(matmul_int8_weights_test_t, TestWeightsOnlyQuantization) {
+    auto eng = get_test_engine();
+    auto strm = make_stream(eng);
+
+    // The floating-point source stays as is, the int8 weights are
+    // decompressed and the per-column scales are applied to the result. The
+    // u8 weights have a common zero point. N has a tail with respect to the
+    // copy routine blocking.
+    const memory::dim M = 5, K = 64, N = 40;
+    const int wei_zp = 128;
+    auto src_value = [](memory::dim i) { return (float)((i * 5) % 9 - 4); };
+    auto wei_value = [](memory::dim i) { return (int)((i * 7) % 255) - 127; };
+    auto scale_value = [](memory::dim n) { return (float)(n % 4 + 1) / 4; };
+
+    for (const auto src_dt : {memory::data_type::bf16, memory::data_type::f16})
+        for (const auto wei_dt :
+                {memory::data_type::s8, memory::data_type::u8}) {
+            const bool is_u8 = wei_dt == memory::data_type::u8;
+            auto src_md = memory::desc({M, K}, src_dt, tag::ab);
+            auto wei_md = memory::desc({K, N}, wei_dt, tag::ab);
+            auto dst_md = memory::desc({M, N}, memory::data_type::f32, tag::ab);
+            auto scales_md = memory::desc({N}, memory::data_type::f32, tag::a);
+            auto zp_md = memory::desc({1}, memory::data_type::s32, tag::a);
+
+            primitive_attr attr;
+            attr.set_scales_mask(DNNL_ARG_WEIGHTS, 1 << 1);
+            if (is_u8) attr.set_zero_points_mask(DNNL_ARG_WEIGHTS, 0);
+
+            // Not every source data type is supported on every CPU.
+            const auto isa = src_dt == memory::data_type::bf16
+                    ? cpu_isa::avx512_core_bf16
+                    : cpu_isa::avx512_core_fp16;
+            matmul::primitive_desc matmul_pd;
+            if (!create_matmul_pd(
+                        matmul_pd, eng, src_md, wei_md, dst_md, attr, isa))
+                continue;
+            auto matmul_p = matmul(matmul_pd);
+
+            auto src_f32_md
+                    = memory::desc({M, K}, memory::data_type::f32, tag::ab);
+            auto src_f32_m = test::make_memory(src_f32_md, eng);
+            auto src_m = test::make_memory(src_md, eng);
+            auto wei_m = test::make_memory(wei_md, eng);
+            auto dst_m = test::make_memory(dst_md, eng);
+            auto scales_m = test::make_memory(scales_md, eng);
+            auto zp_m = test::make_memory(zp_md, eng);
+            {
+                auto s = map_memory<float>(src_f32_m);
+                for (memory::dim i = 0; i < M * K; i++)
+                    s[i] = src_value(i);
+                auto w = map_memory<uint8_t>(wei_m);
+                for (memory::dim i = 0; i < K * N; i++)
+                    w[i] = (uint8_t)(wei_value(i) + (is_u8 ? wei_zp : 0));
+                auto sc = map_memory<float>(scales_m);
+                for (memory::dim n = 0; n < N; n++)
+                    sc[n] = scale_value(n);
+                auto z = map_memory<int32_t>(zp_m);
+                z[0] = wei_zp;
+            }
+            reorder(src_f32_m, src_m).execute(strm, src_f32_m, src_m);
+
+            std::unordered_map<int, memory> args = {{DNNL_ARG_SRC, src_m},
+                    {DNNL_ARG_WEIGHTS, wei_m}, {DNNL_ARG_DST, dst_m},
+                    {DNNL_ARG_ATTR_SCALES | DNNL_ARG_WEIGHTS, scales_m}};
+            if (is_u8)
+                args.insert(
+                        {DNNL_ARG_ATTR_ZERO_POINTS | DNNL_ARG_WEIGHTS, zp_m});
+            matmul_p.execute(strm, args);
+            strm.wait();
+
+            auto d = map_memory<float>(dst_m);
+            for (memory::dim m = 0; m < M; m++)
+                for (memory::dim n = 0; n < N; n++) {
+                    float acc = 0.f;
+                    for (memory::dim k = 0; k < K; k++)
+                        acc += src_value(m * K + k) * wei_value(k * N + n);
+                    // The products are small integers, so the result is
+                    // exact.
+                    ASSERT_EQ(d[m * N + n], acc * scale_value(n))
+                            << "u8: " << is_u8 << " m: " << m << " n: " << n;
+                }
+        }
+}
+
+TEST(matmul_int4_weights_test_t, TestGroupedScalesAndZeroPoints) {
+    auto eng = get_test_engine();
+    auto strm = make_stream(eng);
+
+    // The scales and zero points are shared by groups of G rows of the
+    // weights, each column has its own values.
+    const memory::dim M = 3, K = 96, N = 48, G = 32;
+    const int wei_mask = (1 << 0) | (1 << 1);
+    auto src_md = memory::desc({M, K}, memory::data_type::f32, tag::ab);
+    auto wei_md = memory::desc({K, N}, memory::data_type::u4, tag::ab);
+    auto dst_md = memory::desc({M, N}, memory::data_type::f32, tag::ab);
+    auto scales_md
+            = memory::desc({K / G, N}, memory::data_type::f32, tag::ab);
+    auto zp_md = memory::desc({K / G, N}, memory::data_type::u4, tag::ab);
+
+    primitive_attr attr;
+    attr.set_scales(DNNL_ARG_WEIGHTS, wei_mask, {G, 1});
+    attr.set_zero_points(
+            DNNL_ARG_WEIGHTS, wei_mask, {G, 1}, memory::data_type::u4);
+
+    matmul::primitive_desc matmul_pd;
+    if (!create_matmul_pd(matmul_pd, eng, src_md, wei_md, dst_md, attr,
+                cpu_isa::avx512_core))
+        GTEST_SKIP() << "Grouped weights parameters are not supported";
+    auto matmul_p = matmul(matmul_pd);
+
+    auto wei_value = [](memory::dim i) { return (int)((i * 7) % 16); };
+    auto zp_value = [](memory::dim i) { return (int)((i * 3) % 16); };
+    auto scale_value = [](memory::dim i) { return (float)(i % 4 + 1) / 2; };
+
+    auto src_m = test::make_memory(src_md, eng);
+    auto wei_m = test::make_memory(wei_md, eng);
+    auto dst_m = test::make_memory(dst_md, eng);
+    auto scales_m = test::make_memory(scales_md, eng);
+    auto zp_m = test::make_memory(zp_md, eng);
+    {
+        auto s = map_memory<float>(src_m);
+        for (memory::dim i = 0; i < M * K; i++)
+            s[i] = (float)((i * 5) % 9 - 4);
+        auto w = map_memory<uint8_t>(wei_m);
+        for (memory::dim i = 0; i < K * N / 2; i++)
+            w[i] = (uint8_t)(wei_value(2 * i) | (wei_value(2 * i + 1) << 4));
+        auto z = map_memory<uint8_t>(zp_m);
+        for (memory::dim i = 0; i < K / G * N / 2; i++)
+            z[i] = (uint8_t)(zp_value(2 * i) | (zp_value(2 * i + 1) << 4));
+        auto sc = map_memory<float>(scales_m);
+        for (memory::dim i = 0; i < K / G * N; i++)
+            sc[i] = scale_value(i);
+    }
+
+    matmul_p.execute(strm,
+            {{DNNL_ARG_SRC, src_m}, {DNNL_ARG_WEIGHTS, wei_m},
+                    {DNNL_ARG_DST, dst_m},
+                    {DNNL_ARG_ATTR_SCALES | DNNL_ARG_WEIGHTS, scales_m},
+                    {DNNL_ARG_ATTR_ZERO_POINTS | DNNL_ARG_WEIGHTS, zp_m}});
+    strm.wait();
+
+    auto s = map_memory<float>(src_m);
+    auto d = map_memory<float>(dst_m);
+    for (memory::dim m = 0; m < M; m++)
+        for (memory::dim n = 0; n < N; n++) {
+            float ref = 0.f;
+            for (memory::dim k = 0; k < K; k++) {
+                const memory::dim g_idx = k / G * N + n;
+                const float w = (float)(wei_value(k * N + n) - zp_value(g_idx))
+                        * scale_value(g_idx);
+                ref += s[m * K + k] * w;
+            }
+            // The scales are powers of two multiplied by small integers, so
+            // the result is exact.
+            ASSERT_EQ(d[m * N + n], ref) << " m: " << m << " n: " << n;
+        }
+}
+
+TEST(matmul_src_dyn_quant_test_t, TestRowScales) {
+    auto eng = get_test_engine();
+    auto strm = make_stream(eng);
+
+    // The rows of the source have different ranges and K has a tail with
+    // respect to the copy routine blocking.
+    const memory::dim M = 5, K = 100, N = 40;
+    auto src_md = memory::desc({M, K}, memory::data_type::f32, tag::ab);
+    auto wei_md = memory::desc({K, N}, memory::data_type::s8, tag::ab);
+    auto dst_md = memory::desc({M, N}, memory::data_type::f32, tag::ab);
+
+    primitive_attr attr;
+    attr.set_src_dyn_quant_params(memory::data_type::s8);
+    ASSERT_EQ(attr.get_src_dyn_quant_params(), memory::data_type::s8);
+
+    matmul::primitive_desc matmul_pd;
+    if (!create_matmul_pd(matmul_pd, eng, src_md, wei_md, dst_md, attr,
+                cpu_isa::avx512_core_vnni))
+        GTEST_SKIP() << "Dynamic quantization of the source is not "
+                        "supported";
+    auto matmul_p = matmul(matmul_pd);
+
+    // Every row reaches 127 times a power of two, so the scale of the row is
+    // exact and the quantized values match the integers the row is made of.
+    auto src_int_value = [&](memory::dim m, memory::dim k) {
+        return k == (m * 17) % K ? 127 : (int)((m * K + k) * 37 % 255) - 127;
+    };
+    auto row_scale = [](memory::dim m) { return std::ldexp(1.f, 2 - (int)m); };
+    auto wei_value = [](memory::dim i) { return (int)((i * 7) % 11) - 5; };
+
+    auto src_m = test::make_memory(src_md, eng);
+    auto wei_m = test::make_memory(wei_md, eng);
+    auto dst_m = test::make_memory(dst_md, eng);
+    {
+        auto s = map_memory<float>(src_m);
+        for (memory::dim m = 0; m < M; m++)
+            for (memory::dim k = 0; k < K; k++)
+                s[m * K + k] = src_int_value(m, k) * row_scale(m);
+        auto w = map_memory<int8_t>(wei_m);
+        for (memory::dim i = 0; i < K * N; i++)
+            w[i] = (int8_t)wei_value(i);
+    }
+
+    matmul_p.execute(strm,
+            {{DNNL_ARG_SRC, src_m}, {DNNL_ARG_WEIGHTS, wei_m},
+                    {DNNL_ARG_DST, dst_m}});
+    strm.wait();
+
+    auto d = map_memory<float>(dst_m);
+    for (memory::dim m = 0; m < M; m++)
+        for (memory::dim n = 0; n < N; n++) {
+            int acc = 0;
+            for (memory::dim k = 0; k < K; k++)
+                acc += src_int_value(m, k) * wei_value(k * N + n);
+            ASSERT_EQ(d[m * N + n], acc * row_scale(m))
+                    << " m: " << m << " n: " << n;
+        }
+}
+
+TEST(matmul_paged_weights_test_t, TestPageTable) {
+    auto eng = get_test_engine();
+    auto strm = make_stream(eng);
+
+    // The row-major weights are paged along K and the column-major ones along
+    // N, the last page is incomplete in both cases. The pages are spread over
+    // a larger physical buffer in a shuffled order.
+    const memory::dim M = 3, page_size = 32, n_phys_pages = 5;
+    for (const bool paged_k : {true, false}) {
+        const memory::dim K = paged_k ? 80 : 48;
+        const memory::dim N = paged_k ? 48 : 80;
+        const memory::dim paged_dim = paged_k ? K : N;
+        const memory::dim n_pages = (paged_dim + page_size - 1) / page_size;
+        const memory::dim phys_dim = n_phys_pages * page_size;
+        const auto wei_tag = paged_k ? tag::ab : tag::ba;
+
+        auto src_md = memory::desc({M, K}, memory::data_type::f32, tag::ab);
+        auto wei_md = memory::desc({K, N}, memory::data_type::f32, wei_tag);
+        auto phys_wei_md = memory::desc(paged_k
+                        ? memory::dims {phys_dim, N}
+                        : memory::dims {K, phys_dim},
+                memory::data_type::f32, wei_tag);
+        auto pt_md = memory::desc({n_pages}, memory::data_type::s32, tag::a);
+        auto dst_md = memory::desc({M, N}, memory::data_type::f32, tag::ab);
+
+        primitive_attr attr;
+        attr.set_weights_page_size(page_size);
+        ASSERT_EQ(attr.get_weights_page_size(), page_size);
+
+        // The reference implementation supports paged weights on any CPU.
+        matmul::primitive_desc matmul_pd;
+        if (!create_matmul_pd(matmul_pd, eng, src_md, wei_md, dst_md, attr,
+                    cpu_isa::sse41))
+            GTEST_SKIP() << "Paged weights are not supported";
+        auto matmul_p = matmul(matmul_pd);
+
+        auto page = [&](memory::dim p) { return (p * 3 + 1) % n_phys_pages; };
+        auto phys_idx = [&](memory::dim i) {
+            return page(i / page_size) * page_size + i % page_size;
+        };
+        // The values depend on the physical location of the weights.
+        auto wei_value = [&](memory::dim k, memory::dim n) {
+            const memory::dim pk = paged_k ? phys_idx(k) : k;
+            const memory::dim pn = paged_k ? n : phys_idx(n);
+            return (float)((pk * 5 + pn * 3) % 9 - 4);
+        };
+
+        auto src_m = test::make_memory(src_md, eng);
+        auto phys_wei_m = test::make_memory(phys_wei_md, eng);
+        auto pt_m = test::make_memory(pt_md, eng);
+        auto dst_m = test::make_memory(dst_md, eng);
+        {
+            auto s = map_memory<float>(src_m);
+            for (memory::dim i = 0; i < M * K; i++)
+                s[i] = (float)((i * 7) % 11 - 5);
+            auto w = map_memory<float>(phys_wei_m);
+            for (memory::dim i = 0; i < phys_dim * (paged_k ? N : K); i++)
+                w[i] = 100.f;
+            for (memory::dim k = 0; k < K; k++)
+                for (memory::dim n = 0; n < N; n++) {
+                    const memory::dim off = paged_k
+                            ? phys_idx(k) * N + n
+                            : phys_idx(n) * K + k;
+                    w[off] = wei_value(k, n);
+                }
+            auto pt = map_memory<int32_t>(pt_m);
+            for (memory::dim p = 0; p < n_pages; p++)
+                pt[p] = (int32_t)page(p);
+        }
+        // The logical weights share the buffer with the physical ones.
+        auto wei_m = memory(wei_md, eng, phys_wei_m.get_data_handle());
+
+        matmul_p.execute(strm,
+                {{DNNL_ARG_SRC, src_m}, {DNNL_ARG_WEIGHTS, wei_m},
+                        {DNNL_ARG_WEIGHTS_PAGE_TABLE, pt_m},
+                        {DNNL_ARG_DST, dst_m}});
+        strm.wait();
+
+        auto s = map_memory<float>(src_m);
+        auto d = map_memory<float>(dst_m);
+        for (memory::dim m = 0; m < M; m++)
+            for (memory::dim n = 0; n < N; n++) {
+                float ref = 0.f;
+                for (memory::dim k = 0; k < K; k++)
+                    ref += s[m * K + k] * wei_value(k, n);
+                ASSERT_EQ(d[m * N + n], ref) << "paged_k: " << paged_k
+                                             << " m: " << m << " n: " << n;
+            }
+    }
+}
+
+TEST(matmul_wei_zero_points_test_t, TestPerColumn) {
+    auto eng = get_test_engine();
+    auto strm = make_stream(eng);
+
+    // Every column of the weights has its own zero point, the source has a
+    // common one. N has a tail with respect to the kernel blocking.
+    const memory::dim M = 5, K = 100, N = 40;
+    for (const auto wei_dt : {memory::data_type::s8, memory::data_type::u8}) {
+        const bool is_u8 = wei_dt == memory::data_type::u8;
+        auto src_md = memory::desc({M, K}, memory::data_type::u8, tag::ab);
+        auto wei_md = memory::desc({K, N}, wei_dt, tag::ab);
+        auto dst_md = memory::desc({M, N}, memory::data_type::f32, tag::ab);
+        auto src_zp_md = memory::desc({1}, memory::data_type::s32, tag::a);
+        auto wei_zp_md = memory::desc({N}, memory::data_type::s32, tag::a);
+
+        primitive_attr attr;
+        attr.set_zero_points_mask(DNNL_ARG_SRC, 0);
+        attr.set_zero_points_mask(DNNL_ARG_WEIGHTS, 1 << 1);
+
+        matmul::primitive_desc matmul_pd;
+        if (!create_matmul_pd(matmul_pd, eng, src_md, wei_md, dst_md, attr,
+                    cpu_isa::avx512_core))
+            GTEST_SKIP() << "Per-column weights zero points are not "
+                            "supported";
+        auto matmul_p = matmul(matmul_pd);
+
+        const int src_zp = 3;
+        auto src_value = [](memory::dim i) { return (int)((i * 37) % 255); };
+        auto wei_value = [&](memory::dim i) {
+            return (int)((i * 7) % 11) + (is_u8 ? 120 : -5);
+        };
+        auto wei_zp_value = [&](memory::dim n) {
+            return (int)(n % 7) + (is_u8 ? 123 : -3);
+        };
+
+        auto src_m = test::make_memory(src_md, eng);
+        auto wei_m = test::make_memory(wei_md, eng);
+        auto dst_m = test::make_memory(dst_md, eng);
+        auto src_zp_m = test::make_memory(src_zp_md, eng);
+        auto wei_zp_m = test::make_memory(wei_zp_md, eng);
+        {
+            auto s = map_memory<uint8_t>(src_m);
+            for (memory::dim i = 0; i < M * K; i++)
+                s[i] = (uint8_t)src_value(i);
+            if (is_u8) {
+                auto w = map_memory<uint8_t>(wei_m);
+                for (memory::dim i = 0; i < K * N; i++)
+                    w[i] = (uint8_t)wei_value(i);
+            } else {
+                auto w = map_memory<int8_t>(wei_m);
+                for (memory::dim i = 0; i < K * N; i++)
+                    w[i] = (int8_t)wei_value(i);
+            }
+            auto sz = map_memory<int32_t>(src_zp_m);
+            sz[0] = src_zp;
+            auto wz = map_memory<int32_t>(wei_zp_m);
+            for (memory::dim n = 0; n < N; n++)
+                wz[n] = wei_zp_value(n);
+        }
+
+        matmul_p.execute(strm,
+                {{DNNL_ARG_SRC, src_m}, {DNNL_ARG_WEIGHTS, wei_m},
+                        {DNNL_ARG_DST, dst_m},
+                        {DNNL_ARG_ATTR_ZERO_POINTS | DNNL_ARG_SRC, src_zp_m},
+                        {DNNL_ARG_ATTR_ZERO_POINTS | DNNL_ARG_WEIGHTS,
+                                wei_zp_m}});
+        strm.wait();
+
+        auto d = map_memory<float>(dst_m);
+        for (memory::dim m = 0; m < M; m++)
+            for (memory::dim n = 0; n < N; n++) {
+                int acc = 0;
+                for (memory::dim k = 0; k < K; k++)
+                    acc += (src_value(m * K + k) - src_zp)
+                            * (wei_value(k * N + n) - wei_zp_value(n));
+                ASSERT_EQ(d[m * N + n], (float)acc) << "u8: " << is_u8
+                                                    << " m: " << m
+                                                    << " n: " << n;
+            }
+    }
+}
+
+TEST(matmul_dst_amax_test_t, TestAfterPostOps) {
+    auto eng = get_test_engine();
+    auto strm = make_stream(eng);
+
+    // The linear post-op makes the most negative value the largest in
+    // magnitude, the destination scale is applied after the amax is taken.
+    // N has a tail with respect to the kernel blocking.
+    const memory::dim M = 7, K = 64, N = 45;
+    const float alpha = -3.f, beta = 0.5f, dst_scale = 4.f;
+    auto src_md = memory::desc({M, K}, memory::data_type::f32, tag::ab);
+    auto wei_md = memory::desc({K, N}, memory::data_type::f32, tag::ab);
+    auto dst_md = memory::desc({M, N}, memory::data_type::f32, tag::ab);
+    auto scalar_md = memory::desc({1}, memory::data_type::f32, tag::a);
+
+    post_ops ops;
+    ops.append_eltwise(algorithm::eltwise_linear, alpha, beta);
+    primitive_attr attr;
+    attr.set_post_ops(ops);
+    attr.set_scales_mask(DNNL_ARG_DST, 0);
+    attr.set_dst_amax(true);
+    ASSERT_TRUE(attr.get_dst_amax());
+
+    matmul::primitive_desc matmul_pd;
+    if (!create_matmul_pd(matmul_pd, eng, src_md, wei_md, dst_md, attr,
+                cpu_isa::avx512_core))
+        GTEST_SKIP() << "Destination amax is not supported";
+    auto matmul_p = matmul(matmul_pd);
+
+    auto src_value = [](memory::dim i) { return (float)((i * 13) % 7) - 2; };
+    auto wei_value = [](memory::dim i) { return (float)((i * 5) % 9) - 3; };
+
+    auto src_m = test::make_memory(src_md, eng);
+    auto wei_m = test::make_memory(wei_md, eng);
+    auto dst_m = test::make_memory(dst_md, eng);
+    auto dst_scale_m = test::make_memory(scalar_md, eng);
+    auto dst_amax_m = test::make_memory(scalar_md, eng);
+    {
+        auto s = map_memory<float>(src_m);
+        for (memory::dim i = 0; i < M * K; i++)
+            s[i] = src_value(i);
+        auto w = map_memory<float>(wei_m);
+        for (memory::dim i = 0; i < K * N; i++)
+            w[i] = wei_value(i);
+        map_memory<float>(dst_scale_m)[0] = dst_scale;
+        map_memory<float>(dst_amax_m)[0] = -1.f;
+    }
+
+    matmul_p.execute(strm,
+            {{DNNL_ARG_SRC, src_m}, {DNNL_ARG_WEIGHTS, wei_m},
+                    {DNNL_ARG_DST, dst_m},
+                    {DNNL_ARG_ATTR_SCALES | DNNL_ARG_DST, dst_scale_m},
+                    {DNNL_ARG_DST_AMAX, dst_amax_m}});
+    strm.wait();
+
+    float ref_amax = 0.f;
+    for (memory::dim m = 0; m < M; m++)
+        for (memory::dim n = 0; n < N; n++) {
+            float acc = 0.f;
+            for (memory::dim k = 0; k < K; k++)
+                acc += src_value(m * K + k) * wei_value(k * N + n);
+            ref_amax = std::max(ref_amax, std::fabs(alpha * acc + beta));
+        }
+    ASSERT_EQ(map_memory<float>(dst_amax_m)[0], ref_amax);
+}
+
 } // namespace dnnl
@@ -44,9 +44,10 @@ HANDLE_EXCEPTIONS_FOR_TEST(
     ASSERT_NO_THROW(cache_blob_id = pd.get_cache_blob_id());
     ASSERT_EQ(cache_blob_id, pd.get_cache_blob_id());
 
-    if (get_test_engine_kind() != engine::kind::gpu
-            || (get_test_engine_kind() == engine::kind::gpu
-                    && DNNL_GPU_RUNTIME != DNNL_RUNTIME_OCL)) {
+    const bool is_supported = get_test_engine_kind() == engine::kind::gpu
+            ? DNNL_GPU_RUNTIME == DNNL_RUNTIME_OCL
+            : DNNL_CPU_RUNTIME != DNNL_RUNTIME_SYCL;
+    if (!is_supported) {
         ASSERT_EQ(cache_blob_id.empty(), true);
         EXPECT_ANY_THROW(cache_blob = p.get_cache_blob());
         ASSERT_EQ(cache_blob.empty(), true);
@@ -60,6 +61,77 @@ HANDLE_EXCEPTIONS_FOR_TEST(
     }
 }
 
+HANDLE_EXCEPTIONS_FOR_TEST(
+        persistent_cache_api_test_t, TestPersistentCacheAPICPU) {
+    SKIP_IF(get_test_engine_kind() != engine::kind::cpu
+                    || DNNL_CPU_RUNTIME == DNNL_RUNTIME_SYCL,
+            "Test is designed for native CPU runtimes only.");
+    engine e = get_test_engine();
+
+    // Disable the primitive cache to make sure that primitives are created
+    // from cache blobs.
+    const int capacity = get_primitive_cache_capacity();
+    set_primitive_cache_capacity(0);
+
+    const memory::dims dims = {2, 32, 8, 8};
+    auto src_md = memory::desc(
+            dims, memory::data_type::f32, memory::format_tag::nchw);
+    auto dst_md = memory::desc(
+            dims, memory::data_type::f32, memory::format_tag::nhwc);
+    auto reorder_pd = reorder::primitive_desc(e, src_md, e, dst_md);
+
+    auto a_md = memory::desc(
+            {64, 96}, memory::data_type::f32, memory::format_tag::ab);
+    auto b_md = memory::desc(
+            {96, 48}, memory::data_type::f32, memory::format_tag::ab);
+    auto c_md = memory::desc(
+            {64, 48}, memory::data_type::f32, memory::format_tag::ab);
+    auto matmul_pd = matmul::primitive_desc(e, a_md, b_md, c_md);
+
+    std::vector<uint8_t> reorder_blob, matmul_blob;
+    ASSERT_NO_THROW(reorder_blob = reorder(reorder_pd).get_cache_blob());
+    ASSERT_NO_THROW(matmul_blob = matmul(matmul_pd).get_cache_blob());
+    ASSERT_FALSE(reorder_blob.empty());
+    ASSERT_FALSE(matmul_blob.empty());
+
+    // Primitives created from the cache blobs are expected to produce the
+    // same cache blobs.
+    reorder r;
+    matmul m;
+    ASSERT_NO_THROW(r = reorder(reorder_pd, reorder_blob));
+    ASSERT_NO_THROW(m = matmul(matmul_pd, matmul_blob));
+    ASSERT_EQ(r.get_cache_blob(), reorder_blob);
+    ASSERT_EQ(m.get_cache_blob(), matmul_blob);
+
+    // Restored kernels are functional.
+    stream s(e);
+    memory src(src_md, e), dst(dst_md, e);
+    fill_data<float>(src_md.get_size() / sizeof(float), src);
+    r.execute(s, src, dst);
+    s.wait();
+    {
+        auto src_ptr = map_memory<float>(src);
+        auto dst_ptr = map_memory<float>(dst);
+        const memory::dim N = dims[0], C = dims[1], H = dims[2], W = dims[3];
+        for_(memory::dim n = 0; n < N; n++)
+        for_(memory::dim c = 0; c < C; c++)
+        for_(memory::dim h = 0; h < H; h++)
+        for (memory::dim w = 0; w < W; w++) {
+            const auto src_off = ((n * C + c) * H + h) * W + w;
+            const auto dst_off = ((n * H + h) * W + w) * C + c;
+            ASSERT_EQ(src_ptr[src_off], dst_ptr[dst_off]);
+        }
+    }
+
+    // A blob created for a different CPU or ISA is rejected. The device
+    // signature is stored first, right after its size.
+    auto stale_blob = matmul_blob;
+    stale_blob[sizeof(size_t)] ^= 0xff;
+    EXPECT_ANY_THROW(matmul(matmul_pd, stale_blob));
+
+    set_primitive_cache_capacity(capacity);
+}
+
 #if DNNL_GPU_RUNTIME == DNNL_RUNTIME_OCL
 HANDLE_EXCEPTIONS_FOR_TEST(
         persistent_cache_api_test_t, TestPersistentCacheAPIEngine) {
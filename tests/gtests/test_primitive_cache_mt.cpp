@@ -14,6 +14,9 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <thread>
+#include <vector>
+
 #include "dnnl_test_common.hpp"
 #include "gtest/gtest.h"
 
@@ -102,4 +105,100 @@ TEST(primitive_cache_mt_test, TestMTCacheHit) {
     ASSERT_EQ(get_primitive_cache_size(), n_primitives);
 }
 
+// Creates the same primitives from several threads and checks that each of
+// them is created once while all the other creations hit the cache. With a
+// capacity smaller than the number of primitives the misses evict entries.
+TEST(primitive_cache_mt_test, TestMTCacheHitCounts) {
+    using tag = memory::format_tag;
+    using dt = memory::data_type;
+
+    engine eng(get_test_engine_kind(), 0);
+
+    const int n_primitives = 32;
+    std::vector<eltwise_forward::primitive_desc> pds;
+    for (int i = 0; i < n_primitives; i++) {
+        auto md = memory::desc({{i + 1, 1, 1, 1}, dt::f32, tag::nchw});
+        pds.emplace_back(eng, prop_kind::forward_inference,
+                algorithm::eltwise_relu, md, md, 0.f);
+    }
+
+    const int nthr = 4;
+    const int n_iters = 4;
+    const uint64_t n_creations = nthr * n_iters * n_primitives;
+    const auto create_primitives = [&]() {
+        std::vector<std::thread> threads;
+        for (int ithr = 0; ithr < nthr; ithr++) {
+            threads.emplace_back([&, ithr]() {
+                for (int iter = 0; iter < n_iters; iter++)
+                    for (int i = 0; i < n_primitives; i++)
+                        eltwise_forward p(pds[(ithr + i) % n_primitives]);
+            });
+        }
+        for (auto &t : threads)
+            t.join();
+    };
+
+    // Flush the cache
+    set_primitive_cache_capacity(0);
+    set_primitive_cache_capacity(1024);
+    reset_primitive_cache_stats();
+
+    create_primitives();
+    auto stats = get_primitive_cache_stats(primitive::kind::eltwise);
+    ASSERT_EQ(stats.misses, (uint64_t)n_primitives);
+    ASSERT_EQ(stats.hits, n_creations - n_primitives);
+    ASSERT_EQ(stats.evictions, 0u);
+    ASSERT_EQ(get_primitive_cache_size(), n_primitives);
+
+    const int capacity = n_primitives / 2;
+    set_primitive_cache_capacity(capacity);
+    reset_primitive_cache_stats();
+
+    create_primitives();
+    stats = get_primitive_cache_stats(primitive::kind::eltwise);
+    ASSERT_EQ(stats.hits + stats.misses, n_creations);
+    ASSERT_GE(stats.misses, (uint64_t)(n_primitives - capacity));
+    // Every added entry is either still in the cache or evicted.
+    const int size = get_primitive_cache_size();
+    ASSERT_LE(size, capacity);
+    ASSERT_EQ(size + stats.evictions, capacity + stats.misses);
+
+    set_primitive_cache_capacity(1024);
+}
+
+TEST(primitive_cache_mt_test, TestWarmUp) {
+    using tag = memory::format_tag;
+    using dt = memory::data_type;
+
+    engine eng(get_test_engine_kind(), 0);
+
+    // Flush the cache
+    set_primitive_cache_capacity(0);
+    set_primitive_cache_capacity(1024);
+
+    const int n_primitives = 16;
+    std::vector<eltwise_forward::primitive_desc> pds;
+    for (int i = 0; i < n_primitives; i++) {
+        auto md = memory::desc({{i + 1, 1, 1, 1}, dt::f32, tag::nchw});
+        pds.emplace_back(eng, prop_kind::forward_inference,
+                algorithm::eltwise_relu, md, md, 0.f);
+    }
+
+    warm_up_primitive_cache({pds.begin(), pds.end()});
+    // Primitives that are still being created in the background are not
+    // created once again.
+    for (int i = 0; i < n_primitives / 2; i++)
+        eltwise_forward p(pds[i]);
+    wait_primitive_cache_warm_up();
+    ASSERT_EQ(get_primitive_cache_size(), n_primitives);
+
+    // The primitive descriptors may be destroyed right after submission.
+    set_primitive_cache_capacity(0);
+    set_primitive_cache_capacity(1024);
+    warm_up_primitive_cache({pds.begin(), pds.end()});
+    pds.clear();
+    wait_primitive_cache_warm_up();
+    ASSERT_EQ(get_primitive_cache_size(), n_primitives);
+}
+
 } // namespace dnnl
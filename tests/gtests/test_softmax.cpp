@@ -14,6 +14,9 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <algorithm>
+#include <cmath>
+
 #include "dnnl_test_common.hpp"
 #include "gtest/gtest.h"
 
@@ -537,4 +540,72 @@ INSTANTIATE_TEST_SUITE_P(Test_Softmax_Forward_S8, softmax_test_t,
                         tag::nhwc, tag::nhwc, tag::undef, {2, 1011, 32, 1},
                         2}));
 
+TEST(softmax_dst_zero_point_test_t, TestU8) {
+    auto eng = get_test_engine();
+    auto strm = make_stream(eng);
+
+    // The axis length is not a multiple of the vector length.
+    const memory::dim N = 3, C = 37;
+    const float dst_scale = 1.f / 512.f;
+    const int32_t dst_zp = 100;
+    auto src_value = [&](memory::dim n, memory::dim c) {
+        return (float)((n * C + c) % 11 - 5) / 4.f;
+    };
+
+    auto src_md = memory::desc({N, C}, dt::f32, tag::nc);
+    auto dst_md = memory::desc({N, C}, dt::u8, tag::nc);
+    auto scale_md = memory::desc({1}, dt::f32, tag::a);
+    auto zp_md = memory::desc({1}, dt::s32, tag::a);
+
+    primitive_attr attr;
+    attr.set_scales_mask(DNNL_ARG_DST, 0);
+    attr.set_zero_points_mask(DNNL_ARG_DST, 0);
+
+    softmax_forward::primitive_desc softmax_pd;
+    try {
+        softmax_pd = softmax_forward::primitive_desc(eng,
+                prop_kind::forward_inference, algorithm::softmax_accurate,
+                src_md, dst_md, 1, attr);
+    } catch (error &e) {
+        if (e.status == dnnl_unimplemented)
+            GTEST_SKIP() << "Destination zero point is not supported";
+        throw;
+    }
+
+    auto src_m = test::make_memory(src_md, eng);
+    auto dst_m = test::make_memory(dst_md, eng);
+    auto scale_m = test::make_memory(scale_md, eng);
+    auto zp_m = test::make_memory(zp_md, eng);
+    {
+        auto s = map_memory<float>(src_m);
+        for (memory::dim n = 0; n < N; n++)
+            for (memory::dim c = 0; c < C; c++)
+                s[n * C + c] = src_value(n, c);
+        map_memory<float>(scale_m)[0] = dst_scale;
+        map_memory<int32_t>(zp_m)[0] = dst_zp;
+    }
+
+    softmax_forward(softmax_pd)
+            .execute(strm,
+                    {{DNNL_ARG_SRC, src_m}, {DNNL_ARG_DST, dst_m},
+                            {DNNL_ARG_ATTR_SCALES | DNNL_ARG_DST, scale_m},
+                            {DNNL_ARG_ATTR_ZERO_POINTS | DNNL_ARG_DST, zp_m}});
+    strm.wait();
+
+    auto d = map_memory<uint8_t>(dst_m);
+    for (memory::dim n = 0; n < N; n++) {
+        float max = src_value(n, 0);
+        for (memory::dim c = 1; c < C; c++)
+            max = std::max(max, src_value(n, c));
+        float sum = 0.f;
+        for (memory::dim c = 0; c < C; c++)
+            sum += std::exp(src_value(n, c) - max);
+        for (memory::dim c = 0; c < C; c++) {
+            const float p = std::exp(src_value(n, c) - max) / sum;
+            const float ref = p / dst_scale + dst_zp;
+            ASSERT_NEAR((float)d[n * C + c], ref, 1.f);
+        }
+    }
+}
+
 } // namespace dnnl